@@ -20,11 +20,20 @@
 
 #include "include/generic.h"        // for Bool
 #include "include/SW_datastructs.h" // for SW_RUN, LOG_INFO, SW_DOMAIN, SW_OU...
+#include <stddef.h>                 // for size_t
+#include <stdint.h>                 // for uint64_t
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** File extension of spinup state snapshots, see SW_CTL_write_spinup_state()
+ */
+#define SW_SPINUP_STATE_EXT "sw2s"
+
+/** File extension of checkpoints, see SW_CTL_write_checkpoint() */
+#define SW_CHECKPOINT_EXT "sw2c"
+
 /* =================================================== */
 /*             Global Function Declarations            */
 /* --------------------------------------------------- */
@@ -75,10 +84,36 @@ void SW_CTL_run_current_year(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo);
 
 void SW_CTL_run_spinup(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo);
 
+uint64_t SW_CTL_hash_spinup(const SW_RUN *sw);
+
+void SW_CTL_write_spinup_state(
+    SW_RUN *sw, uint64_t hash, const char *fname, LOG_INFO *LogInfo
+);
+
+Bool SW_CTL_read_spinup_state(
+    SW_RUN *sw, uint64_t hash, const char *fname, LOG_INFO *LogInfo
+);
+
+uint64_t SW_CTL_hash_checkpoint(const SW_RUN *sw, const SW_OUT_DOM *OutDom);
+
+void SW_CTL_write_checkpoint(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo);
+
+Bool SW_CTL_read_checkpoint(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo);
+
+size_t SW_CTL_sizeof_heap(
+    const SW_RUN *sw, const SW_OUT_DOM *OutDom, size_t heap[]
+);
+
+void SW_CTL_print_memory(
+    SW_RUN *sw_template, SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo
+);
+
 void SW_CTL_run_sw(
     SW_RUN *sw_template,
     SW_DOMAIN *SW_Domain,
     unsigned long ncSuid[],
+    SW_PHASETIMES *PhaseTimes,
+    SW_SUIDDIAG *SuidDiag,
     LOG_INFO *LogInfo
 );
 
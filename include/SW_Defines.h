@@ -65,13 +65,29 @@ extern "C" {
 #define SLOW_DRAIN_DEPTH 15. /* numerator over depth in slow drain equation */
 
 /* some basic constants */
-#define MAX_LAYERS 25        /**< Maximum number of soil layers */
+/* MAX_LAYERS, MAX_ST_RGR, and MAX_NYEAR determine the size of fixed-size
+   arrays of SW_RUN and can be overridden at compile time, e.g., by the
+   build profile `make SW2_PROFILE=slim` */
+#ifndef MAX_LAYERS
+#define MAX_LAYERS 25 /**< Maximum number of soil layers */
+#endif
+#if MAX_LAYERS > 25
+#error "MAX_LAYERS is larger than the number of soil layer column names (25)."
+#endif
 #define MAX_TRANSP_REGIONS 4 /**< Maximum number of transpiration regions */
-#define MAX_ST_RGR 100       /**< Maximum number of soil temperature nodes */
+#ifndef MAX_ST_RGR
+#define MAX_ST_RGR 100 /**< Maximum number of soil temperature nodes */
+#endif
 
 /** An integer representing the max calendar year that is supported. The number
  * just needs to be reasonable, it is an artifical limit. */
+#ifndef MAX_NYEAR
 #define MAX_NYEAR 2500
+#endif
+
+/** Maximum number of distinct (latitude, slope, aspect) combinations held
+ * in the domain-wide cache of solar geometry (each entry is about 38 kB) */
+#define SW_ATMD_CACHE_MAXN 1024
 
 #define SW_MISSING 999. /**< Value to use as MISSING */
 
@@ -114,6 +130,13 @@ extern "C" {
 /** max output string length: in get_transp: 4*every soil layer with 14 chars */
 #define OUTSTRLEN 3000
 
+/** Size [bytes] of the stdio buffer attached to each text output file;
+    rows are written to disk in chunks of this size (override at compile time
+    with, e.g., `CPPFLAGS=-DSW_OUTBUFSIZE=4194304`) */
+#ifndef SW_OUTBUFSIZE
+#define SW_OUTBUFSIZE (1024 * 1024)
+#endif
+
 /** number of floating point decimal digits written to output files */
 #define OUT_DIGITS 6
 
@@ -227,6 +250,13 @@ typedef unsigned short OutPeriod;
 
 #define SW_OUTNMAXVARS 8 // maximum number of output variables per OutKey
 
+/** Maximum number of groups of accumulator fields per OutKey */
+#define SW_OUTNMAXACCU 2
+
+/** Maximum number of output columns per OutKey
+    (e.g., transpiration: total and each vegetation type for each soil layer) */
+#define SW_OUTNMAXCOLS ((NVEGTYPES + 1) * MAX_LAYERS)
+
 /** Number of keys that will be read-in for input netCDFs */
 #define SW_NINKEYSNC 8
 
@@ -300,6 +330,9 @@ typedef enum {
     eOUT  /* output */
 } ObjType;
 
+/** Number of object types (size of arrays indexed by `ObjType`) */
+#define SW_NOBJTYPES (eOUT + 1)
+
 /* Types to use for time and layer-related values and make a custom flag */
 typedef unsigned int TimeInt;
 typedef unsigned int LyrIndex;
@@ -317,6 +350,27 @@ typedef struct timespec WallTimeSpec;
 typedef time_t WallTimeSpec;
 #endif
 
+/** Phases of a simulation run that are timed by the phase profiler
+    (if compiled with `SWPROFILE`);
+    the first group are stages of `SW_CTL_run_sw()`, the second group are
+    daily routines (of spinup and simulation) */
+typedef enum {
+    eSW_PhDeepCopy,    /**< Copy template SW_RUN */
+    eSW_PhInputsNC,    /**< Read suid-specific inputs from netCDFs */
+    eSW_PhInitRun,     /**< Initialize run-time variables */
+    eSW_PhSpinup,      /**< Spinup */
+    eSW_PhSimulation,  /**< Simulation (`SW_CTL_main()`) */
+    eSW_PhOutputsNC,   /**< Write outputs to netCDFs */
+    eSW_PhFreeMem,     /**< De-allocate local SW_RUN */
+    eSW_PhWeather,     /**< Start of a day including daily weather */
+    eSW_PhWaterFlow,   /**< Water flow (including soil temperature) */
+    eSW_PhSoilTemp,    /**< Soil temperature */
+    eSW_PhOutputAggr   /**< Collect, aggregate, and flush output values */
+} SW_PHASE;
+
+/** Number of timed phases */
+#define SW_NPHASES (eSW_PhOutputAggr + 1)
+
 /* Memory copying via `sw_memccpy()` and SOILWAT2's custom function */
 #if (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200809L) || \
     (defined(__STDC__) && defined(__STDC_VERSION__) &&          \
@@ -335,6 +389,11 @@ typedef int sw_random_t; /* not used by rSOILWAT2; it uses instead R's RNG */
 typedef pcg32_random_t sw_random_t;
 #endif
 
+/* Stream identifiers of random number generators of a simulation run
+   (see `RandSeedStream()`) */
+#define SW_RNG_STREAM_MARKOV 1u /**< Weather generator */
+#define SW_RNG_STREAM_SPINUP 2u /**< Random years of spinup mode 1 */
+
 /* =================================================== */
 /*                   unit conversion structs           */
 /* --------------------------------------------------- */
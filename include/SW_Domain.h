@@ -16,6 +16,8 @@ void SW_DOM_calc_ncSuid(
     SW_DOMAIN *SW_Domain, unsigned long suid, unsigned long ncSuid[]
 );
 
+unsigned long SW_DOM_calc_suid(SW_DOMAIN *SW_Domain, unsigned long ncSuid[]);
+
 void SW_DOM_calc_nSUIDs(SW_DOMAIN *SW_Domain);
 
 Bool SW_DOM_CheckProgress(
@@ -11,7 +11,7 @@
 #ifndef SW_PET_H
 #define SW_PET_H
 
-#include "include/SW_datastructs.h" // for SW_ATMD, LOG_INFO
+#include "include/SW_datastructs.h" // for SW_ATMD, SW_ATMD_CACHE, LOG_INFO
 #include "include/SW_Defines.h"     // for TWO_DAYS
 
 #ifdef __cplusplus
@@ -24,6 +24,18 @@ extern "C" {
 /* --------------------------------------------------- */
 void SW_PET_init_run(SW_ATMD *SW_AtmDem);
 
+void SW_PET_init_cache(SW_ATMD_CACHE *AtmDemCache);
+
+void SW_PET_deconstruct_cache(SW_ATMD_CACHE *AtmDemCache);
+
+SW_ATMD *SW_PET_cache_get(
+    SW_ATMD_CACHE *AtmDemCache,
+    double lat,
+    double slope,
+    double aspect,
+    LOG_INFO *LogInfo
+);
+
 
 double sun_earth_distance_squaredinverse(unsigned int doy);
 
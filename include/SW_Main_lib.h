@@ -8,6 +8,7 @@
 
 #include "include/generic.h"        // for Bool
 #include "include/SW_datastructs.h" // for LOG_INFO
+#include "include/SW_Defines.h"     // for TimeInt
 #include <stdio.h>                  // for FILE
 
 #ifdef __cplusplus
@@ -27,6 +28,14 @@ void sw_init_args(
     double *wallTimeLimit,
     Bool *renameDomainTemplateNC,
     Bool *prepareFiles,
+    Bool *buildWeatherCache,
+    Bool *printMemory,
+    Bool *lazyWeather,
+    char **profileFile,
+    char **suidDiagFile,
+    char **spinupStateDir,
+    char **climateCacheDir,
+    TimeInt *checkpointYears,
     LOG_INFO *LogInfo
 );
 
@@ -43,6 +43,8 @@ Bool SW_MKV_read_cov(
     char *txtInFiles[], SW_MARKOV *SW_Markov, LOG_INFO *LogInfo
 );
 
+void SW_MKV_setup_chol(SW_MARKOV *SW_Markov, LOG_INFO *LogInfo);
+
 void SW_MKV_setup(
     SW_MARKOV *SW_Markov,
     unsigned long Weather_rng_seed,
@@ -186,7 +186,7 @@ void SW_OUT_set_colnames(
     unsigned int tLayers,
     SW_VEGESTAB_INFO **parms,
     const IntUS ncol_OUT[],
-    char *colnames_OUT[][5 * NVEGTYPES + MAX_LAYERS],
+    char *colnames_OUT[][SW_OUTNMAXCOLS],
     LOG_INFO *LogInfo
 );
 
@@ -0,0 +1,98 @@
+/********************************************************/
+/********************************************************/
+/*  Source file: SW_Output_outbin.h
+  Type: header
+  Purpose: Support for SW_Output_outbin.c
+  Application: SOILWAT - soilwater dynamics simulator
+  Purpose: define functions to deal with binary columnar outputs; currently,
+    used by SOILWAT2-standalone as alternative to `csv` outputs
+ */
+/********************************************************/
+/********************************************************/
+
+#ifndef SW_OUTPUT_BIN_H
+#define SW_OUTPUT_BIN_H
+
+#include "include/generic.h"        // for Bool, IntUS
+#include "include/SW_datastructs.h" // for SW_OUTBIN_FILE, LOG_INFO, OutKey
+#include "include/SW_Defines.h"     // for OutPeriod, TimeInt
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================================== */
+/*                    Local Defines                    */
+/* --------------------------------------------------- */
+
+/** File extension of binary columnar output files
+    (replaces the extension of the corresponding `csv` output file) */
+#define SW_OUTBIN_EXT "sw2b"
+
+/** Column type: 4-byte signed integer (time columns) */
+#define SW_OUTBIN_INT32 1
+/** Column type: 8-byte floating point (output values) */
+#define SW_OUTBIN_FLOAT64 2
+
+
+/* =================================================== */
+/*             Global Function Declarations            */
+/* --------------------------------------------------- */
+#if defined(SW_OUTBIN)
+void SW_OUTBIN_open(
+    SW_OUTBIN_FILE *bf,
+    const char *fname,
+    OutPeriod pd,
+    unsigned int ncol,
+    unsigned int ntime,
+    char *colnames[],
+    char *units[],
+    Bool compress,
+    LOG_INFO *LogInfo
+);
+
+void SW_OUTBIN_add_values(
+    SW_OUTBIN_FILE *bf,
+    const double values[],
+    unsigned int nvalues,
+    LOG_INFO *LogInfo
+);
+
+void SW_OUTBIN_end_row(
+    SW_OUTBIN_FILE *bf, const int timeValues[], LOG_INFO *LogInfo
+);
+
+void SW_OUTBIN_close(SW_OUTBIN_FILE *bf, LOG_INFO *LogInfo);
+
+const char *SW_OUTBIN_units(OutKey k, IntUS ivar);
+
+void SW_OUT_create_binfiles(
+    SW_OUT_DOM *OutDom,
+    SW_PATH_OUTPUTS *SW_PathOutputs,
+    char *txtInFiles[],
+    LOG_INFO *LogInfo
+);
+
+void SW_OUT_write_binrows(
+    SW_PATH_OUTPUTS *SW_PathOutputs,
+    OutPeriod pd,
+    SW_MODEL *SW_Model,
+    TimeInt tOffset,
+    LOG_INFO *LogInfo
+);
+
+void SW_OUT_close_binfiles(SW_PATH_OUTPUTS *SW_PathOutputs, LOG_INFO *LogInfo);
+#endif
+
+void SW_OUTBIN_read(
+    const char *fname, SW_OUTBIN_DATA *data, LOG_INFO *LogInfo
+);
+
+void SW_OUTBIN_free_data(SW_OUTBIN_DATA *data);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
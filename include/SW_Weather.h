@@ -40,11 +40,19 @@
 #include "include/generic.h"        // for Bool
 #include "include/SW_datastructs.h" // for SW_WEATHER, SW_SKY, SW_MODEL, LOG_...
 #include "include/SW_Defines.h"     // for TimeInt
+#include <stdint.h>                 // for uint64_t
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** File extension of binary weather caches, see SW_WTH_write_cache() */
+#define SW_WTH_CACHE_EXT "wthcache"
+
+/** File extension of cached climate summaries,
+    see SW_WTH_write_climate_cache() */
+#define SW_CLIM_CACHE_EXT "sw2clim"
+
 
 /*  all temps are in degrees C, all precip is in cm */
 /*  in fact, all water variables are in cm throughout
@@ -144,6 +152,40 @@ void deallocateClimateStructs(
     SW_CLIMATE_YEARLY *climateOutput, SW_CLIMATE_CLIM *climateAverages
 );
 
+uint64_t SW_WTH_hash_climate(
+    SW_WEATHER_HIST *allHist,
+    unsigned int numYears,
+    unsigned int startYear,
+    Bool inNorthHem
+);
+
+void SW_WTH_write_climate_cache(
+    const char *cacheDir,
+    uint64_t hash,
+    SW_CLIMATE_CLIM *climateAverages,
+    LOG_INFO *LogInfo
+);
+
+Bool SW_WTH_read_climate_cache(
+    const char *cacheDir,
+    uint64_t hash,
+    SW_CLIMATE_CLIM *climateAverages,
+    LOG_INFO *LogInfo
+);
+
+void SW_WTH_calc_climate_averages(
+    SW_WEATHER_HIST *allHist,
+    TimeInt cum_monthdays[],
+    TimeInt days_in_month[],
+    unsigned int numYears,
+    unsigned int startYear,
+    Bool inNorthHem,
+    const char *cacheDir,
+    SW_CLIMATE_YEARLY *climateOutput,
+    SW_CLIMATE_CLIM *climateAverages,
+    LOG_INFO *LogInfo
+);
+
 void read_weather_hist(
     TimeInt year,
     double **yearWeather,
@@ -154,6 +196,32 @@ void read_weather_hist(
     LOG_INFO *LogInfo
 );
 
+void SW_WTH_write_cache(
+    char txtWeatherPrefix[],
+    unsigned int firstYear,
+    unsigned int nYears,
+    unsigned int n_input_forcings,
+    const unsigned int *dailyInputIndices,
+    const Bool *dailyInputFlags,
+    LOG_INFO *LogInfo
+);
+
+void SW_WTH_read_cache(
+    char txtWeatherPrefix[],
+    unsigned int startYear,
+    unsigned int n_years,
+    unsigned int n_input_forcings,
+    const unsigned int *dailyInputIndices,
+    const Bool *dailyInputFlags,
+    double ***tempWeatherHist,
+    Bool *isCached,
+    LOG_INFO *LogInfo
+);
+
+void SW_WTH_build_cache_tree(
+    SW_WEATHER *SW_Weather, unsigned int *nCaches, LOG_INFO *LogInfo
+);
+
 void SW_WTH_setWeathUsingClimate(
     SW_WEATHER_HIST *yearWeather,
     unsigned int year,
@@ -258,6 +326,13 @@ void SW_WTH_finalize_all_weather(
     LOG_INFO *LogInfo
 );
 
+void SW_WTH_new_year(
+    SW_MARKOV *SW_Markov,
+    SW_WEATHER *SW_Weather,
+    TimeInt year,
+    LOG_INFO *LogInfo
+);
+
 void SW_WTH_init_run(SW_WEATHER *SW_Weather);
 
 void SW_WTH_construct(SW_WEATHER *SW_Weather);
@@ -14,6 +14,7 @@
 
 #include "include/generic.h"    // for Bool
 #include "include/SW_Defines.h" // for MAX_NYEAR, MAX_ST_RGR, MAX_LAYERS, M...
+#include <stdint.h>             // for uint64_t
 #include <stdio.h>              // for FILENAME_MAX, FILE
 
 
@@ -27,6 +28,11 @@
 #define SW_OUTTEXT
 #endif
 
+// Binary columnar output (alternative to `csv` output of SOILWAT2-standalone):
+#if defined(SOILWAT) && defined(SW_OUTTEXT)
+#define SW_OUTBIN
+#endif
+
 #define SW_NINFILES 19                       // For input `txtInFiles`
 #define SW_NOUTFILES 8                       // For output `txtInFiles`
 #define SW_NFILES SW_NINFILES + SW_NOUTFILES // For `txtInFiles`
@@ -121,6 +127,21 @@ typedef struct {
         memoized_int_sin_beta[MAX_DAYS][TWO_DAYS];
 } SW_ATMD;
 
+/** Domain-wide, read-only cache of fully memoized solar geometry
+
+Simulation runs that share latitude, slope, and aspect (e.g., flat grid cells
+along the same row of a gridded domain) share the same entry,
+see `SW_PET_cache_get()`.
+*/
+typedef struct {
+    /** Keys of cached entries: latitude, slope, and aspect [radians] */
+    double (*keys)[3];
+    /** Memoized solar geometry for each cached entry (filled for all days) */
+    SW_ATMD **AtmDem;
+    /** Number of cached entries (up to #SW_ATMD_CACHE_MAXN) */
+    unsigned int nEntries;
+} SW_ATMD_CACHE;
+
 /* =================================================== */
 /*                Spin-up struct                    */
 /* --------------------------------------------------- */
@@ -137,6 +158,16 @@ typedef struct {
 
     sw_random_t spinup_rng; /**< Random number generator used for mode 1 */
 
+    double tolSWC, /**< Adaptive spinup: tolerance [cm] of the largest change
+                      in soil moisture among soil layers between consecutive
+                      spinup years (not checked if 0) */
+        tolTsoil;  /**< Adaptive spinup: tolerance [C] of the largest change
+                      in soil temperature among soil layers between
+                      consecutive spinup years (not checked if 0) */
+
+    TimeInt nYearsUsed; /**< Number of years simulated by the spinup
+                           (less than duration if adaptive spinup converged) */
+
     Bool spinup; /**< Whether the spinup is currently running - used to disable
                     outputs */
 } SW_SPINUP;
@@ -211,6 +242,40 @@ typedef struct {
 /*                 Output text structs                 */
 /* --------------------------------------------------- */
 
+#if defined(SW_OUTBIN)
+/** Binary columnar output file (see SW_Output_outbin.c)
+
+Rows are collected in blocks of `nrowBlock` rows; each block is written
+column by column.
+*/
+typedef struct {
+    FILE *fp;
+    unsigned int ncol;      /**< Number of columns (time and value columns) */
+    unsigned int ntime;     /**< Number of leading (integer) time columns */
+    unsigned int nrowBlock; /**< Maximum number of rows per block */
+    unsigned int nrow;      /**< Number of complete rows in current block */
+    unsigned int icol;      /**< Next column of current row to fill */
+    Bool compress;          /**< Encode columns to reduce file size */
+
+    /** Values of current block (column-major, `ncol` x `nrowBlock`) */
+    double *values;
+    /** Work space to encode one column of a block */
+    unsigned char *encBuffer;
+} SW_OUTBIN_FILE;
+#endif
+
+/** Content of a binary columnar output file (see SW_OUTBIN_read()) */
+typedef struct {
+    OutPeriod pd;        /**< Output time step */
+    unsigned int ncol;   /**< Number of columns (time and value columns) */
+    unsigned int ntime;  /**< Number of leading (integer) time columns */
+    size_t nrow;         /**< Number of rows */
+    char **colnames;     /**< Column names */
+    char **units;        /**< Units of each column */
+    unsigned char *type; /**< Type of each column (see #SW_OUTBIN_INT32) */
+    double *values;      /**< Values (column-major, `ncol` x `nrow`) */
+} SW_OUTBIN_DATA;
+
 typedef struct {
     Bool make_soil[SW_OUTNPERIODS], make_regular[SW_OUTNPERIODS];
 
@@ -232,6 +297,18 @@ typedef struct {
     FILE *fp_soil[SW_OUTNPERIODS];
     char buf_soil[SW_OUTNPERIODS][MAX_LAYERS * OUTSTRLEN];
 
+    // if SOILWAT: stdio buffers (of size SW_OUTBUFSIZE) attached to
+    // `fp_reg` and `fp_soil`; NULL if not allocated
+    char *fpbuf_reg[SW_OUTNPERIODS];
+    char *fpbuf_soil[SW_OUTNPERIODS];
+
+#if defined(SW_OUTBIN)
+    // if binary output: "regular" and soil-layer output files
+    // (shared among copies of SW_RUN); NULL if not used
+    SW_OUTBIN_FILE *bin_reg[SW_OUTNPERIODS];
+    SW_OUTBIN_FILE *bin_soil[SW_OUTNPERIODS];
+#endif
+
 #if defined(SWNETCDF)
     char **ncOutFiles[SW_OUTNKEYS][SW_OUTNPERIODS];
     unsigned int numOutFiles;
@@ -640,6 +717,11 @@ typedef struct {
     *p_accu[SW_OUTNPERIODS],
         /** output aggregator: mean or sum for each output time periods */
         *p_oagg[SW_OUTNPERIODS];
+
+    /** Directory of cached climate summaries used to estimate vegetation
+        (see SW_WTH_calc_climate_averages()); NULL if not used;
+        not owned, i.e., points to #SW_PATH_INPUTS.climateCacheDir */
+    const char *climateCacheDir;
 } SW_VEGPROD;
 
 /* =================================================== */
@@ -650,6 +732,42 @@ typedef struct {
     TimeInt first, last, total;
 } SW_TIMES;
 
+/** Accumulated wall time of phases of simulation runs (see `SW_PHASE`) */
+typedef struct {
+    double
+        /** Summed wall time [seconds] of each phase */
+        timePhase[SW_NPHASES],
+        /** Monotonic clock [seconds] at start of the current call to a phase */
+        timeStartPhase[SW_NPHASES];
+
+    /** Number of timed calls to each phase */
+    unsigned long nPhase[SW_NPHASES];
+} SW_PHASETIMES;
+
+/** Diagnostics of a simulation run (suid) */
+typedef struct {
+    double wallTime; /**< Wall time [seconds] of the run; negative if failed */
+
+    long runMemory; /**< Memory [kilobytes] held by the run, i.e., SW_RUN and
+                       its heap allocations (see SW_CTL_sizeof_heap()) */
+
+    long processPeakMemory; /**< Peak memory [kilobytes] of the process after
+                               the run (a running maximum across runs, i.e.,
+                               not specific to the run); negative if not
+                               available */
+
+    unsigned long
+        nGeneratedDays, /**< Number of days generated by weather generator */
+        nWarnings;      /**< Number of warnings */
+
+    LyrIndex nLayers; /**< Number of soil layers */
+
+    TimeInt nSpinupYears; /**< Number of years simulated by the spinup */
+
+    Bool hasError,     /**< Did the run fail? */
+        soilTempError; /**< Did soil temperature fail? */
+} SW_SUIDDIAG;
+
 typedef struct {
     Bool
         has_walltime; /**< Flag indicating whether timing functionality works */
@@ -670,6 +788,16 @@ typedef struct {
     unsigned long
         nTimedRuns,   /**< Number of simulation runs with timing information */
         nUntimedRuns; /**< Number of simulation runs for which timing failed */
+
+    /** Wall time of phases summed across simulation runs */
+    SW_PHASETIMES PhaseTimes;
+
+    /** Name of file to which phase times are written (NULL if none) */
+    char *profileFile;
+
+    /** Name of file to which diagnostics of each simulation run are
+        written (NULL if none) */
+    char *suidDiagFile;
 } SW_WALLTIME;
 
 /* =================================================== */
@@ -892,6 +1020,18 @@ typedef struct {
     unsigned int startYear; /**< Calendar year corresponding to first year of
                                `allHist` */
 
+    /* Finalization of daily weather on demand
+       (see SW_WTH_finalize_all_weather() and SW_WTH_new_year()) */
+    Bool finalizeLazily;  /**< swTRUE: impute, scale, and check daily weather
+                             of a year just before it is simulated;
+                             swFALSE: of all years upfront */
+    unsigned int n_yearsFinalized; /**< Number of leading years of `allHist`
+                                      that are finalized */
+    SW_WEATHER_NOW lastFinalized;  /**< Imputed (but not scaled) weather of
+                                      the last finalized day */
+    sw_random_t finalizeRng;       /**< State of the weather generator for
+                                      years that are not yet finalized */
+
     SW_WEATHER_NOW now; /**< Weather values of the current simulation day */
 
 } SW_WEATHER;
@@ -1017,6 +1157,12 @@ typedef struct {
     char SW_ProjDir[FILENAME_MAX]; // SW_ProjDir
     char txtWeatherPrefix[FILENAME_MAX];
     char outputPrefix[FILENAME_MAX];
+    char *spinupStateDir; /**< Directory of spinup state snapshots to reuse
+                               the state after spinup (warm start);
+                               NULL if not used */
+    char *climateCacheDir; /**< Directory of cached climate summaries,
+                                see SW_WTH_calc_climate_averages();
+                                NULL if not used */
 
 #if defined(SWNETCDF)
     char **ncInFiles[SW_NINKEYSNC]; /**< Names of all the input netCDF files;
@@ -1206,8 +1352,15 @@ typedef struct {
         *cfnd,       /*correction factor for tmin for dry days */
         u_cov[MAX_WEEKS][2], /* mean weekly maximum and minimum temperature in
                                 degree Celsius */
-        v_cov[MAX_WEEKS][2][2]; /* covariance matrix */
+        v_cov[MAX_WEEKS][2][2], /* covariance matrix */
+        v_chol[MAX_WEEKS][3];   /* Cholesky factor of v_cov:
+                                   sd of tmax, covar / sd of tmax, and
+                                   conditional sd of tmin (see
+                                   `SW_MKV_setup_chol()`) */
+    Bool v_chol_ok;             /* TRUE if `v_chol` was set up from the
+                                   current `v_cov` by `SW_MKV_setup_chol()` */
     int ppt_events;             /* number of ppt events generated this year */
+    unsigned long n_genDays;    /* number of days generated */
     sw_random_t markov_rng;     // used by STEPWAT2
 
 } SW_MARKOV;
@@ -1263,6 +1416,15 @@ typedef enum {
     eSW_LastKey /* make sure this is the last one */
 } OutKey;
 
+/** Group of consecutive output accumulator fields (all of type double)
+    that hold the summed values of an output key */
+typedef struct {
+    size_t offset; /**< Offset [bytes] of first field in accumulator struct */
+    size_t n;      /**< Number of fields of group */
+    Bool byLayer;  /**< TRUE if group consists of rows of `MAX_LAYERS` values
+                      of which only the first `n_layers` are used */
+} SW_OUT_ACCUFIELDS;
+
 /* =================================================== */
 /*         Coordinate Reference System struct          */
 /* --------------------------------------------------- */
@@ -1293,6 +1455,9 @@ typedef struct {
 
     int strideOutYears;   /**< How many years to write out in a single output
                              netCDF -- 1, X (e.g., 10) or Inf (-1) */
+    int streamOutYears;   /**< How many years of output to hold in memory
+                             before writing to output netCDFs (streaming
+                             output) -- X (e.g., 10) or Inf (-1) */
     int baseCalendarYear; /**< Calendar year that is the reference basis of the
                              time units (e.g., days since YYYY-01-01) of every
                              output netCDFs */
@@ -1421,7 +1586,7 @@ struct SW_OUT_DOM {
     // Variables describing size and names of output
     /** names of output columns for each output key; number is an expensive
      * guess */
-    char *colnames_OUT[SW_OUTNKEYS][5 * NVEGTYPES + MAX_LAYERS];
+    char *colnames_OUT[SW_OUTNKEYS][SW_OUTNMAXCOLS];
 
     /* number of outputs */
     IntUS ncol_OUT[SW_OUTNKEYS]; /**< number of output combinations across
@@ -1439,6 +1604,15 @@ struct SW_OUT_DOM {
 #endif
     Bool print_SW_Output;
 
+#if defined(SW_OUTBIN)
+    /** TRUE if output is written to binary columnar files instead of `csv`
+        (`OUTFORMAT binary` in `outsetup.in`) */
+    Bool useBinaryOutput;
+    /** TRUE if columns of binary output files are encoded to reduce
+        file size (`OUTFORMAT binary compress` in `outsetup.in`) */
+    Bool compressBinaryOutput;
+#endif
+
 #if defined(STEPWAT)
     /** `timeSteps_SXW` is the array that keeps track of the output time periods
             that are required for `SXW` in-memory output for each output key.
@@ -1457,7 +1631,9 @@ struct SW_OUT_DOM {
 #endif
 
 #if defined(SW_OUTARRAY)
-    size_t nrow_OUT[SW_OUTNPERIODS]; /**< number of output time steps */
+    /** number of output time steps (rows of `p_OUT`); with streaming
+        output (netCDF), at most `streamOutYears` years of time steps */
+    size_t nrow_OUT[SW_OUTNPERIODS];
 #endif
 
     OutKey mykey[SW_OUTNKEYS];
@@ -1470,6 +1646,40 @@ struct SW_OUT_DOM {
         last_orig[SW_OUTNKEYS]; /* first/last doy that were originally requested
                                  */
 
+    /* Dispatch lists of active output key x output period combinations;
+       compiled once by `find_OutPeriods_inUse()` so that daily output
+       loops visit only requested outputs */
+
+    /** number of active combinations of the daily output loop */
+    IntUS n_activeOut;
+    /** output key of each active combination; combinations of the same
+        output key are consecutive */
+    OutKey activeOutKey[SW_OUTNKEYS * SW_OUTNPERIODS];
+    /** index into `timeSteps` (and `timeSteps_SXW`) of each active
+        combination */
+    IntUS activeOutStep[SW_OUTNKEYS * SW_OUTNPERIODS];
+
+    /** number of output keys that are summed/aggregated for an
+        object type (`ObjType`) and output period */
+    IntUS n_sumKeys[SW_NOBJTYPES][SW_OUTNPERIODS];
+    /** output keys that are summed/aggregated for an object type and
+        output period */
+    OutKey sumKeys[SW_NOBJTYPES][SW_OUTNPERIODS][SW_OUTNKEYS];
+
+    /** number of output keys of an object type whose daily values are
+        summed up (for at least one output period) */
+    IntUS n_dailyKeys[SW_NOBJTYPES];
+    /** output keys of an object type whose daily values are summed up */
+    OutKey dailyKeys[SW_NOBJTYPES][SW_OUTNKEYS];
+    /** TRUE if values of an output key are summed up for an output period */
+    Bool sumOutPeriod[SW_OUTNKEYS][SW_OUTNPERIODS];
+
+    /** number of groups of accumulator fields of an output key */
+    IntUS n_accuFields[SW_OUTNKEYS];
+    /** groups of accumulator fields that hold the summed values of an
+        output key; only these are reset and summed up */
+    SW_OUT_ACCUFIELDS accuFields[SW_OUTNKEYS][SW_OUTNMAXACCU];
+
 #if defined(RSOILWAT)
     char *outfile[SW_OUTNKEYS];
     /* name of output */ // could probably be removed
@@ -1579,6 +1789,10 @@ typedef struct {
     double spatialTol; /**< Tolerence when comparing domain coordinates
                              between nc input files and the nc domain file */
 
+    /** Write a checkpoint of each simulation run every `checkpointYears`
+        years to resume interrupted runs (0, no checkpoints) */
+    TimeInt checkpointYears;
+
     // Information on input files
     SW_PATH_INPUTS SW_PathInputs;
 
@@ -1588,6 +1802,9 @@ typedef struct {
     // Information dealing with netCDFs
     SW_NETCDF_IN netCDFInput;
 
+    // Solar geometry shared among simulation runs
+    SW_ATMD_CACHE AtmDemCache;
+
     // Information that is constant through simulation runs
     SW_OUT_DOM OutDom;
 } SW_DOMAIN;
@@ -1596,12 +1813,30 @@ typedef struct {
 /*               Simulation Run Structs               */
 /* --------------------------------------------------- */
 
+/** Checkpoints of a simulation run (see SW_CTL_write_checkpoint()) */
+typedef struct {
+    /** Name of the checkpoint file (not owned); NULL if not used */
+    const char *fname;
+    TimeInt nYears;   /**< Write a checkpoint every `nYears` years (0, none) */
+    TimeInt nextYear; /**< First year simulated by SW_CTL_main() after a
+                           checkpoint was restored (0, start year) */
+    uint64_t hash;    /**< Hash of inputs and settings of the run */
+} SW_CHECKPOINT;
+
 typedef struct {
 
 #if defined(SW_OUTTEXT)
     char sw_outstr[MAX_LAYERS * OUTSTRLEN];
 #endif
 
+#if defined(SW_OUTBIN)
+    /** TRUE if `get_XXX_text()` store values in `sw_outval` instead of
+        formatting them into `sw_outstr` (binary output) */
+    Bool useOutval;
+    IntUS n_outval; /**< Number of values stored in `sw_outval` */
+    double sw_outval[SW_OUTNMAXCOLS];
+#endif
+
     TimeInt tOffset; /* 1 or 0 means we're writing previous or current period */
 
     /* Output first/last days of current year i.e., updated for each year */
@@ -1619,6 +1854,21 @@ typedef struct {
     size_t irow_OUT[SW_OUTNPERIODS]; /**< current output time step index */
 #endif
 
+#if defined(SWNETCDF)
+    /** Number of output time steps previously written to output netCDFs,
+        i.e., time offset of the first row of `p_OUT` (streaming output) */
+    size_t irowOffset_OUT[SW_OUTNPERIODS];
+
+    /** Time-slice (output netCDF) that holds time step `irowOffset_OUT`,
+        i.e., earlier time-slices are completely written (streaming output) */
+    unsigned int ncFileOffset_OUT[SW_OUTNPERIODS];
+    /** Time offset of the first time step of time-slice `ncFileOffset_OUT` */
+    size_t ncTimeOffset_OUT[SW_OUTNPERIODS];
+
+    size_t ncSuid[2];    /**< Identifier of current suid (streaming output) */
+    const char *domType; /**< Type of domain (streaming output) */
+#endif
+
 #ifdef STEPWAT
     double *p_OUTsd[SW_OUTNKEYS][SW_OUTNPERIODS];
 
@@ -1664,6 +1914,16 @@ struct SW_RUN {
     SW_OUT_RUN OutRun;
 
     SW_ATMD AtmDemand;
+    /** Memoized solar geometry shared across the domain (owned by
+        #SW_DOMAIN); NULL if `AtmDemand` is used instead */
+    SW_ATMD *AtmDemandDom;
+
+    /** Accumulator of phase times (owned by the caller of
+        `SW_CTL_run_sw()`); NULL if phases are not timed */
+    SW_PHASETIMES *PhaseTimes;
+
+    /** Checkpoints of the simulation run */
+    SW_CHECKPOINT Checkpoint;
 };
 
 /* =================================================== */
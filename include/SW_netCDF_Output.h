@@ -87,9 +87,23 @@ void SW_NCOUT_write_output(
     char **ncOutFileNames[][SW_OUTNPERIODS],
     const size_t ncSuid[],
     const char *domType,
+    const size_t nrowWrite[],
+    const size_t irowOffset[],
+    unsigned int fileOffset[],
+    size_t timeOffset[],
     LOG_INFO *LogInfo
 );
 
+void SW_NCOUT_stream_output(
+    SW_OUT_DOM *OutDom,
+    SW_OUT_RUN *OutRun,
+    SW_PATH_OUTPUTS *SW_PathOutputs,
+    Bool flushAll,
+    LOG_INFO *LogInfo
+);
+
+void SW_NCOUT_set_nrow_stream(int streamOutYears, size_t nrow_OUT[]);
+
 void SW_NCOUT_deconstruct(SW_NETCDF_OUT *SW_netCDFOut);
 
 void SW_NCOUT_deepCopy(
@@ -43,6 +43,7 @@
 #include "include/generic.h"        // for Bool
 #include "include/SW_datastructs.h" // for SW_WALLTIME, LOG_INFO
 #include "include/SW_Defines.h"     // for TimeInt, WallTimeSpec
+#include <stdio.h>                  // for FILE
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,6 +73,17 @@ extern "C" {
 #define NoDay 999
 #define WKDAYS 7
 
+/* Phase profiler: time phases of simulation runs only if compiled with
+   `SWPROFILE`, e.g., `CPPFLAGS=-DSWPROFILE make all`; otherwise,
+   the macros expand to no-ops */
+#if defined(SWPROFILE)
+#define SW_PHASE_START(pt, ph) SW_WT_PhaseStart((pt), (ph))
+#define SW_PHASE_STOP(pt, ph) SW_WT_PhaseStop((pt), (ph))
+#else
+#define SW_PHASE_START(pt, ph) ((void) 0)
+#define SW_PHASE_STOP(pt, ph) ((void) 0)
+#endif
+
 extern const TimeInt monthdays[];
 
 /* =================================================== */
@@ -117,6 +129,28 @@ void SW_WT_TimeRun(WallTimeSpec ts, Bool ok_ts, SW_WALLTIME *wt);
 
 void SW_WT_ReportTime(SW_WALLTIME wt, LOG_INFO *LogInfo);
 
+double monotonic_walltime(void);
+
+void SW_WT_InitPhaseTimes(SW_PHASETIMES *pt);
+
+void SW_WT_PhaseStart(SW_PHASETIMES *pt, SW_PHASE ph);
+
+void SW_WT_PhaseStop(SW_PHASETIMES *pt, SW_PHASE ph);
+
+void SW_WT_AddPhaseTimes(SW_PHASETIMES *dest, const SW_PHASETIMES *src);
+
+void SW_WT_WriteProfile(SW_WALLTIME *wt, LOG_INFO *LogInfo);
+
+FILE *SW_WT_OpenSuidDiag(SW_WALLTIME *wt, LOG_INFO *LogInfo);
+
+void SW_WT_WriteSuidDiag(
+    FILE *fp,
+    unsigned long suid,
+    const unsigned long ncSuid[],
+    const SW_SUIDDIAG *diag,
+    LOG_INFO *LogInfo
+);
+
 void timeStringISO8601(char *timeString, int stringLength);
 
 #ifdef __cplusplus
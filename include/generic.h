@@ -63,7 +63,8 @@
 
 #include <float.h>  // for DBL_EPSILON, FLT_EPSILON
 #include <math.h>   // for fabs, sqrt, sqrtf
-#include <stddef.h> // for NULL
+#include <stddef.h> // for NULL, size_t
+#include <stdint.h> // for uint64_t
 
 #ifdef RSOILWAT
 #include <R.h> // for Rprintf() from <R_ext/Print.h>
@@ -303,6 +304,12 @@ char *sw_strtok(
     char inputStr[], size_t *startIndex, size_t *strLen, const char *delim
 );
 
+int sw_split_tokens(char inputStr[], char *tokens[], int maxTokens);
+
+int sw_format_fixed(
+    char *dest, size_t destSize, char sep, double value, int digits
+);
+
 Bool isDelim(char currChar, const char *delim);
 
 void UnComment(char *s);
@@ -337,6 +344,10 @@ double mean(const double values[], unsigned int length);
 
 double standardDeviation(double inputArray[], unsigned int length);
 
+#define SW_HASH_INIT 14695981039346656037ULL // FNV-1a offset basis
+
+void sw_hash_bytes(uint64_t *hash, const void *data, size_t size);
+
 
 #ifdef __cplusplus
 }
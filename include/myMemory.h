@@ -45,6 +45,8 @@ Bool sw_memccpy_inc(
 
 void reportFullBuffer(int errmode, LOG_INFO *LogInfo);
 
+long Mem_PeakUsage(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,8 +31,20 @@ void RandSeed(
     unsigned long initstate, unsigned long initseq, sw_random_t *pcg_rng
 );
 
+void RandSeedStream(
+    unsigned long initstate,
+    unsigned long key,
+    unsigned long streamID,
+    unsigned long nDraws,
+    sw_random_t *pcg_rng
+);
+
+void RandAdvance(unsigned long nDraws, sw_random_t *pcg_rng);
+
 double RandUni(sw_random_t *pcg_rng);
 
+void RandUniFill(unsigned long count, double list[], sw_random_t *pcg_rng);
+
 long RandUniIntRange(const long first, const long last, sw_random_t *pcg_rng);
 
 float RandUniFloatRange(const float min, const float max, sw_random_t *pcg_rng);
@@ -28,10 +28,10 @@
 /* --------------------------------------------------- */
 
 #include "include/SW_Control.h"      // for SW_RUN_deepCopy, SW_CTL_RunSimSet
-#include "include/filefuncs.h"       // for LogError, sw_message
+#include "include/filefuncs.h"       // for LogError, sw_message, CloseFile
 #include "include/generic.h"         // for swTRUE, Bool, swFALSE, GT, IntU
-#include "include/myMemory.h"        // for Mem_Malloc
-#include "include/rands.h"           // for RandUniIntRange
+#include "include/myMemory.h"        // for Mem_Malloc, Mem_PeakUsage
+#include "include/rands.h"           // for RandUniIntRange, RandSeedStream
 #include "include/SW_Carbon.h"       // for SW_CBN_construct, SW_CBN_decons...
 #include "include/SW_datastructs.h"  // for SW_RUN, LOG_INFO, SW_OUTPUT_POI...
 #include "include/SW_Defines.h"      // for TimeInt, WallTimeSpec, SW_WRAPU...
@@ -39,7 +39,7 @@
 #include "include/SW_Files.h"        // for SW_F_construct, SW_F_read, eFirst
 #include "include/SW_Flow.h"         // for SW_FLW_init_run
 #include "include/SW_Flow_lib.h"     // for SW_ST_init_run
-#include "include/SW_Flow_lib_PET.h" // for SW_PET_init_run
+#include "include/SW_Flow_lib_PET.h" // for SW_PET_init_run, SW_PET_cach...
 #include "include/SW_Main_lib.h"     // for sw_init_logs, sw_write_warnings
 #include "include/SW_Markov.h"       // for SW_MKV_init_ptrs, SW_MKV_decons...
 #include "include/SW_Model.h"        // for SW_MDL_construct, SW_MDL_decons...
@@ -47,26 +47,68 @@
 #include "include/SW_Site.h"         // for SW_LYR_read, SW_SIT_construct
 #include "include/SW_Sky.h"          // for SW_SKY_new_year, SW_SKY_read
 #include "include/SW_SoilWater.h"    // for SW_SWC_alloc_outptrs, SW_SWC_co...
+#include "include/SW_Times.h"        // for Today
 #include "include/SW_VegEstab.h"     // for SW_VES_init_ptrs, SW_VES_alloc_...
 #include "include/SW_VegProd.h"      // for SW_VPD_alloc_outptrs, SW_VPD_co...
 #include "include/SW_Weather.h"      // for SW_WTH_alloc_outptrs, SW_WTH_co...
 #include "include/Times.h"           // for diff_walltime, set_walltime
+#include <math.h>                    // for fabs
 #include <signal.h>                  // for signal
-#include <stdio.h>                   // for NULL, snprintf
+#include <stddef.h>                  // for offsetof, size_t
+#include <stdint.h>                  // for uint64_t
+#include <stdio.h>                   // for NULL, snprintf, fopen, rename
 #include <stdlib.h>                  // for free
-#include <string.h>                  // for memcpy, NULL
+#include <string.h>                  // for memcpy, memcmp, memset, NULL
 
 
 #if defined(SWNETCDF)
 #include "include/SW_netCDF_General.h"
 #include "include/SW_netCDF_Input.h"
 #include "include/SW_netCDF_Output.h"
-#include "include/SW_Output_outarray.h"
+#endif
+
+#if defined(SW_OUTARRAY)
+#include "include/SW_Output_outarray.h" // for ncol_TimeOUT
 #endif
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 static volatile sig_atomic_t runSims = 1;
 
+/** Format version of spinup state snapshots, see SW_CTL_write_spinup_state()
+ */
+static const unsigned int spinupStateVersion = 1;
+
+/** Format version of checkpoints, see SW_CTL_write_checkpoint() */
+static const unsigned int checkpointVersion = 2;
+
+/** Byte-order mark of spinup state snapshots and checkpoints
+    (which are native-endian) */
+static const unsigned int stateBOM = 0x01020304;
+
+/** Header of a spinup state snapshot or of a checkpoint */
+typedef struct {
+    char magic[8];
+    unsigned int version;
+    unsigned int bom;
+    unsigned int sizeofDouble;
+    unsigned int nLayers;
+    unsigned int nRgr;
+    unsigned int nSpecies;
+    uint64_t hash;
+} SW_STATE_HEADER;
+
+/** Binary reader/writer of state variables, see stateIO() */
+typedef struct {
+    FILE *fp;      /**< Open binary file; NULL if bytes are only counted */
+    Bool doWrite;  /**< Write (TRUE) or read (FALSE) values */
+    Bool ok;       /**< FALSE once reading or writing failed */
+    size_t nBytes; /**< Number of processed bytes */
+} SW_STATE_IO;
+
+/** Reader/writer of the state variables of a spinup state snapshot or
+    of a checkpoint, see spinupStateIO() and checkpointIO() */
+typedef void (*SW_STATE_IOFUN)(SW_STATE_IO *, SW_RUN *, SW_OUT_DOM *);
+
 /* =================================================== */
 /*             Local Function Definitions              */
 /* --------------------------------------------------- */
@@ -103,6 +145,12 @@ static void begin_year(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
 
     // SW_MKV_new_year() not needed
 
+    // SW_WTH_new_year(): Finalize daily weather of this year (if deferred)
+    SW_WTH_new_year(&sw->Markov, &sw->Weather, sw->Model.year, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
     // SW_SKY_new_year(): Update daily climate variables from monthly values
     SW_SKY_new_year(
         &sw->Model, sw->Sky.snow_density, sw->Sky.snow_density_daily
@@ -144,18 +192,1024 @@ static void begin_day(SW_RUN *sw, LOG_INFO *LogInfo) {
     );
 }
 
-static void end_day(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
-    int localTOffset = 1; // tOffset is one when called from this function
+static void end_day(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
+    int localTOffset = 1; // tOffset is one when called from this function
+
+    if (sw->Model.doOutput) {
+        SW_PHASE_START(sw->PhaseTimes, eSW_PhOutputAggr);
+        collect_values(sw, OutDom, swFALSE, localTOffset, LogInfo);
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
+        SW_PHASE_STOP(sw->PhaseTimes, eSW_PhOutputAggr);
+    }
+
+    SW_SWC_end_day(&sw->SoilWat, sw->Site.n_layers);
+}
+
+/**
+@brief Check whether soil moisture and soil temperature have equilibrated
+    during an adaptive spinup
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] prevSWC Soil moisture [cm] of each soil layer at the end of the
+    previous spinup year
+@param[in] prevTsoil Soil temperature [C] of each soil layer at the end of
+    the previous spinup year
+
+@return TRUE if the changes since the previous spinup year are within the
+    tolerances of every soil layer; soil moisture is not checked if
+    its tolerance is 0 and soil temperature is not checked if its tolerance
+    is 0 or if soil temperature is not simulated.
+*/
+static Bool spinup_has_converged(
+    const SW_RUN *sw, const double prevSWC[], const double prevTsoil[]
+) {
+    LyrIndex i;
+    double tolSWC = sw->Model.SW_SpinUp.tolSWC;
+    double tolTsoil = sw->Model.SW_SpinUp.tolTsoil;
+    Bool checkSWC = (Bool) GT(tolSWC, 0.);
+    Bool checkTsoil = (Bool) (GT(tolTsoil, 0.) && sw->Site.use_soil_temp);
+
+    ForEachSoilLayer(i, sw->Site.n_layers) {
+        if (checkSWC &&
+            GT(fabs(sw->SoilWat.swcBulk[Today][i] - prevSWC[i]), tolSWC)) {
+            return swFALSE;
+        }
+
+        if (checkTsoil &&
+            GT(fabs(sw->SoilWat.avgLyrTemp[i] - prevTsoil[i]), tolTsoil)) {
+            return swFALSE;
+        }
+    }
+
+    return swTRUE;
+}
+
+/**
+@brief Number of soil temperature nodes (including surface and lower
+    boundary) that are part of a spinup state snapshot
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+*/
+static unsigned int spinupStateNRgr(const SW_RUN *sw) {
+    return (sw->Site.stNRGR + 2 < MAX_ST_RGR) ? sw->Site.stNRGR + 2 :
+                                                MAX_ST_RGR;
+}
+
+/**
+@brief Set up the header of a spinup state snapshot or of a checkpoint
+
+Two state files are compatible if their headers are identical.
+
+@param[out] header Header of a state file
+@param[in] magic Identifier of the type of state file
+@param[in] version Format version of the type of state file
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] hash Hash of inputs and settings,
+    see SW_CTL_hash_spinup() and SW_CTL_hash_checkpoint()
+*/
+static void stateHeader(
+    SW_STATE_HEADER *header,
+    const char *magic,
+    unsigned int version,
+    const SW_RUN *sw,
+    uint64_t hash
+) {
+    memset(header, 0, sizeof *header);
+    (void) snprintf(header->magic, sizeof header->magic, "%s", magic);
+    header->version = version;
+    header->bom = stateBOM;
+    header->sizeofDouble = (unsigned int) sizeof(double);
+    header->nLayers = sw->Site.n_layers;
+    header->nRgr = spinupStateNRgr(sw);
+    header->nSpecies = sw->VegEstab.count;
+    header->hash = hash;
+}
+
+/**
+@brief Read or write a block of bytes
+
+Nothing is read or written (but bytes are counted) if the file is NULL
+or if a previous read or write failed.
+
+@param[in,out] io Binary reader/writer of state variables
+@param[in,out] data Values to write or memory that receives read values
+@param[in] size Number of bytes
+*/
+static void stateIO(SW_STATE_IO *io, void *data, size_t size) {
+    size_t res;
+
+    if (io->ok && !isnull(io->fp) && size > 0) {
+        res = io->doWrite ? fwrite(data, size, 1, io->fp) :
+                            fread(data, size, 1, io->fp);
+        io->ok = (Bool) (res == 1);
+    }
+
+    io->nBytes += size;
+}
+
+/**
+@brief Read or write the state variables that a spinup hands off
+    to the simulation run
+
+State variables are soil moisture, snow, surface and intercepted water,
+soil temperature (including the state of the soil temperature regression),
+frozen soil layers, random number generators, and the progress of
+vegetation establishment.
+
+@param[in,out] io Binary reader/writer of state variables
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Not used
+*/
+static void spinupStateIO(SW_STATE_IO *io, SW_RUN *sw, SW_OUT_DOM *OutDom) {
+    SW_SOILWAT *s = &sw->SoilWat;
+    ST_RGR_VALUES *st = &sw->StRegValues;
+    SW_VEGESTAB_INFO *parms;
+    size_t nLyrs = sw->Site.n_layers;
+    size_t lyrSize = sizeof(double) * nLyrs;
+    size_t rgrSize = sizeof(double) * spinupStateNRgr(sw);
+    unsigned int i;
+    int d;
+
+    (void) OutDom; // Silence compiler flag `-Wunused-parameter`
+
+    stateIO(io, &sw->Model.SW_SpinUp.nYearsUsed, sizeof(TimeInt));
+
+    // Soil water, snow, and soil temperature
+    for (d = 0; d < TWO_DAYS; d++) {
+        stateIO(io, s->swcBulk[d], lyrSize);
+        stateIO(io, s->SWA_VegType[d], lyrSize);
+    }
+    stateIO(io, s->is_wet, sizeof(Bool) * nLyrs);
+    stateIO(io, s->snowpack, sizeof s->snowpack);
+    stateIO(io, &s->snowdepth, sizeof s->snowdepth);
+    stateIO(io, &s->surfaceWater, sizeof s->surfaceWater);
+    stateIO(io, s->standingWater, sizeof s->standingWater);
+    stateIO(io, s->veg_int_storage, sizeof s->veg_int_storage);
+    stateIO(io, &s->litter_int_storage, sizeof s->litter_int_storage);
+    stateIO(io, s->avgLyrTemp, lyrSize);
+    stateIO(io, s->lyrFrozen, lyrSize);
+    stateIO(io, s->minLyrTemperature, lyrSize);
+    stateIO(io, s->maxLyrTemperature, lyrSize);
+    stateIO(io, &s->soiltempError, sizeof s->soiltempError);
+
+    // Snow and surface temperature (`snowRunoff` through `temp_snow`)
+    stateIO(
+        io,
+        &sw->Weather.snowRunoff,
+        offsetof(SW_WEATHER, temp_snow) + sizeof(double) -
+            offsetof(SW_WEATHER, snowRunoff)
+    );
+
+    // Soil temperature regression
+    stateIO(io, st->depthsR, rgrSize);
+    stateIO(io, st->fcR, rgrSize);
+    stateIO(io, st->wpR, rgrSize);
+    stateIO(io, st->bDensityR, rgrSize);
+    stateIO(io, st->oldavgLyrTempR, rgrSize);
+    stateIO(io, st->oldsFusionPool_actual, lyrSize);
+    for (i = 0; i < spinupStateNRgr(sw); i++) {
+        stateIO(io, st->tlyrs_by_slyrs[i], sizeof(double) * (nLyrs + 1));
+    }
+    stateIO(io, &st->soil_temp_init, sizeof st->soil_temp_init);
+    stateIO(io, &st->fusion_pool_init, sizeof st->fusion_pool_init);
+    stateIO(io, &st->delta_time, sizeof st->delta_time);
+
+    // Random number generators and weather generator counters
+    stateIO(
+        io,
+        &sw->Model.SW_SpinUp.spinup_rng,
+        sizeof sw->Model.SW_SpinUp.spinup_rng
+    );
+    stateIO(io, &sw->Markov.markov_rng, sizeof sw->Markov.markov_rng);
+    stateIO(io, &sw->Markov.ppt_events, sizeof sw->Markov.ppt_events);
+    stateIO(io, &sw->Markov.n_genDays, sizeof sw->Markov.n_genDays);
+
+    // Vegetation establishment
+    for (i = 0; i < sw->VegEstab.count; i++) {
+        parms = sw->VegEstab.parms[i];
+        stateIO(io, &parms->estab_doy, sizeof(TimeInt));
+        stateIO(io, &parms->germ_days, sizeof(TimeInt));
+        stateIO(io, &parms->drydays_postgerm, sizeof(TimeInt));
+        stateIO(io, &parms->wetdays_for_germ, sizeof(TimeInt));
+        stateIO(io, &parms->wetdays_for_estab, sizeof(TimeInt));
+        stateIO(io, &parms->germd, sizeof(Bool));
+        stateIO(io, &parms->no_estab, sizeof(Bool));
+    }
+}
+
+/**
+@brief Read or write model time of a simulation run
+
+@param[in,out] io Binary reader/writer of state variables
+@param[in,out] m Struct of type SW_MODEL holding basic time information
+    about the simulation
+*/
+static void modelTimeIO(SW_STATE_IO *io, SW_MODEL *m) {
+    stateIO(io, &m->firstdoy, sizeof(TimeInt));
+    stateIO(io, &m->lastdoy, sizeof(TimeInt));
+    stateIO(io, &m->doy, sizeof(TimeInt));
+    stateIO(io, &m->week, sizeof(TimeInt));
+    stateIO(io, &m->month, sizeof(TimeInt));
+    stateIO(io, &m->year, sizeof(TimeInt));
+    stateIO(io, &m->simyear, sizeof(TimeInt));
+    stateIO(io, &m->prevweek, sizeof(TimeInt));
+    stateIO(io, &m->prevmonth, sizeof(TimeInt));
+    stateIO(io, &m->prevyear, sizeof(TimeInt));
+    stateIO(io, m->days_in_month, sizeof m->days_in_month);
+    stateIO(io, m->cum_monthdays, sizeof m->cum_monthdays);
+    stateIO(io, m->newperiod, sizeof m->newperiod);
+}
+
+/**
+@brief Read or write the daily soil water fluxes of a simulation run
+    that are not part of the spinup state (see spinupStateIO())
+
+@param[in,out] io Binary reader/writer of state variables
+@param[in,out] s Struct of type SW_SOILWAT containing soil water
+    related values
+@param[in] nLyrs Number of soil layers
+*/
+static void soilwatFluxIO(SW_STATE_IO *io, SW_SOILWAT *s, size_t nLyrs) {
+    size_t lyrSize = sizeof(double) * nLyrs;
+    int k;
+    int c;
+
+    ForEachVegType(k) {
+        stateIO(io, s->transpiration[k], lyrSize);
+        stateIO(io, s->hydred[k], lyrSize);
+        stateIO(io, s->dSWA_repartitioned_sum[k], lyrSize);
+        for (c = 0; c < NVEGTYPES; c++) {
+            stateIO(io, s->swa_master[k][c], lyrSize);
+        }
+    }
+    stateIO(io, s->evap_baresoil, lyrSize);
+    stateIO(io, s->drain, lyrSize);
+
+    stateIO(io, &s->surfaceWater_evap, sizeof(double));
+    stateIO(io, &s->pet, sizeof(double));
+    stateIO(io, &s->H_oh, sizeof(double));
+    stateIO(io, &s->H_ot, sizeof(double));
+    stateIO(io, &s->H_gh, sizeof(double));
+    stateIO(io, &s->H_gt, sizeof(double));
+    stateIO(io, &s->aet, sizeof(double));
+    stateIO(io, &s->litter_evap, sizeof(double));
+    stateIO(io, s->evap_veg, sizeof s->evap_veg);
+    stateIO(io, &s->litter_int, sizeof(double));
+    stateIO(io, s->int_veg, sizeof s->int_veg);
+}
+
+/**
+@brief Read or write the complete state of a simulation run at the end of
+    a simulation year
+
+The state consists of the state variables that a spinup hands off
+(see spinupStateIO()), model time, daily soil water fluxes and weather
+values, daily snow density, partially aggregated outputs (accumulators), and,
+if output is held in memory, output arrays and their current time step
+index.
+
+@param[in,out] io Binary reader/writer of state variables
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+*/
+static void checkpointIO(SW_STATE_IO *io, SW_RUN *sw, SW_OUT_DOM *OutDom) {
+    SW_OUT_RUN *OutRun = &sw->OutRun;
+    TimeInt nSpecies = sw->VegEstab.count;
+    OutPeriod pd;
+
+#if defined(SW_OUTARRAY)
+    int k;
+    IntUS i;
+    size_t size;
+#endif
+
+    spinupStateIO(io, sw, OutDom);
+
+    // Model time, daily soil water fluxes, and weather of the current day
+    modelTimeIO(io, &sw->Model);
+    soilwatFluxIO(io, &sw->SoilWat, (size_t) sw->Site.n_layers);
+    stateIO(io, &sw->Weather.now, sizeof sw->Weather.now);
+
+    // Daily snow density (interpolated only if the leap-year status changes,
+    // see SW_SKY_new_year())
+    stateIO(
+        io, sw->Sky.snow_density_daily, sizeof sw->Sky.snow_density_daily
+    );
+
+    // Output accumulators
+    stateIO(io, &OutRun->tOffset, sizeof OutRun->tOffset);
+    stateIO(io, OutRun->first, sizeof OutRun->first);
+    stateIO(io, OutRun->last, sizeof OutRun->last);
+
+    ForEachOutPeriod(pd) {
+        if (!isnull(sw->SoilWat.p_accu[pd])) {
+            stateIO(io, sw->SoilWat.p_accu[pd], sizeof(SW_SOILWAT_OUTPUTS));
+        }
+        if (!isnull(sw->Weather.p_accu[pd])) {
+            stateIO(io, sw->Weather.p_accu[pd], sizeof(SW_WEATHER_OUTPUTS));
+        }
+        if (!isnull(sw->VegProd.p_accu[pd])) {
+            stateIO(io, sw->VegProd.p_accu[pd], sizeof(SW_VEGPROD_OUTPUTS));
+        }
+        if (!isnull(sw->VegEstab.p_accu[pd]) &&
+            !isnull(sw->VegEstab.p_accu[pd]->days)) {
+            stateIO(
+                io, sw->VegEstab.p_accu[pd]->days, sizeof(TimeInt) * nSpecies
+            );
+        }
+
+        // Daily aggregators point to daily accumulators
+        if (pd > eSW_Day) {
+            if (!isnull(sw->SoilWat.p_oagg[pd])) {
+                stateIO(io, sw->SoilWat.p_oagg[pd], sizeof(SW_SOILWAT_OUTPUTS));
+            }
+            if (!isnull(sw->Weather.p_oagg[pd])) {
+                stateIO(io, sw->Weather.p_oagg[pd], sizeof(SW_WEATHER_OUTPUTS));
+            }
+            if (!isnull(sw->VegProd.p_oagg[pd])) {
+                stateIO(io, sw->VegProd.p_oagg[pd], sizeof(SW_VEGPROD_OUTPUTS));
+            }
+            if (!isnull(sw->VegEstab.p_oagg[pd]) &&
+                !isnull(sw->VegEstab.p_oagg[pd]->days)) {
+                stateIO(
+                    io,
+                    sw->VegEstab.p_oagg[pd]->days,
+                    sizeof(TimeInt) * nSpecies
+                );
+            }
+        }
+    }
+
+#if defined(SW_OUTARRAY)
+    // Output held in memory
+    ForEachOutKey(k) {
+        for (i = 0; i < OutDom->used_OUTNPERIODS; i++) {
+            pd = OutDom->timeSteps[k][i];
+
+            if (OutDom->use[k] && pd != eSW_NoTime) {
+                size = OutDom->nrow_OUT[pd] *
+                       (OutDom->ncol_OUT[k] + ncol_TimeOUT[pd]);
+
+                stateIO(io, OutRun->p_OUT[k][pd], sizeof(double) * size);
+#if defined(STEPWAT)
+                stateIO(io, OutRun->p_OUTsd[k][pd], sizeof(double) * size);
+#endif
+            }
+        }
+    }
+
+    stateIO(io, OutRun->irow_OUT, sizeof OutRun->irow_OUT);
+#endif
+
+#if defined(SWNETCDF)
+    stateIO(io, OutRun->irowOffset_OUT, sizeof OutRun->irowOffset_OUT);
+#endif
+}
+
+/**
+@brief Write a state file (spinup state snapshot or checkpoint)
+
+The file is written under a temporary name `[fname].tmp` and then renamed;
+thus, an interrupted write does not replace a previous, complete file.
+
+@param[in] fname Name of the state file
+@param[in] header Header of the state file, see stateHeader()
+@param[in] payloadIO Reader/writer of the state variables
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+
+@return TRUE if the state file was written
+*/
+static Bool writeStateFile(
+    const char *fname,
+    SW_STATE_HEADER *header,
+    SW_STATE_IOFUN payloadIO,
+    SW_RUN *sw,
+    SW_OUT_DOM *OutDom
+) {
+    char tmpName[FILENAME_MAX];
+    SW_STATE_IO io = {NULL, swTRUE, swFALSE, 0};
+    int resSNP = snprintf(tmpName, sizeof tmpName, "%s.tmp", fname);
+
+    if (resSNP < 0 || (unsigned) resSNP >= (sizeof tmpName)) {
+        return swFALSE;
+    }
+
+    io.fp = fopen(tmpName, "wb");
+    if (isnull(io.fp)) {
+        return swFALSE;
+    }
+
+    io.ok = (Bool) (fwrite(header, sizeof *header, 1, io.fp) == 1);
+    payloadIO(&io, sw, OutDom);
+
+    if (fclose(io.fp) != 0) {
+        io.ok = swFALSE;
+    }
+
+    if (io.ok && rename(tmpName, fname) != 0) {
+        io.ok = swFALSE;
+    }
+
+    if (!io.ok) {
+        (void) remove(tmpName);
+    }
+
+    return io.ok;
+}
+
+/**
+@brief Restore state variables from a state file (if present)
+
+State variables are restored only if the header of the file is identical to
+the expected header and if the file is complete; otherwise, `sw` is not
+modified.
+
+@param[in] fname Name of the state file
+@param[in] expected Expected header of the state file, see stateHeader()
+@param[in] payloadIO Reader/writer of the state variables
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[out] LogInfo Holds information on warnings and errors
+
+@return TRUE if the state variables were restored
+*/
+static Bool readStateFile(
+    const char *fname,
+    SW_STATE_HEADER *expected,
+    SW_STATE_IOFUN payloadIO,
+    SW_RUN *sw,
+    SW_OUT_DOM *OutDom,
+    LOG_INFO *LogInfo
+) {
+    SW_STATE_HEADER header;
+    SW_STATE_IO io = {NULL, swFALSE, swTRUE, 0};
+    FILE *f = fopen(fname, "rb");
+    Bool restored = swFALSE;
+
+    if (isnull(f)) {
+        return swFALSE; // No state file
+    }
+
+    if (fread(&header, sizeof header, 1, f) != 1 ||
+        memcmp(&header, expected, sizeof header) != 0) {
+        goto closeFile; // Outdated or incompatible state file
+    }
+
+    // Check that the state file is complete before any value is modified
+    payloadIO(&io, sw, OutDom);
+
+    if (fseek(f, 0, SEEK_END) != 0 ||
+        ftell(f) != (long) (sizeof header + io.nBytes) ||
+        fseek(f, (long) sizeof header, SEEK_SET) != 0) {
+        goto closeFile; // Incomplete state file
+    }
+
+    io.fp = f;
+    io.nBytes = 0;
+    payloadIO(&io, sw, OutDom);
+
+    if (io.ok) {
+        restored = swTRUE;
+    } else {
+        LogError(LogInfo, LOGERROR, "Failed to read state file '%s'.", fname);
+    }
+
+closeFile: { CloseFile(&f, LogInfo); }
+
+    return restored;
+}
+
+/**
+@brief Add spinup settings and the state of the random number generators
+    to a hash
+
+@param[in,out] hash Hash value that is updated
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+*/
+static void hashSpinupSettings(uint64_t *hash, const SW_RUN *sw) {
+    const SW_SPINUP *spinup = &sw->Model.SW_SpinUp;
+
+    sw_hash_bytes(hash, &spinup->scope, sizeof spinup->scope);
+    sw_hash_bytes(hash, &spinup->duration, sizeof spinup->duration);
+    sw_hash_bytes(hash, &spinup->mode, sizeof spinup->mode);
+    sw_hash_bytes(hash, &spinup->rng_seed, sizeof spinup->rng_seed);
+    sw_hash_bytes(hash, &spinup->tolSWC, sizeof spinup->tolSWC);
+    sw_hash_bytes(hash, &spinup->tolTsoil, sizeof spinup->tolTsoil);
+    sw_hash_bytes(hash, &spinup->spinup_rng, sizeof spinup->spinup_rng);
+    sw_hash_bytes(hash, &sw->Markov.markov_rng, sizeof sw->Markov.markov_rng);
+}
+
+/** Add a variable (scalar, struct without padding, or fixed-size array) to a
+    hash */
+#define hashVar(hash, x) sw_hash_bytes((hash), &(x), sizeof(x))
+
+/**
+@brief Add the values of soil layers to a hash
+
+@param[in,out] hash Hash value that is updated
+@param[in] x Array of values by soil layer
+@param[in] n_layers Number of soil layers
+*/
+static void hashLayers(uint64_t *hash, const double *x, LyrIndex n_layers) {
+    sw_hash_bytes(hash, x, n_layers * sizeof(double));
+}
+
+/**
+@brief Add site and soil inputs to a hash
+
+@param[in,out] hash Hash value that is updated
+@param[in] s Struct of type SW_SITE describing the simulated site
+*/
+static void hashSite(uint64_t *hash, const SW_SITE *s) {
+    const SW_SOILS *soils = &s->soils;
+    LyrIndex n = s->n_layers;
+    LyrIndex i;
+    unsigned int k;
+
+    hashVar(hash, s->reset_yr);
+    hashVar(hash, s->deepdrain);
+    hashVar(hash, s->use_soil_temp);
+    hashVar(hash, s->type_soilDensityInput);
+    hashVar(hash, s->n_layers);
+    hashVar(hash, s->n_transp_rgn);
+    hashVar(hash, s->n_evap_lyrs);
+    hashVar(hash, s->n_transp_lyrs);
+    hashVar(hash, s->deep_lyr);
+    hashVar(hash, s->slow_drain_coeff);
+    hashVar(hash, s->pet_scale);
+    hashVar(hash, s->TminAccu2);
+    hashVar(hash, s->TmaxCrit);
+    hashVar(hash, s->lambdasnow);
+    hashVar(hash, s->RmeltMin);
+    hashVar(hash, s->RmeltMax);
+    hashVar(hash, s->methodSurfaceTemperature);
+    hashVar(hash, s->stNRGR);
+    hashVar(hash, s->t1Param1);
+    hashVar(hash, s->t1Param2);
+    hashVar(hash, s->t1Param3);
+    hashVar(hash, s->csParam1);
+    hashVar(hash, s->csParam2);
+    hashVar(hash, s->shParam);
+    hashVar(hash, s->bmLimiter);
+    hashVar(hash, s->Tsoil_constant);
+    hashVar(hash, s->stDeltaX);
+    hashVar(hash, s->stMaxDepth);
+    hashVar(hash, s->percentRunoff);
+    hashVar(hash, s->percentRunon);
+    hashVar(hash, s->evap);
+    hashVar(hash, s->transp);
+    hashVar(hash, s->site_swrc_type);
+    hashVar(hash, s->site_ptf_type);
+    hashVar(hash, s->inputsProvideSWRCp);
+    hashVar(hash, s->TranspRgnDepths);
+    hashVar(hash, s->SWCInitVal);
+    hashVar(hash, s->SWCWetVal);
+    hashVar(hash, s->SWCMinVal);
+    hashVar(hash, s->depthSapric);
+    hashVar(hash, s->swrcpOM);
+
+    // Soil layers
+    hashLayers(hash, soils->width, n);
+    hashLayers(hash, soils->depths, n);
+    hashLayers(hash, soils->soilDensityInput, n);
+    hashLayers(hash, soils->evap_coeff, n);
+    ForEachVegType(k) { hashLayers(hash, soils->transp_coeff[k], n); }
+    hashLayers(hash, soils->fractionVolBulk_gravel, n);
+    hashLayers(hash, soils->fractionWeightMatric_sand, n);
+    hashLayers(hash, soils->fractionWeightMatric_clay, n);
+    hashLayers(hash, soils->fractionWeight_om, n);
+    hashLayers(hash, soils->impermeability, n);
+    hashLayers(hash, soils->avgLyrTempInit, n);
+
+    ForEachSoilLayer(i, n) {
+        hashVar(hash, s->swrc_type[i]);
+        hashVar(hash, s->ptf_type[i]);
+        hashVar(hash, soils->swrcpMineralSoil[i]);
+    }
+}
+
+/**
+@brief Add vegetation inputs (without CO2 effects) to a hash
+
+@param[in,out] hash Hash value that is updated
+@param[in] v Struct of type SW_VEGPROD describing surface cover conditions
+    in the simulation
+*/
+static void hashVegProd(uint64_t *hash, const SW_VEGPROD *v) {
+    const VegType *veg;
+    unsigned int k;
+
+    ForEachVegType(k) {
+        veg = &v->veg[k];
+
+        hashVar(hash, veg->cov);
+        hashVar(hash, veg->cnpy);
+        hashVar(hash, veg->canopy_height_constant);
+        hashVar(hash, veg->tr_shade_effects);
+        hashVar(hash, veg->shade_scale);
+        hashVar(hash, veg->shade_deadmax);
+        hashVar(hash, veg->litter);
+        hashVar(hash, veg->biomass);
+        hashVar(hash, veg->pct_live);
+        hashVar(hash, veg->lai_conv);
+        hashVar(hash, veg->flagHydraulicRedistribution);
+        hashVar(hash, veg->maxCondroot);
+        hashVar(hash, veg->swpMatric50);
+        hashVar(hash, veg->shapeCond);
+        hashVar(hash, veg->SWPcrit);
+        hashVar(hash, veg->veg_kSmax);
+        hashVar(hash, veg->veg_kdead);
+        hashVar(hash, veg->lit_kSmax);
+        hashVar(hash, veg->EsTpartitioning_param);
+        hashVar(hash, veg->Es_param_limit);
+        hashVar(hash, veg->co2_bio_coeff1);
+        hashVar(hash, veg->co2_bio_coeff2);
+        hashVar(hash, veg->co2_wue_coeff1);
+        hashVar(hash, veg->co2_wue_coeff2);
+    }
+
+    hashVar(hash, v->bare_cov);
+    hashVar(hash, v->use_SWA);
+    hashVar(hash, v->critSoilWater);
+    hashVar(hash, v->veg_method);
+}
+
+/**
+@brief Add weather settings and parameters of the weather generator to a hash
+
+@param[in,out] hash Hash value that is updated
+@param[in] w Struct of type SW_WEATHER holding all relevant
+    information pretaining to meteorological input data
+@param[in] sky Struct of type SW_SKY which describes sky conditions
+    over the simulated site
+@param[in] markov Struct of type SW_MARKOV which holds values
+    related to temperature and weather generator
+*/
+static void hashWeatherSettings(
+    uint64_t *hash,
+    const SW_WEATHER *w,
+    const SW_SKY *sky,
+    const SW_MARKOV *markov
+) {
+    const double *const mkvDaily[] = {
+        markov->wetprob,
+        markov->dryprob,
+        markov->avg_ppt,
+        markov->std_ppt,
+        markov->cfxw,
+        markov->cfxd,
+        markov->cfnw,
+        markov->cfnd
+    };
+    unsigned int k;
+
+    hashVar(hash, w->use_snow);
+    hashVar(hash, w->use_weathergenerator_only);
+    hashVar(hash, w->generateWeatherMethod);
+    hashVar(hash, w->rng_seed);
+    hashVar(hash, w->pct_snowdrift);
+    hashVar(hash, w->pct_snowRunoff);
+    hashVar(hash, w->scale_precip);
+    hashVar(hash, w->scale_temp_max);
+    hashVar(hash, w->scale_temp_min);
+    hashVar(hash, w->scale_skyCover);
+    hashVar(hash, w->scale_wind);
+    hashVar(hash, w->scale_rH);
+    hashVar(hash, w->scale_actVapPress);
+    hashVar(hash, w->scale_shortWaveRad);
+    hashVar(hash, w->use_cloudCoverMonthly);
+    hashVar(hash, w->use_windSpeedMonthly);
+    hashVar(hash, w->use_humidityMonthly);
+    hashVar(hash, w->dailyInputFlags);
+    hashVar(hash, w->dailyInputIndices);
+    hashVar(hash, w->n_input_forcings);
+    hashVar(hash, w->desc_rsds);
+
+    // Monthly sky conditions
+    hashVar(hash, sky->cloudcov);
+    hashVar(hash, sky->windspeed);
+    hashVar(hash, sky->r_humidity);
+    hashVar(hash, sky->snow_density);
+    hashVar(hash, sky->n_rain_per_day);
+
+    // Weather generator (parameters are allocated only if used)
+    for (k = 0; k < sizeof mkvDaily / sizeof mkvDaily[0]; k++) {
+        if (!isnull(mkvDaily[k])) {
+            sw_hash_bytes(hash, mkvDaily[k], MAX_DAYS * sizeof(double));
+        }
+    }
+    hashVar(hash, markov->u_cov);
+    hashVar(hash, markov->v_cov);
+}
+
+/**
+@brief Add parameters of species establishment to a hash
+
+@param[in,out] hash Hash value that is updated
+@param[in] v Struct of type SW_VEGESTAB holding all information about
+    vegetation establishment within the simulation
+*/
+static void hashVegEstab(uint64_t *hash, const SW_VEGESTAB *v) {
+    const SW_VEGESTAB_INFO *p;
+    IntU i;
+
+    hashVar(hash, v->use);
+    hashVar(hash, v->count);
+
+    for (i = 0; i < v->count; i++) {
+        p = v->parms[i];
+
+        sw_hash_bytes(hash, p->sppname, strlen(p->sppname));
+        hashVar(hash, p->vegType);
+        hashVar(hash, p->min_pregerm_days);
+        hashVar(hash, p->max_pregerm_days);
+        hashVar(hash, p->min_wetdays_for_germ);
+        hashVar(hash, p->max_drydays_postgerm);
+        hashVar(hash, p->min_wetdays_for_estab);
+        hashVar(hash, p->min_days_germ2estab);
+        hashVar(hash, p->max_days_germ2estab);
+        hashVar(hash, p->estab_lyrs);
+        hashVar(hash, p->bars);
+        hashVar(hash, p->min_temp_germ);
+        hashVar(hash, p->max_temp_germ);
+        hashVar(hash, p->min_temp_estab);
+        hashVar(hash, p->max_temp_estab);
+    }
+}
+
+/**
+@brief Add observed soil moisture of a year (if used) to a hash
+
+Observed soil moisture is read from disk at the start of each year
+(see SW_SWC_new_year()); the hash covers the contents of the file.
+
+@param[in,out] hash Hash value that is updated
+@param[in] hist Struct of type SW_SOILWAT_HIST holding parameters for
+    historical (measured) soil moisture
+@param[in] year Calendar year
+*/
+static void hashSoilWatHist(
+    uint64_t *hash, const SW_SOILWAT_HIST *hist, TimeInt year
+) {
+    char fname[MAX_FILENAMESIZE];
+    char buffer[4096];
+    size_t n;
+    FILE *fp = NULL;
+    int resSNP;
+
+    if (year < hist->yr.first || isnull(hist->file_prefix)) {
+        return;
+    }
+
+    resSNP = snprintf(fname, sizeof fname, "%s.%4d", hist->file_prefix, year);
+    if (resSNP >= 0 && (unsigned) resSNP < (sizeof fname)) {
+        fp = fopen(fname, "rb");
+    }
+
+    if (isnull(fp)) {
+        // Missing file is an error when the year is simulated
+        return;
+    }
+
+    while ((n = fread(buffer, 1, sizeof buffer, fp)) > 0) {
+        sw_hash_bytes(hash, buffer, n);
+    }
+
+    (void) fclose(fp);
+}
+
+/**
+@brief Add inputs of a simulation run to a hash
+
+The hash covers explicit input fields (but not derived or state variables,
+padding, file names, or outputs), i.e., site location, soil, site,
+vegetation, and establishment parameters, sky and weather settings,
+parameters of the weather generator, and CO2 effects, daily weather, and
+observed soil moisture (if used) of the years `firstYear` through `lastYear`.
+
+@param[in,out] hash Hash value that is updated
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] firstYear First calendar year of CO2 effects and daily weather
+@param[in] lastYear Last calendar year of CO2 effects and daily weather
+*/
+static void hashInputs(
+    uint64_t *hash, const SW_RUN *sw, TimeInt firstYear, TimeInt lastYear
+) {
+    const SW_WEATHER *w = &sw->Weather;
+    const SW_WEATHER_HIST *yrHist;
+    unsigned int yr;
+    unsigned int simyr;
+    unsigned int k;
+    int d;
+
+    // Simulation time and location
+    hashVar(hash, sw->Model.startyr);
+    hashVar(hash, sw->Model.addtl_yr);
+    hashVar(hash, sw->Model.longitude);
+    hashVar(hash, sw->Model.latitude);
+    hashVar(hash, sw->Model.elevation);
+    hashVar(hash, sw->Model.slope);
+    hashVar(hash, sw->Model.aspect);
+
+    // Site, soils, vegetation, and establishment
+    hashSite(hash, &sw->Site);
+    hashVegProd(hash, &sw->VegProd);
+    hashVar(hash, sw->Carbon.use_wue_mult);
+    hashVar(hash, sw->Carbon.use_bio_mult);
+    hashVegEstab(hash, &sw->VegEstab);
+
+    // Sky and weather settings and weather generator
+    hashWeatherSettings(hash, w, &sw->Sky, &sw->Markov);
+
+    // Observed soil moisture
+    hashVar(hash, sw->SoilWat.hist_use);
+    if (sw->SoilWat.hist_use) {
+        hashVar(hash, sw->SoilWat.hist.method);
+        hashVar(hash, sw->SoilWat.hist.yr.first);
+    }
+
+    // CO2 effects, daily weather, and observed soil moisture of the years
+    for (yr = firstYear; yr <= lastYear; yr++) {
+        simyr = yr + sw->Model.addtl_yr;
+
+        if (simyr < MAX_NYEAR) {
+            hashVar(hash, sw->Carbon.ppm[simyr]);
+
+            ForEachVegType(k) {
+                for (d = 0; d < 2; d++) {
+                    hashVar(hash, sw->VegProd.veg[k].co2_multipliers[d][simyr]);
+                }
+            }
+        }
+
+        if (!isnull(w->allHist) && yr >= w->startYear &&
+            yr - w->startYear < w->n_years) {
+            yrHist = &w->allHist[yr - w->startYear];
+
+            hashVar(hash, yrHist->temp_max);
+            hashVar(hash, yrHist->temp_min);
+            hashVar(hash, yrHist->temp_avg);
+            hashVar(hash, yrHist->ppt);
+            hashVar(hash, yrHist->cloudcov_daily);
+            hashVar(hash, yrHist->windspeed_daily);
+            hashVar(hash, yrHist->r_humidity_daily);
+            hashVar(hash, yrHist->shortWaveRad);
+            hashVar(hash, yrHist->actualVaporPressure);
+        }
+
+        if (sw->SoilWat.hist_use) {
+            hashSoilWatHist(hash, &sw->SoilWat.hist, yr);
+        }
+    }
+}
+
+#undef hashVar
+
+/**
+@brief Print a line of the memory footprint report
+
+@param[in] name Name of the component
+@param[in] bytes Size of the component [bytes]
+*/
+static void printMemoryLine(const char *name, size_t bytes) {
+    sw_printf("    %-28s %12lu\n", name, (unsigned long) bytes);
+}
+
+#if defined(SOILWAT)
+/**
+@brief Run a spin-up or, if available, restore the state after the spin-up
+    from a snapshot
+
+A snapshot is used if it was created with the same inputs and spinup settings
+(see SW_CTL_hash_spinup()); otherwise, the spin-up is run and its final state
+is stored as new snapshot (see SW_CTL_write_spinup_state()).
+
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[in] stateDir Directory of spinup state snapshots
+@param[in] suid Unique identifier of the simulation unit (base0)
+@param[out] LogInfo Holds information on warnings and errors
+*/
+static void run_spinup_warmstart(
+    SW_RUN *sw,
+    SW_OUT_DOM *OutDom,
+    const char *stateDir,
+    unsigned long suid,
+    LOG_INFO *LogInfo
+) {
+    char fname[FILENAME_MAX];
+    uint64_t hash;
+    int resSNP = snprintf(
+        fname,
+        sizeof fname,
+        "%s/spinup_%lu.%s",
+        stateDir,
+        suid + 1,
+        SW_SPINUP_STATE_EXT
+    );
+
+    if (resSNP < 0 || (unsigned) resSNP >= (sizeof fname)) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Spinup state file name is too long for '%s'.",
+            stateDir
+        );
+        return; // Exit function prematurely due to error
+    }
+
+    // Hash daily weather of spinup years after finalization (if deferred)
+    SW_WTH_new_year(
+        &sw->Markov,
+        &sw->Weather,
+        sw->Model.startyr + sw->Model.SW_SpinUp.scope - 1,
+        LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    hash = SW_CTL_hash_spinup(sw);
+
+    if (SW_CTL_read_spinup_state(sw, hash, fname, LogInfo) ||
+        LogInfo->stopRun) {
+        return; // State restored (or error)
+    }
+
+    SW_CTL_run_spinup(sw, OutDom, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    SW_CTL_write_spinup_state(sw, hash, fname, LogInfo);
+}
+
+/**
+@brief Set up checkpoints of a simulation run and, if available, restore the
+    run from its checkpoint
 
-    if (sw->Model.doOutput) {
-        collect_values(sw, OutDom, swFALSE, localTOffset, LogInfo);
-        if (LogInfo->stopRun) {
-            return; // Exit function prematurely due to error
-        }
+Checkpoints are written to `[outputPrefix]checkpoint_[suid].sw2c` every
+`SW_Domain->checkpointYears` years (see SW_CTL_main()).
+
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation (after SW_CTL_init_run())
+@param[in] SW_Domain Struct of type SW_DOMAIN holding constant
+    temporal/spatial information for a set of simulation runs
+@param[in] suid Unique identifier of the simulation unit (base0)
+@param[out] fname Buffer of size `FILENAME_MAX` that holds the name of the
+    checkpoint file (must persist throughout the simulation run)
+@param[out] LogInfo Holds information on warnings and errors
+*/
+static void setup_checkpoint(
+    SW_RUN *sw,
+    SW_DOMAIN *SW_Domain,
+    unsigned long suid,
+    char *fname,
+    LOG_INFO *LogInfo
+) {
+    int resSNP = snprintf(
+        fname,
+        FILENAME_MAX,
+        "%scheckpoint_%lu.%s",
+        SW_Domain->SW_PathInputs.outputPrefix,
+        suid + 1,
+        SW_CHECKPOINT_EXT
+    );
+
+    if (resSNP < 0 || (unsigned) resSNP >= FILENAME_MAX) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Checkpoint file name is too long for '%s'.",
+            SW_Domain->SW_PathInputs.outputPrefix
+        );
+        return; // Exit function prematurely due to error
     }
 
-    SW_SWC_end_day(&sw->SoilWat, sw->Site.n_layers);
+    sw->Checkpoint.fname = fname;
+    sw->Checkpoint.nYears = SW_Domain->checkpointYears;
+    sw->Checkpoint.hash = SW_CTL_hash_checkpoint(sw, &SW_Domain->OutDom);
+
+    (void) SW_CTL_read_checkpoint(sw, &SW_Domain->OutDom, LogInfo);
 }
+#endif
 
 /**
 @brief Copy dynamic memory from a template SW_RUN to a new instance
@@ -262,6 +1316,11 @@ void SW_RUN_deepCopy(
 @brief Calls 'SW_CTL_run_current_year' for each year
           which calls 'SW_SWC_water_flow' for each day.
 
+The simulation run continues after the last restored year if a checkpoint
+was restored (see SW_CTL_read_checkpoint()); a checkpoint is written every
+`sw->Checkpoint.nYears` years if `sw->Checkpoint.fname` is set
+(see SW_CTL_write_checkpoint()).
+
 @param[in,out] sw Comprehensive struct of type SW_RUN containing all
   information in the simulation
 @param[in,out] OutDom Struct of type SW_OUT_DOM that holds output
@@ -275,8 +1334,11 @@ void SW_CTL_main(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
 #endif
 
     TimeInt *cur_yr = &sw->Model.year;
+    SW_CHECKPOINT *ckpt = &sw->Checkpoint;
+    TimeInt firstYear =
+        (ckpt->nextYear > 0) ? ckpt->nextYear : sw->Model.startyr;
 
-    for (*cur_yr = sw->Model.startyr; *cur_yr <= sw->Model.endyr; (*cur_yr)++) {
+    for (*cur_yr = firstYear; *cur_yr <= sw->Model.endyr; (*cur_yr)++) {
 #ifdef SWDEBUG
         if (debug) {
             sw_printf("\n'SW_CTL_main': simulate year = %d\n", *cur_yr);
@@ -287,7 +1349,15 @@ void SW_CTL_main(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
         if (LogInfo->stopRun) {
             return; // Exit function prematurely due to error
         }
+
+        if (!isnull(ckpt->fname) && ckpt->nYears > 0 &&
+            *cur_yr < sw->Model.endyr &&
+            (*cur_yr - sw->Model.startyr + 1) % ckpt->nYears == 0) {
+            SW_CTL_write_checkpoint(sw, OutDom, LogInfo);
+        }
     }
+
+    ckpt->nextYear = 0;
 } /******* End Main Loop *********/
 
 void SW_CTL_RunSimSet(
@@ -300,6 +1370,13 @@ void SW_CTL_RunSimSet(
     unsigned long suid;
     unsigned long nSims = 0;
     unsigned long ncSuid[2]; // 2 -> [y, x] or [s, 0]
+    /* Phase times are accumulated locally across suids and
+       added to the overall phase times at the end */
+    SW_PHASETIMES localPhaseTimes;
+    /* Diagnostics of each simulated suid (if requested) */
+    SW_SUIDDIAG suidDiag;
+    FILE *fpSuidDiag = NULL;
+    double tStartSuid = -1.;
     /* tag_suid is 32:
       11 character for "(suid = ) " + 20 character for ULONG_MAX + '\0' */
     char tag_suid[32];
@@ -322,6 +1399,12 @@ void SW_CTL_RunSimSet(
 #endif
 
     set_walltime(&tss, &ok_tss);
+    SW_WT_InitPhaseTimes(&localPhaseTimes);
+
+    fpSuidDiag = SW_WT_OpenSuidDiag(SW_WallTime, main_LogInfo);
+    if (main_LogInfo->stopRun) {
+        goto wrapUp; // Exit function prematurely due to error
+    }
 
 #if defined(SOILWAT)
     if (main_LogInfo->printProgressMsg) {
@@ -360,9 +1443,36 @@ void SW_CTL_RunSimSet(
 
             /* Simulate suid */
             set_walltime(&tsr, &ok_tsr);
-            SW_CTL_run_sw(sw_template, SW_Domain, ncSuid, &local_LogInfo);
+            if (!isnull(fpSuidDiag)) {
+                tStartSuid = monotonic_walltime();
+            }
+
+            SW_CTL_run_sw(
+                sw_template,
+                SW_Domain,
+                ncSuid,
+                &localPhaseTimes,
+                isnull(fpSuidDiag) ? NULL : &suidDiag,
+                &local_LogInfo
+            );
             SW_WT_TimeRun(tsr, ok_tsr, SW_WallTime);
 
+            if (!isnull(fpSuidDiag)) {
+                suidDiag.wallTime = GE(tStartSuid, 0.) ?
+                                        monotonic_walltime() - tStartSuid :
+                                        -1.;
+                suidDiag.processPeakMemory = Mem_PeakUsage();
+                suidDiag.nWarnings = (unsigned long) local_LogInfo.numWarnings;
+                suidDiag.hasError = local_LogInfo.stopRun;
+
+                SW_WT_WriteSuidDiag(
+                    fpSuidDiag, suid + 1, ncSuid, &suidDiag, main_LogInfo
+                );
+                if (main_LogInfo->stopRun) {
+                    goto wrapUp; // Exit function prematurely due to error
+                }
+            }
+
             /* Report progress for suid */
             SW_DOM_SetProgress(
                 local_LogInfo.stopRun,
@@ -408,7 +1518,12 @@ wrapUp:
     }
 #endif
 
+    if (!isnull(fpSuidDiag)) {
+        CloseFile(&fpSuidDiag, main_LogInfo);
+    }
+
     SW_WallTime->timeSimSet = diff_walltime(tss, ok_tss);
+    SW_WT_AddPhaseTimes(&SW_WallTime->PhaseTimes, &localPhaseTimes);
 }
 
 /**
@@ -419,6 +1534,12 @@ program exit
     all information in the simulation
 */
 void SW_CTL_init_ptrs(SW_RUN *sw) {
+    sw->AtmDemandDom = NULL; // not owned by SW_RUN
+    sw->PhaseTimes = NULL;   // not owned by SW_RUN
+    sw->Checkpoint.fname = NULL; // not owned by SW_RUN
+    sw->Checkpoint.nYears = 0;
+    sw->Checkpoint.nextYear = 0;
+    sw->Checkpoint.hash = 0;
     SW_WTH_init_ptrs(&sw->Weather);
     SW_MKV_init_ptrs(&sw->Markov);
     SW_VES_init_ptrs(&sw->VegEstab);
@@ -662,6 +1783,20 @@ void SW_CTL_init_run(SW_RUN *sw, Bool estVeg, LOG_INFO *LogInfo) {
         return; // Exit function prematurely due to error
     }
 
+    if (estVeg && sw->VegProd.veg_method > 0) {
+        // Estimating vegetation from climate requires all years of daily
+        // weather (finalize them if finalization was deferred)
+        SW_WTH_new_year(
+            &sw->Markov,
+            &sw->Weather,
+            sw->Weather.startYear + sw->Weather.n_years - 1,
+            LogInfo
+        );
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
+    }
+
     SW_VPD_init_run(&sw->VegProd, &sw->Weather, &sw->Model, estVeg, LogInfo);
     if (LogInfo->stopRun) {
         return; // Exit function prematurely due to error
@@ -711,20 +1846,24 @@ void SW_CTL_run_current_year(
             sw_printf("\t: begin doy = %d ... ", *doy);
         }
 #endif
+        SW_PHASE_START(sw->PhaseTimes, eSW_PhWeather);
         begin_day(sw, LogInfo);
         if (LogInfo->stopRun) {
             return; // Exit function prematurely due to error
         }
+        SW_PHASE_STOP(sw->PhaseTimes, eSW_PhWeather);
 
 #ifdef SWDEBUG
         if (debug) {
             sw_printf("simulate water ... ");
         }
 #endif
+        SW_PHASE_START(sw->PhaseTimes, eSW_PhWaterFlow);
         SW_SWC_water_flow(sw, LogInfo);
         if (LogInfo->stopRun) {
             return; // Exit function prematurely due to error
         }
+        SW_PHASE_STOP(sw->PhaseTimes, eSW_PhWaterFlow);
 
         // Only run this function if SWA output is asked for
         if (sw->VegProd.use_SWA) {
@@ -770,7 +1909,9 @@ void SW_CTL_run_current_year(
     }
 #endif
     if (sw->Model.doOutput) {
+        SW_PHASE_START(sw->PhaseTimes, eSW_PhOutputAggr);
         SW_OUT_flush(sw, OutDom, LogInfo);
+        SW_PHASE_STOP(sw->PhaseTimes, eSW_PhOutputAggr);
     }
 
 #ifdef SWDEBUG
@@ -797,6 +1938,15 @@ void SW_CTL_run_current_year(
 
   A spin-up duration of 0 returns immediately (no spin-up).
 
+  Adaptive spin-up (if a tolerance `tolSWC` or `tolTsoil` is positive):
+  the spin-up ends early once the largest change among soil layers in
+  soil moisture and in soil temperature between the end of consecutive
+  spin-up years is within the tolerances; the spin-up duration is the
+  maximum number of years. A warning is issued if the spin-up did not
+  converge within its duration.
+
+  The number of simulated spin-up years is stored in `nYearsUsed`.
+
 @param[in,out] sw Comprehensive struct of type SW_RUN containing all
   information in the simulation
 @param[in] OutDom Struct of type SW_OUT_DOM that holds output
@@ -805,6 +1955,8 @@ void SW_CTL_run_current_year(
 */
 void SW_CTL_run_spinup(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
 
+    sw->Model.SW_SpinUp.nYearsUsed = 0;
+
     if (sw->Model.SW_SpinUp.duration <= 0) {
         return;
     }
@@ -824,6 +1976,11 @@ void SW_CTL_run_spinup(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
     TimeInt finalyr = sw->Model.startyr + scope - 1;
     TimeInt *years;
     Bool prev_doOut = sw->Model.doOutput;
+    Bool adaptive = (Bool) (GT(sw->Model.SW_SpinUp.tolSWC, 0.) ||
+                            GT(sw->Model.SW_SpinUp.tolTsoil, 0.));
+    Bool hasConverged = swFALSE;
+    double prevSWC[MAX_LAYERS];
+    double prevTsoil[MAX_LAYERS];
     years = (TimeInt *) Mem_Malloc(
         sizeof(TimeInt) * duration, "SW_CTL_run_spinup()", LogInfo
     );
@@ -889,7 +2046,7 @@ void SW_CTL_run_spinup(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
 
     sw->Model.doOutput = swFALSE; // turn output temporarily off
 
-    for (yrIdx = 0; yrIdx < duration; yrIdx++) {
+    for (yrIdx = 0; yrIdx < duration && !hasConverged; yrIdx++) {
         *cur_yr = years[yrIdx];
 
 #ifdef SWDEBUG
@@ -906,9 +2063,37 @@ void SW_CTL_run_spinup(SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
         if (LogInfo->stopRun) {
             goto reSet; // Exit function prematurely due to error
         }
+
+        if (adaptive) {
+            hasConverged =
+                (Bool) (yrIdx > 0 &&
+                        spinup_has_converged(sw, prevSWC, prevTsoil));
+
+            memcpy(
+                prevSWC,
+                sw->SoilWat.swcBulk[Today],
+                sizeof(prevSWC[0]) * sw->Site.n_layers
+            );
+            memcpy(
+                prevTsoil,
+                sw->SoilWat.avgLyrTemp,
+                sizeof(prevTsoil[0]) * sw->Site.n_layers
+            );
+        }
+    }
+
+    if (adaptive && !hasConverged) {
+        LogError(
+            LogInfo,
+            LOGWARN,
+            "Adaptive spinup did not converge within %u years.",
+            duration
+        );
     }
 
 reSet: {
+    sw->Model.SW_SpinUp.nYearsUsed = yrIdx; // number of simulated years
+
     sw->Model.startyr = startyr;     // reset startyr to original value
     sw->Model.doOutput = prev_doOut; // reset doOutput to original value
 
@@ -916,6 +2101,378 @@ reSet: {
 }
 }
 
+/**
+@brief Hash of inputs and spinup settings that determine the state after
+    a spin-up
+
+The hash covers spinup settings, the state of the random number generators,
+site location, soil, site, vegetation, and establishment parameters, sky and
+weather settings, parameters of the weather generator, and CO2 effects, daily
+weather, and observed soil moisture of the years within the spinup scope;
+inputs of years beyond the spinup scope do not affect the spin-up.
+
+Call after SW_CTL_init_run() and before SW_CTL_run_spinup().
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+
+@return 64-bit FNV-1a hash
+*/
+uint64_t SW_CTL_hash_spinup(const SW_RUN *sw) {
+    uint64_t hash = SW_HASH_INIT;
+    TimeInt startyr = sw->Model.startyr;
+
+    sw_hash_bytes(&hash, &spinupStateVersion, sizeof spinupStateVersion);
+    hashSpinupSettings(&hash, sw);
+    hashInputs(&hash, sw, startyr, startyr + sw->Model.SW_SpinUp.scope - 1);
+
+    return hash;
+}
+
+/**
+@brief Write a spinup state snapshot
+
+The snapshot is a native-endian, versioned file that holds the state
+variables that a spin-up hands off to the simulation run and the number of
+simulated spin-up years together with the hash of inputs and spinup settings
+(which is used to validate the snapshot by SW_CTL_read_spinup_state()).
+
+A snapshot that cannot be written is removed and an error is issued
+(snapshots were requested, e.g., via command-line option `-S`).
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation (after SW_CTL_run_spinup())
+@param[in] hash Hash of inputs and spinup settings,
+    see SW_CTL_hash_spinup()
+@param[in] fname Name of the snapshot file
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_CTL_write_spinup_state(
+    SW_RUN *sw, uint64_t hash, const char *fname, LOG_INFO *LogInfo
+) {
+    SW_STATE_HEADER header;
+
+    stateHeader(&header, "SW2SPIN", spinupStateVersion, sw, hash);
+
+    if (!writeStateFile(fname, &header, spinupStateIO, sw, NULL)) {
+        LogError(
+            LogInfo, LOGERROR, "Failed to write spinup state '%s'.", fname
+        );
+    }
+}
+
+/**
+@brief Restore the state after a spin-up from a snapshot (if present)
+
+The state is restored only if the snapshot is complete and was created by
+SW_CTL_write_spinup_state() with the same format, the same number of soil
+layers, soil temperature nodes, and species, and the same hash of inputs and
+spinup settings; otherwise, `sw` is not modified.
+
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation (after SW_CTL_init_run())
+@param[in] hash Hash of inputs and spinup settings,
+    see SW_CTL_hash_spinup()
+@param[in] fname Name of the snapshot file
+@param[out] LogInfo Holds information on warnings and errors
+
+@return TRUE if the state was restored; FALSE if the snapshot is absent,
+    outdated, or incomplete (and the spin-up needs to be run)
+*/
+Bool SW_CTL_read_spinup_state(
+    SW_RUN *sw, uint64_t hash, const char *fname, LOG_INFO *LogInfo
+) {
+    SW_STATE_HEADER expected;
+
+    stateHeader(&expected, "SW2SPIN", spinupStateVersion, sw, hash);
+
+    return readStateFile(fname, &expected, spinupStateIO, sw, NULL, LogInfo);
+}
+
+/**
+@brief Hash of inputs and settings that determine a checkpoint
+
+The hash covers the inputs of all simulated years, spinup settings,
+simulation time, and output settings, i.e., everything that determines the
+state and the (partial) outputs of a simulation run at the end of a year.
+
+Call after SW_CTL_init_run() and before SW_CTL_run_spinup().
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+
+@return 64-bit FNV-1a hash
+*/
+uint64_t SW_CTL_hash_checkpoint(const SW_RUN *sw, const SW_OUT_DOM *OutDom) {
+    uint64_t hash = SW_HASH_INIT;
+    const SW_MODEL *m = &sw->Model;
+
+    sw_hash_bytes(&hash, &checkpointVersion, sizeof checkpointVersion);
+
+    sw_hash_bytes(&hash, &m->SW_SpinUp.spinup, sizeof m->SW_SpinUp.spinup);
+    hashSpinupSettings(&hash, sw);
+    hashInputs(&hash, sw, m->startyr, m->endyr);
+
+    sw_hash_bytes(&hash, &m->endyr, sizeof m->endyr);
+    sw_hash_bytes(&hash, &m->startstart, sizeof m->startstart);
+    sw_hash_bytes(&hash, &m->endend, sizeof m->endend);
+
+    // Output settings
+    sw_hash_bytes(&hash, OutDom->use, sizeof OutDom->use);
+    sw_hash_bytes(&hash, OutDom->sumtype, sizeof OutDom->sumtype);
+    sw_hash_bytes(&hash, OutDom->timeSteps, sizeof OutDom->timeSteps);
+    sw_hash_bytes(
+        &hash, &OutDom->used_OUTNPERIODS, sizeof OutDom->used_OUTNPERIODS
+    );
+#if defined(SW_OUTARRAY)
+    sw_hash_bytes(&hash, OutDom->ncol_OUT, sizeof OutDom->ncol_OUT);
+    sw_hash_bytes(&hash, OutDom->nrow_OUT, sizeof OutDom->nrow_OUT);
+#endif
+
+    return hash;
+}
+
+/**
+@brief Write a checkpoint of a simulation run
+
+The checkpoint is a native-endian, versioned file that holds the complete
+state of a simulation run at the end of the current year (see
+SW_CTL_read_checkpoint()); the file is replaced atomically, i.e., a previous
+checkpoint remains intact if writing is interrupted.
+
+A checkpoint that cannot be written is issued as a warning
+(simulation results are not affected).
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation; uses `sw->Checkpoint.fname` and
+  `sw->Checkpoint.hash`
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_CTL_write_checkpoint(
+    SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo
+) {
+    SW_STATE_HEADER header;
+    const char *fname = sw->Checkpoint.fname;
+
+    stateHeader(&header, "SW2CKPT", checkpointVersion, sw, sw->Checkpoint.hash);
+
+    if (!writeStateFile(fname, &header, checkpointIO, sw, OutDom)) {
+        LogError(LogInfo, LOGWARN, "Failed to write checkpoint '%s'.", fname);
+    }
+}
+
+/**
+@brief Restore a simulation run from a checkpoint (if present)
+
+The state is restored only if the checkpoint is complete and was created by
+SW_CTL_write_checkpoint() with the same format, the same number of soil
+layers, soil temperature nodes, and species, and the same hash of inputs and
+settings; otherwise, `sw` is not modified.
+If restored, SW_CTL_main() continues the simulation run with the year
+following the checkpoint (and a spin-up must not be run).
+
+@param[in,out] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation (after SW_CTL_init_run()); uses
+  `sw->Checkpoint.fname` and `sw->Checkpoint.hash`
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[out] LogInfo Holds information on warnings and errors
+
+@return TRUE if the simulation run was restored; FALSE if the checkpoint is
+    absent, outdated, or incomplete (and the run needs to start from the
+    beginning)
+*/
+Bool SW_CTL_read_checkpoint(
+    SW_RUN *sw, SW_OUT_DOM *OutDom, LOG_INFO *LogInfo
+) {
+    SW_STATE_HEADER expected;
+    Bool restored;
+
+    stateHeader(
+        &expected, "SW2CKPT", checkpointVersion, sw, sw->Checkpoint.hash
+    );
+
+    restored = readStateFile(
+        sw->Checkpoint.fname, &expected, checkpointIO, sw, OutDom, LogInfo
+    );
+
+    if (restored) {
+        sw->Checkpoint.nextYear = sw->Model.year + 1;
+    }
+
+    return restored;
+}
+
+/**
+@brief Heap memory allocated by a simulation run
+
+Sizes are the requested sizes of dynamically allocated memory
+(without overhead of the memory allocator).
+
+@param[in] sw Comprehensive struct of type SW_RUN containing all
+  information in the simulation
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[out] heap Size [bytes] of daily weather (element 0), output
+    accumulators and aggregators (1), vegetation establishment
+    parameters (2), weather generator parameters (3), and output arrays
+    held in memory (4)
+
+@return Total size [bytes] of heap memory
+*/
+size_t SW_CTL_sizeof_heap(
+    const SW_RUN *sw, const SW_OUT_DOM *OutDom, size_t heap[]
+) {
+    size_t nSpecies = sw->VegEstab.count;
+    OutPeriod pd;
+
+#if defined(SW_OUTARRAY)
+    int k;
+    IntUS i;
+    size_t size;
+#else
+    (void) OutDom;
+#endif
+
+    heap[0] = isnull(sw->Weather.allHist) ?
+                  0 :
+                  sw->Weather.n_years * sizeof(SW_WEATHER_HIST);
+
+    heap[1] = 0;
+    ForEachOutPeriod(pd) {
+        if (!isnull(sw->SoilWat.p_accu[pd])) {
+            heap[1] += (pd > eSW_Day ? 2 : 1) * sizeof(SW_SOILWAT_OUTPUTS);
+        }
+        if (!isnull(sw->Weather.p_accu[pd])) {
+            heap[1] += (pd > eSW_Day ? 2 : 1) * sizeof(SW_WEATHER_OUTPUTS);
+        }
+        if (!isnull(sw->VegProd.p_accu[pd])) {
+            heap[1] += (pd > eSW_Day ? 2 : 1) * sizeof(SW_VEGPROD_OUTPUTS);
+        }
+        if (!isnull(sw->VegEstab.p_accu[pd])) {
+            heap[1] += 2 * (sizeof(SW_VEGESTAB_OUTPUTS) +
+                            nSpecies * sizeof(TimeInt));
+        }
+    }
+
+    heap[2] = nSpecies *
+              (sizeof(SW_VEGESTAB_INFO) + sizeof(SW_VEGESTAB_INFO *));
+
+    // wetprob, dryprob, avg_ppt, std_ppt, cfxw, cfxd, cfnw, and cfnd
+    heap[3] = isnull(sw->Markov.wetprob) ? 0 : 8 * MAX_DAYS * sizeof(double);
+
+    heap[4] = 0;
+#if defined(SW_OUTARRAY)
+    ForEachOutKey(k) {
+        for (i = 0; i < OutDom->used_OUTNPERIODS; i++) {
+            pd = OutDom->timeSteps[k][i];
+
+            if (OutDom->use[k] && pd != eSW_NoTime) {
+                size = OutDom->nrow_OUT[pd] *
+                       (OutDom->ncol_OUT[k] + ncol_TimeOUT[pd]);
+#if defined(STEPWAT)
+                size *= 2; // p_OUT and p_OUTsd
+#endif
+                heap[4] += size * sizeof(double);
+            }
+        }
+    }
+#endif
+
+    return heap[0] + heap[1] + heap[2] + heap[3] + heap[4];
+}
+
+/**
+@brief Print the memory footprint of a simulation run and of the domain
+
+The report lists the size of each component of SW_RUN and SW_DOMAIN,
+the heap memory that each simulation run allocates, and the compile-time
+limits that determine the size of fixed-size arrays
+(see build profile `SW2_PROFILE=slim` of the makefile).
+
+@param[in] sw_template Template SW_RUN (after inputs and output were set up)
+@param[in] SW_Domain Struct of type SW_DOMAIN holding constant
+    temporal/spatial information for a set of simulation runs
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_CTL_print_memory(
+    SW_RUN *sw_template, SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo
+) {
+    SW_RUN sw;
+    size_t heap[5];
+    size_t heapTotal;
+    long peakMemory;
+
+    // Heap of a simulation run as allocated by SW_CTL_run_sw()
+    SW_RUN_deepCopy(sw_template, &sw, &SW_Domain->OutDom, swTRUE, LogInfo);
+    if (LogInfo->stopRun) {
+        SW_CTL_clear_model(swTRUE, &sw);
+        return; // Exit function prematurely due to error
+    }
+    heapTotal = SW_CTL_sizeof_heap(&sw, &SW_Domain->OutDom, heap);
+    SW_CTL_clear_model(swTRUE, &sw);
+
+    sw_printf(
+        "Memory footprint [bytes]\n"
+        "  Compile-time limits: MAX_LAYERS = %d, MAX_ST_RGR = %d, "
+        "MAX_NYEAR = %d\n",
+        MAX_LAYERS,
+        MAX_ST_RGR,
+        MAX_NYEAR
+    );
+
+    sw_printf("  SW_RUN (per simulation unit)\n");
+    printMemoryLine("VegProd", sizeof sw.VegProd);
+    printMemoryLine("Weather", sizeof sw.Weather);
+    printMemoryLine("SoilWat", sizeof sw.SoilWat);
+    printMemoryLine("Model", sizeof sw.Model);
+    printMemoryLine("Site", sizeof sw.Site);
+    printMemoryLine("VegEstab", sizeof sw.VegEstab);
+    printMemoryLine("Sky", sizeof sw.Sky);
+    printMemoryLine("Carbon", sizeof sw.Carbon);
+    printMemoryLine("StRegValues", sizeof sw.StRegValues);
+    printMemoryLine("SW_PathOutputs", sizeof sw.SW_PathOutputs);
+    printMemoryLine("Markov", sizeof sw.Markov);
+    printMemoryLine("OutRun", sizeof sw.OutRun);
+    printMemoryLine("AtmDemand", sizeof sw.AtmDemand);
+    printMemoryLine("total", sizeof sw);
+
+    sw_printf("  Heap of SW_RUN (per simulation unit)\n");
+    printMemoryLine("daily weather", heap[0]);
+    printMemoryLine("output accumulators", heap[1]);
+    printMemoryLine("vegetation establishment", heap[2]);
+    printMemoryLine("weather generator", heap[3]);
+    printMemoryLine("output arrays", heap[4]);
+    printMemoryLine("total", heapTotal);
+
+    sw_printf("  SW_DOMAIN\n");
+    printMemoryLine("SW_PathInputs", sizeof SW_Domain->SW_PathInputs);
+#if defined(SWNETCDF)
+    printMemoryLine("netCDFInput", sizeof SW_Domain->netCDFInput);
+#endif
+    printMemoryLine("OutDom", sizeof SW_Domain->OutDom);
+    printMemoryLine("total", sizeof *SW_Domain);
+    printMemoryLine(
+        "heap: solar geometry (max)",
+        SW_ATMD_CACHE_MAXN * (sizeof(SW_ATMD) + 3 * sizeof(double))
+    );
+
+    sw_printf("  Per simulation unit (SW_RUN and its heap)\n");
+    printMemoryLine("total", sizeof sw + heapTotal);
+
+    peakMemory = Mem_PeakUsage();
+    if (peakMemory >= 0) {
+        sw_printf(
+            "  Peak memory usage of the process: %ld [kilobytes]\n",
+            peakMemory
+        );
+    }
+}
+
 /**
 @brief Reads inputs from disk and makes a print statement if there is an error
         in doing so.
@@ -1128,12 +2685,20 @@ on error but end early and report to caller
     temporal/spatial information for a set of simulation runs
 @param[in] ncSuid Unique indentifier of the first suid to run
     in relation to netCDF gridcells/sites
+@param[in,out] PhaseTimes Accumulator to which wall time of phases of this
+    run is added (if compiled with `SWPROFILE`); NULL if phases are not timed.
+    Concurrent runs require separate accumulators.
+@param[out] SuidDiag Diagnostics of this run (number of soil layers,
+    generated weather days, soil temperature failure, spinup years, and
+    memory held by the run); NULL if not needed
 @param[out] LogInfo Holds information on warnings and errors
 */
 void SW_CTL_run_sw(
     SW_RUN *sw_template,
     SW_DOMAIN *SW_Domain,
     unsigned long ncSuid[], // NOLINT(readability-non-const-parameter)
+    SW_PHASETIMES *PhaseTimes,
+    SW_SUIDDIAG *SuidDiag,
     LOG_INFO *LogInfo
 ) {
 
@@ -1144,6 +2709,11 @@ void SW_CTL_run_sw(
     SW_RUN local_sw;
     Bool copyWeather = swTRUE;
     Bool estVeg = swTRUE;
+    size_t heap[5];
+#if defined(SOILWAT)
+    unsigned long suid;
+    char checkpointName[FILENAME_MAX];
+#endif
 
 #if defined(SWNETCDF)
     copyWeather = (Bool) !SW_Domain->netCDFInput.readInVars[eSW_InWeather][0];
@@ -1157,19 +2727,45 @@ void SW_CTL_run_sw(
 #endif
 
     // Copy template SW_RUN to local instance
+    SW_PHASE_START(PhaseTimes, eSW_PhDeepCopy);
     SW_RUN_deepCopy(
         sw_template, &local_sw, &SW_Domain->OutDom, copyWeather, LogInfo
     );
+    local_sw.PhaseTimes = PhaseTimes;
     if (LogInfo->stopRun) {
         goto freeMem; // Free memory and skip simulation run
     }
 
+#if defined(SOILWAT)
+    // Random number streams specific to suid: reproducible independent of
+    // the order in which suids are simulated
+    suid = SW_DOM_calc_suid(SW_Domain, ncSuid);
+
+    RandSeedStream(
+        local_sw.Weather.rng_seed,
+        suid,
+        SW_RNG_STREAM_MARKOV,
+        0,
+        &local_sw.Markov.markov_rng
+    );
+    RandSeedStream(
+        SW_Domain->SW_SpinUp.rng_seed,
+        suid,
+        SW_RNG_STREAM_SPINUP,
+        0,
+        &local_sw.Model.SW_SpinUp.spinup_rng
+    );
+#endif
+    SW_PHASE_STOP(PhaseTimes, eSW_PhDeepCopy);
+
 #if defined(SWNETCDF)
     // Obtain suid-specific inputs
+    SW_PHASE_START(PhaseTimes, eSW_PhInputsNC);
     SW_NCIN_read_inputs(&local_sw, SW_Domain, ncSuid, LogInfo);
     if (LogInfo->stopRun) {
         goto freeMem;
     }
+    SW_PHASE_STOP(PhaseTimes, eSW_PhInputsNC);
 #endif
 
 #ifdef SWDEBUG
@@ -1183,22 +2779,64 @@ void SW_CTL_run_sw(
 #endif
 
     // Initialize run-time variables
+    SW_PHASE_START(PhaseTimes, eSW_PhInitRun);
+    local_sw.VegProd.climateCacheDir = SW_Domain->SW_PathInputs.climateCacheDir;
     SW_CTL_init_run(&local_sw, estVeg, LogInfo);
     if (LogInfo->stopRun) {
         goto freeMem; // Exit function prematurely due to error
     }
 
-    // Run spinup for suid
-    if (SW_Domain->SW_SpinUp.spinup) {
+    // Share solar geometry with other suids at same latitude, slope, aspect
+    local_sw.AtmDemandDom = SW_PET_cache_get(
+        &SW_Domain->AtmDemCache,
+        local_sw.Model.latitude,
+        local_sw.Model.slope,
+        local_sw.Model.aspect,
+        LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto freeMem; // Exit function prematurely due to error
+    }
+
+#if defined(SOILWAT)
+    if (SW_Domain->checkpointYears > 0) {
+        // Resume from checkpoint of an interrupted run (if inputs unchanged)
+        setup_checkpoint(&local_sw, SW_Domain, suid, checkpointName, LogInfo);
+        if (LogInfo->stopRun) {
+            goto freeMem; // Exit function prematurely due to error
+        }
+    }
+#endif
+    SW_PHASE_STOP(PhaseTimes, eSW_PhInitRun);
+
+    // Run spinup for suid (unless resumed from a checkpoint)
+    if (SW_Domain->SW_SpinUp.spinup && local_sw.Checkpoint.nextYear == 0) {
 #ifdef SWDEBUG
         if (debug) {
             sw_printf(" -- spinup");
         }
 #endif
+        SW_PHASE_START(PhaseTimes, eSW_PhSpinup);
+#if defined(SOILWAT)
+        if (!isnull(SW_Domain->SW_PathInputs.spinupStateDir)) {
+            // Reuse state after spinup from snapshot (if inputs unchanged)
+            run_spinup_warmstart(
+                &local_sw,
+                &SW_Domain->OutDom,
+                SW_Domain->SW_PathInputs.spinupStateDir,
+                suid,
+                LogInfo
+            );
+        } else {
+            SW_CTL_run_spinup(&local_sw, &SW_Domain->OutDom, LogInfo);
+        }
+#else
         SW_CTL_run_spinup(&local_sw, &SW_Domain->OutDom, LogInfo);
+#endif
         if (LogInfo->stopRun) {
             goto freeMem; // Exit function prematurely due to error
         }
+        SW_PHASE_STOP(PhaseTimes, eSW_PhSpinup);
     }
 
     // Run simulation for suid
@@ -1207,10 +2845,19 @@ void SW_CTL_run_sw(
         sw_printf(" -- run");
     }
 #endif
+#if defined(SWNETCDF)
+    // Streaming output writes to output netCDFs during the simulation run
+    local_sw.OutRun.ncSuid[0] = ncSuid[0];
+    local_sw.OutRun.ncSuid[1] = ncSuid[1];
+    local_sw.OutRun.domType = SW_Domain->DomainType;
+#endif
+
+    SW_PHASE_START(PhaseTimes, eSW_PhSimulation);
     SW_CTL_main(&local_sw, &SW_Domain->OutDom, LogInfo);
     if (LogInfo->stopRun) {
         goto freeMem; // Free memory and exit function prematurely due to error
     }
+    SW_PHASE_STOP(PhaseTimes, eSW_PhSimulation);
 
 #if defined(SWNETCDF)
 #ifdef SWDEBUG
@@ -1218,17 +2865,39 @@ void SW_CTL_run_sw(
         sw_printf(" -- nc-output");
     }
 #endif
-    SW_NCOUT_write_output(
-        &SW_Domain->OutDom,
-        local_sw.OutRun.p_OUT,
-        local_sw.SW_PathOutputs.numOutFiles,
-        local_sw.SW_PathOutputs.ncOutFiles,
-        ncSuid,
-        SW_Domain->DomainType,
-        LogInfo
-    );
+    SW_PHASE_START(PhaseTimes, eSW_PhOutputsNC);
+    if (SW_Domain->OutDom.netCDFOutput.streamOutYears > 0) {
+        // Write remaining time steps of streaming output
+        SW_NCOUT_stream_output(
+            &SW_Domain->OutDom,
+            &local_sw.OutRun,
+            &local_sw.SW_PathOutputs,
+            swTRUE,
+            LogInfo
+        );
+    } else {
+        SW_NCOUT_write_output(
+            &SW_Domain->OutDom,
+            local_sw.OutRun.p_OUT,
+            local_sw.SW_PathOutputs.numOutFiles,
+            local_sw.SW_PathOutputs.ncOutFiles,
+            ncSuid,
+            SW_Domain->DomainType,
+            SW_Domain->OutDom.nrow_OUT,
+            local_sw.OutRun.irowOffset_OUT,
+            local_sw.OutRun.ncFileOffset_OUT,
+            local_sw.OutRun.ncTimeOffset_OUT,
+            LogInfo
+        );
+    }
+    SW_PHASE_STOP(PhaseTimes, eSW_PhOutputsNC);
 #endif
 
+    if (!isnull(local_sw.Checkpoint.fname) && !LogInfo->stopRun) {
+        // Simulation run is complete
+        (void) remove(local_sw.Checkpoint.fname);
+    }
+
 // Clear local instance of SW_RUN
 freeMem:
 #ifdef SWDEBUG
@@ -1236,7 +2905,20 @@ freeMem:
         sw_printf(" -- end.\n");
     }
 #endif
+    if (!isnull(SuidDiag)) {
+        SuidDiag->nLayers = local_sw.Site.n_layers;
+        SuidDiag->nGeneratedDays = local_sw.Markov.n_genDays;
+        SuidDiag->soilTempError = local_sw.SoilWat.soiltempError;
+        SuidDiag->nSpinupYears = local_sw.Model.SW_SpinUp.nYearsUsed;
+        SuidDiag->runMemory =
+            (long) ((sizeof(SW_RUN) +
+                     SW_CTL_sizeof_heap(&local_sw, &SW_Domain->OutDom, heap)) /
+                    1024);
+    }
+
+    SW_PHASE_START(PhaseTimes, eSW_PhFreeMem);
     SW_CTL_clear_model(swTRUE, &local_sw);
+    SW_PHASE_STOP(PhaseTimes, eSW_PhFreeMem);
 
     (void) SW_Domain;
     (void) ncSuid;
@@ -9,6 +9,7 @@
 #include "include/SW_datastructs.h" // for SW_DOMAIN, LOG_INFO
 #include "include/SW_Defines.h"     // for LyrIndex, LARGE_VALUE, TimeInt
 #include "include/SW_Files.h"       // for SW_F_deconstruct, SW_F_deepCopy
+#include "include/SW_Flow_lib_PET.h" // for SW_PET_init_cache, SW_PET_deco...
 #include "include/SW_Output.h"      // for ForEachOutKey
 #include "include/Times.h"          // for yearto4digit, Time_get_lastdoy_y
 #include <stdio.h>                  // for sscanf, FILE
@@ -30,7 +31,7 @@
 /*                   Local Defines                     */
 /* --------------------------------------------------- */
 
-#define NUM_DOM_IN_KEYS 18 // Number of possible keys within `domain.in`
+#define NUM_DOM_IN_KEYS 20 // Number of possible keys within `domain.in`
 
 /* =================================================== */
 /*             Private Function Declarations           */
@@ -62,6 +63,24 @@ void SW_DOM_calc_ncSuid(
     }
 }
 
+/**
+@brief Calculate the suid from its netCDF position (inverse of
+    `SW_DOM_calc_ncSuid()`)
+
+@param[in] SW_Domain Struct of type SW_DOMAIN holding constant
+    temporal/spatial information for a set of simulation runs
+@param[in] ncSuid Unique indentifier of a simulation run
+    in relation to netCDFs
+
+@return Unique identifier of the simulation run
+*/
+unsigned long SW_DOM_calc_suid(SW_DOMAIN *SW_Domain, unsigned long ncSuid[]) {
+
+    return (strcmp(SW_Domain->DomainType, "s") == 0) ?
+               ncSuid[0] :
+               ncSuid[0] * SW_Domain->nDimX + ncSuid[1];
+}
+
 /**
 @brief Calculate the number of suids in the given domain
 
@@ -143,6 +162,11 @@ void SW_DOM_construct(unsigned long rng_seed, SW_DOMAIN *SW_Domain) {
     (void) rng_seed; // Silence compiler flag `-Wunused-parameter`
 #endif
 
+    // Adaptive spinup is turned off unless tolerances are provided
+    SW_Domain->SW_SpinUp.tolSWC = 0.;
+    SW_Domain->SW_SpinUp.tolTsoil = 0.;
+    SW_Domain->SW_SpinUp.nYearsUsed = 0;
+
     SW_Domain->nMaxSoilLayers = 0;
     SW_Domain->nMaxEvapLayers = 0;
     SW_Domain->hasConsistentSoilLayerDepths = swFALSE;
@@ -182,7 +206,9 @@ void SW_DOM_read(SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo) {
         "SpinupScope",
         "SpinupDuration",
         "SpinupSeed",
-        "SpatialTolerance"
+        "SpatialTolerance",
+        "SpinupTolSWC",
+        "SpinupTolTsoil"
     };
     static const Bool requiredKeys[NUM_DOM_IN_KEYS] = {
         swTRUE,
@@ -202,7 +228,9 @@ void SW_DOM_read(SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo) {
         swTRUE,
         swTRUE,
         swTRUE,
-        swTRUE
+        swTRUE,
+        swFALSE,
+        swFALSE
     };
     Bool hasKeys[NUM_DOM_IN_KEYS] = {swFALSE};
 
@@ -244,11 +272,11 @@ void SW_DOM_read(SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo) {
 
         /* Make sure we are not trying to convert a string with no numerical
          * value */
-        if (keyID > 0 && keyID <= 17 && keyID != 8) {
+        if (keyID > 0 && keyID <= 19 && keyID != 8) {
 
             /* Check to see if the line number contains a double or integer
              * value */
-            doDoubleConv = (Bool) ((keyID >= 9 && keyID <= 12) || keyID == 17);
+            doDoubleConv = (Bool) ((keyID >= 9 && keyID <= 12) || keyID >= 17);
 
             if (doDoubleConv) {
                 doubleRes = sw_strtod(value, MyFileName, LogInfo);
@@ -404,6 +432,25 @@ void SW_DOM_read(SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo) {
                 LogError(LogInfo, LOGERROR, "Spatial tolerance must be >= 0.");
             }
             break;
+        case 18: // Adaptive spinup: tolerance of soil moisture
+        case 19: // Adaptive spinup: tolerance of soil temperature
+            if (LT(doubleRes, 0.0)) {
+                LogError(
+                    LogInfo,
+                    LOGERROR,
+                    "%s: Spinup tolerance (%s) must be >= 0.",
+                    MyFileName,
+                    key
+                );
+                goto closeFile;
+            }
+
+            if (keyID == 18) {
+                SW_Domain->SW_SpinUp.tolSWC = doubleRes;
+            } else {
+                SW_Domain->SW_SpinUp.tolTsoil = doubleRes;
+            }
+            break;
 
         case KEY_NOT_FOUND: // Unknown key
 
@@ -433,6 +480,19 @@ void SW_DOM_read(SW_DOMAIN *SW_Domain, LOG_INFO *LogInfo) {
         goto closeFile;
     }
 
+    if (SW_Domain->endyr >= MAX_NYEAR) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "%s: End Year (%u) is beyond the largest supported year (%d); "
+            "see MAX_NYEAR.",
+            MyFileName,
+            SW_Domain->endyr,
+            MAX_NYEAR - 1
+        );
+        goto closeFile;
+    }
+
     // Check if start day of year was not found
     keyID = key_to_id("StartDoy", possibleKeys, NUM_DOM_IN_KEYS);
     if (!hasKeys[keyID]) {
@@ -582,6 +642,9 @@ void SW_DOM_deepCopy(SW_DOMAIN *source, SW_DOMAIN *dest, LOG_INFO *LogInfo) {
 
     memcpy(dest, source, sizeof(*dest));
 
+    // Solar geometry cache is not copied but filled again when needed
+    SW_PET_init_cache(&dest->AtmDemCache);
+
     SW_OUTDOM_deepCopy(&source->OutDom, &dest->OutDom, LogInfo);
 
     SW_F_deepCopy(&source->SW_PathInputs, &dest->SW_PathInputs, LogInfo);
@@ -605,8 +668,12 @@ void SW_DOM_deepCopy(SW_DOMAIN *source, SW_DOMAIN *dest, LOG_INFO *LogInfo) {
 
 void SW_DOM_init_ptrs(SW_DOMAIN *SW_Domain) {
 
+    SW_Domain->checkpointYears = 0; // set by command-line option '-C'
+
     SW_OUTDOM_init_ptrs(&SW_Domain->OutDom);
 
+    SW_PET_init_cache(&SW_Domain->AtmDemCache);
+
     SW_F_init_ptrs(&SW_Domain->SW_PathInputs);
 
 #if defined(SWNETCDF)
@@ -620,6 +687,8 @@ void SW_DOM_deconstruct(SW_DOMAIN *SW_Domain) {
 
     SW_F_deconstruct(&SW_Domain->SW_PathInputs);
 
+    SW_PET_deconstruct_cache(&SW_Domain->AtmDemCache);
+
 #if defined(SWNETCDF)
 
     SW_NC_deconstruct(&SW_Domain->OutDom.netCDFOutput);
@@ -631,7 +700,7 @@ void SW_DOM_deconstruct(SW_DOMAIN *SW_Domain) {
     SW_NCIN_deconstruct(&SW_Domain->netCDFInput);
 #endif
     ForEachOutKey(k) {
-        for (i = 0; i < 5 * NVEGTYPES + MAX_LAYERS; i++) {
+        for (i = 0; i < SW_OUTNMAXCOLS; i++) {
             if (!isnull(SW_Domain->OutDom.colnames_OUT[k][i])) {
                 free(SW_Domain->OutDom.colnames_OUT[k][i]);
                 SW_Domain->OutDom.colnames_OUT[k][i] = NULL;
@@ -228,6 +228,20 @@ void SW_F_deepCopy(
         }
     }
 
+    if (!isnull(source->spinupStateDir)) {
+        dest->spinupStateDir = Str_Dup(source->spinupStateDir, LogInfo);
+        if (LogInfo->stopRun) {
+            return; // Exit prematurely due to error
+        }
+    }
+
+    if (!isnull(source->climateCacheDir)) {
+        dest->climateCacheDir = Str_Dup(source->climateCacheDir, LogInfo);
+        if (LogInfo->stopRun) {
+            return; // Exit prematurely due to error
+        }
+    }
+
 #if defined(SWNETCDF)
     int k;
     int varNum;
@@ -315,6 +329,9 @@ void SW_F_init_ptrs(SW_PATH_INPUTS *SW_PathInputs) {
         SW_PathInputs->txtInFiles[file] = NULL;
     }
 
+    SW_PathInputs->spinupStateDir = NULL;
+    SW_PathInputs->climateCacheDir = NULL;
+
 #if defined(SWNETCDF)
     int k;
 
@@ -425,6 +442,16 @@ void SW_F_deconstruct(SW_PATH_INPUTS *SW_PathInputs) {
         }
     }
 
+    if (!isnull(SW_PathInputs->spinupStateDir)) {
+        free(SW_PathInputs->spinupStateDir);
+        SW_PathInputs->spinupStateDir = NULL;
+    }
+
+    if (!isnull(SW_PathInputs->climateCacheDir)) {
+        free(SW_PathInputs->climateCacheDir);
+        SW_PathInputs->climateCacheDir = NULL;
+    }
+
 #if defined(SWNETCDF)
 
     unsigned int numFiles = SW_PathInputs->ncNumWeatherInFiles;
@@ -212,6 +212,7 @@
 #include "include/SW_SoilWater.h"    // for SW_SWC_snowloss, SW_SnowDepth
 #include "include/SW_Times.h"        // for Today, Yesterday
 #include "include/SW_VegProd.h"      // for WUE_INDEX
+#include "include/Times.h"           // for SW_PHASE_START, SW_PHASE_STOP
 
 /* =================================================== */
 /*             Global Function Definitions             */
@@ -346,7 +347,7 @@ void SW_Water_Flow(SW_RUN *sw, LOG_INFO *LogInfo) {
     }
 
     sw->SoilWat.H_gt = solar_radiation(
-        &sw->AtmDemand,
+        isnull(sw->AtmDemandDom) ? &sw->AtmDemand : sw->AtmDemandDom,
         doy,
         sw->Model.latitude,
         sw->Model.elevation,
@@ -959,6 +960,7 @@ void SW_Water_Flow(SW_RUN *sw, LOG_INFO *LogInfo) {
     // for the calculation, so therefore the temperature is the last calculation
     // done
     if (sw->Site.use_soil_temp) {
+        SW_PHASE_START(sw->PhaseTimes, eSW_PhSoilTemp);
         soil_temperature(
             &sw->StRegValues,
             &sw->Weather.surfaceMin,
@@ -1003,6 +1005,7 @@ void SW_Water_Flow(SW_RUN *sw, LOG_INFO *LogInfo) {
         if (LogInfo->stopRun) {
             return; // Exit function prematurely due to error
         }
+        SW_PHASE_STOP(sw->PhaseTimes, eSW_PhSoilTemp);
     }
 
 /* Soil Temperature ends here */
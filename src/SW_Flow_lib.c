@@ -1252,11 +1252,17 @@ void hydraulic_redistribution(
     unsigned int idre;
     unsigned int nit;
     Bool is_hd_adj;
-    double swa[MAX_LAYERS] = {0};
-    double swp[MAX_LAYERS] = {0};
-    double relCondroot[MAX_LAYERS] = {0};
+    /* Only the first `nlyrs` elements (and the upper-left `nlyrs` x `nlyrs`
+       block of `hydredmat`) are used; each is set before it is read */
+    Bool isWet[MAX_LAYERS];
+    Bool isThawed[MAX_LAYERS];
+    double swa[MAX_LAYERS];
+    double swp[MAX_LAYERS];
+    double relCondroot[MAX_LAYERS];
+    double rootCo[MAX_LAYERS];
     double mlyrRootCo[2] = {0.};
-    double hydredmat[MAX_LAYERS][MAX_LAYERS] = {{0}};
+    double hydredmat[MAX_LAYERS][MAX_LAYERS];
+    double condNight;
     double hdnet;
     double hdin;
     double hdout;
@@ -1268,7 +1274,10 @@ void hydraulic_redistribution(
     }
 #endif
 
-    /* Pre-calculate variables */
+    /* Pre-calculate per-layer variables
+       (`swc` changes after each vegetation type, i.e., these cannot be shared
+       among calls)
+    */
     for (i = 0; i < nlyrs; i++) {
         /* Set water extraction limit to moisture above SWPcrit by vegetation
                 (unless wilting point is lower)
@@ -1290,98 +1299,111 @@ void hydraulic_redistribution(
         relCondroot[i] =
             fmin(1., fmax(0., 1. / (1. + powe(swp[i] / swp50, shapeCond))));
 
+        /* Wet: more moisture than at wilting point */
+        isWet[i] = (Bool) GT(swc[i], SW_Site->swcBulk_wiltpt[i]);
+        isThawed[i] = (lyrFrozen[i] == swFALSE) ? swTRUE : swFALSE;
+        rootCo[i] = SW_Site->soils.transp_coeff[vegk][i];
+
         hydredmat[0][i] = hydredmat[i][0] = 0.; /* no hydred in top layer */
         hydredmat[i][i] = 0.; /* no hydred within same layer */
     }
 
+    /* Ryel et al. 2002: eq. 6 (first factors)
+       Convert hourly to daily: assume a fixed day with a 10-hour night */
+    condNight = 10. / 24. * maxCondroot;
+
     /* Calculate hydraulic redistribution according to Ryel et al. 2002:
             layer i receives moisture moved from layer j: `hydredmat[i][j] > 0`
             layer i loses moisture to layer j: `hydredmat[i][j] < 0`
             net moisture change in layer i: `sum across j of hydredmat[i][j]`
                     which equals `sum across j of -hydredmat[j][i]`
+       Flows are antisymmetric, i.e., only the upper half (i < j) is
+       calculated and mirrored.
     */
 
     for (i = 1; i < nlyrs; i++) {
 
-        for (j = i + 1; j < nlyrs; j++) {
+        if (!isThawed[i]) {
+            /* no hydred from or to a frozen soil layer */
+            for (j = i + 1; j < nlyrs; j++) {
+                hydredmat[i][j] = hydredmat[j][i] = 0.;
+            }
 
-            /* hydred only occurs if at least one soil layer is wet
-                    (more moisture than at wilting point)
-                    and both soil layers are not frozen
-            */
-            if ((GT(swc[i], SW_Site->swcBulk_wiltpt[i]) ||
-                 GT(swc[j], SW_Site->swcBulk_wiltpt[j])) &&
-                (lyrFrozen[i] == swFALSE) && (lyrFrozen[j] == swFALSE)) {
+        } else {
+            for (j = i + 1; j < nlyrs; j++) {
 
-                /* Identify source layer: from which water is removed */
-                idso = LT(swp[i], swp[j]) ? i : j;
-                /* Identify recipient layer: to which water is moved */
-                idre = (idso == i) ? j : i;
+                /* hydred only occurs if at least one soil layer is wet
+                        and both soil layers are not frozen
+                */
+                if ((isWet[i] || isWet[j]) && isThawed[j]) {
 
+                    /* Identify source layer: from which water is removed */
+                    idso = LT(swp[i], swp[j]) ? i : j;
+                    /* Identify recipient layer: to which water is moved */
+                    idre = (idso == i) ? j : i;
 
-                /* Correct rooting contributions for different layer widths
-                        -> truncate to source layer width
-                        (original equation assumed identical layer widths)
-                */
-                mlyrRootCo[0] = SW_Site->soils.transp_coeff[vegk][idso];
-                mlyrRootCo[1] = SW_Site->soils.transp_coeff[vegk][idre];
 
-                if (LT(SW_Site->soils.width[idso],
-                       SW_Site->soils.width[idre])) {
-                    mlyrRootCo[1] *=
-                        SW_Site->soils.width[idso] / SW_Site->soils.width[idre];
-                }
+                    /* Correct rooting contributions for different layer
+                       widths
+                            -> truncate to source layer width
+                            (original equation assumed identical layer widths)
+                    */
+                    mlyrRootCo[0] = rootCo[idso];
+                    mlyrRootCo[1] = rootCo[idre];
+
+                    if (LT(SW_Site->soils.width[idso],
+                           SW_Site->soils.width[idre])) {
+                        mlyrRootCo[1] *= SW_Site->soils.width[idso] /
+                                         SW_Site->soils.width[idre];
+                    }
 
 
-                /* Ryel et al. 2002: eq. 6 */
-                /* Convert hourly to daily: assume a fixed day with a 10-hour
-                 * night */
-                tmp = 10. / 24. * maxCondroot * (swp[j] - swp[i]) *
-                      fmax(relCondroot[i], relCondroot[j]) * mlyrRootCo[0] *
-                      mlyrRootCo[1] / (1. - mlyrRootCo[0]);
+                    /* Ryel et al. 2002: eq. 6 */
+                    tmp = condNight * (swp[j] - swp[i]) *
+                          fmax(relCondroot[i], relCondroot[j]) *
+                          mlyrRootCo[0] * mlyrRootCo[1] / (1. - mlyrRootCo[0]);
 
-                /* limit hydred to moisture above swc_min */
-                tmp = copysign(fmin(fabs(tmp), swa[idso]), tmp);
+                    /* limit hydred to moisture above swc_min */
+                    tmp = copysign(fmin(fabs(tmp), swa[idso]), tmp);
 
 #ifdef SWDEBUG
-                if (debug) {
-                    sw_printf(
-                        "hd[sl=%d,%d|so=%d,re=%d]=%+.6f cm: "
-                        "so|re: w=%4.1f|%4.1f cm, "
-                        "swc=%.4f|%.4f cm, "
-                        "swp=%7.3f|%7.3f MPa, "
-                        "c=%.4f|%.4f, "
-                        "R=%.4f|%.4f"
-                        "\n",
-                        i,
-                        j,
-                        idso,
-                        idre,
-                        tmp,
-                        SW_Site->soils.width[idso],
-                        SW_Site->soils.width[idre],
-                        swc[idso],
-                        swc[idre],
-                        -0.1 * swp[idso],
-                        -0.1 * swp[idre],
-                        relCondroot[idso],
-                        relCondroot[idre],
-                        mlyrRootCo[0],
-                        mlyrRootCo[1]
-                    );
-                }
+                    if (debug) {
+                        sw_printf(
+                            "hd[sl=%d,%d|so=%d,re=%d]=%+.6f cm: "
+                            "so|re: w=%4.1f|%4.1f cm, "
+                            "swc=%.4f|%.4f cm, "
+                            "swp=%7.3f|%7.3f MPa, "
+                            "c=%.4f|%.4f, "
+                            "R=%.4f|%.4f"
+                            "\n",
+                            i,
+                            j,
+                            idso,
+                            idre,
+                            tmp,
+                            SW_Site->soils.width[idso],
+                            SW_Site->soils.width[idre],
+                            swc[idso],
+                            swc[idre],
+                            -0.1 * swp[idso],
+                            -0.1 * swp[idre],
+                            relCondroot[idso],
+                            relCondroot[idre],
+                            mlyrRootCo[0],
+                            mlyrRootCo[1]
+                        );
+                    }
 #endif
 
-                hydredmat[i][j] = tmp;
-                hydredmat[j][i] = -tmp;
+                    hydredmat[i][j] = tmp;
+                    hydredmat[j][i] = -tmp;
 
-            } else {
-                hydredmat[i][j] = hydredmat[j][i] = 0.;
+                } else {
+                    hydredmat[i][j] = hydredmat[j][i] = 0.;
+                }
             }
         }
     }
-
-
     /* Restrict net hydred so that it does not remove moisture below swc_min */
     nit = 0;
     is_hd_adj = swTRUE;
@@ -16,9 +16,11 @@
 #include "include/SW_Flow_lib_PET.h" // for SW_PET_init_run, actualVaporPre...
 #include "include/filefuncs.h"       // for LogError
 #include "include/generic.h"         // for squared, fmax, fmin, GT, Bool
+#include "include/myMemory.h"        // for Mem_Malloc
 #include "include/SW_datastructs.h"  // for SW_ATMD, LOG_INFO
 #include "include/SW_Defines.h"      // for missing, swPI, SW_MISSING, swPI2
 #include <math.h>                    // for tan, pow, sin, cos, exp, fabs
+#include <stdlib.h>                  // for free
 
 
 /* =================================================== */
@@ -67,6 +69,152 @@ void SW_PET_init_run(SW_ATMD *SW_AtmDem) {
     }
 }
 
+/**
+@brief Initialize the domain-wide cache of solar geometry
+
+@param[out] AtmDemCache Domain-wide cache of memoized solar geometry
+*/
+void SW_PET_init_cache(SW_ATMD_CACHE *AtmDemCache) {
+    AtmDemCache->keys = NULL;
+    AtmDemCache->AtmDem = NULL;
+    AtmDemCache->nEntries = 0;
+}
+
+/**
+@brief Free memory of the domain-wide cache of solar geometry
+
+@param[in,out] AtmDemCache Domain-wide cache of memoized solar geometry
+*/
+void SW_PET_deconstruct_cache(SW_ATMD_CACHE *AtmDemCache) {
+    unsigned int i;
+
+    if (!isnull(AtmDemCache->AtmDem)) {
+        for (i = 0; i < AtmDemCache->nEntries; i++) {
+            free(AtmDemCache->AtmDem[i]);
+        }
+        free((void *) AtmDemCache->AtmDem);
+    }
+
+    if (!isnull(AtmDemCache->keys)) {
+        free((void *) AtmDemCache->keys);
+    }
+
+    SW_PET_init_cache(AtmDemCache);
+}
+
+/**
+@brief Obtain memoized solar geometry from the domain-wide cache
+
+Solar geometry (see `sun_hourangles()` and
+`solar_radiation_extraterrestrial()`) depends only on
+day of year, latitude, slope, and aspect.
+Simulation runs that share latitude, slope, and aspect
+(e.g., grid cells of a gridded domain along the same row)
+therefore share one cached entry.
+
+A new entry is filled for all days of year when a combination is
+encountered for the first time; entries are read-only afterwards.
+Horizontal surfaces are cached independently of slope and aspect.
+
+@param[in,out] AtmDemCache Domain-wide cache of memoized solar geometry
+@param[in] lat Latitude of the site [radians].
+@param[in] slope Slope of the site
+    between 0 (horizontal) and pi / 2 (vertical) [radians].
+@param[in] aspect Surface aspect of the site [radians].
+@param[out] LogInfo Holds information on warnings and errors
+
+@return Pointer to memoized solar geometry or NULL if the cache is full
+    (i.e., #SW_ATMD_CACHE_MAXN entries); then, the caller memoizes locally.
+*/
+SW_ATMD *SW_PET_cache_get(
+    SW_ATMD_CACHE *AtmDemCache,
+    double lat,
+    double slope,
+    double aspect,
+    LOG_INFO *LogInfo
+) {
+    unsigned int i;
+    unsigned int doy;
+    unsigned int n = AtmDemCache->nEntries;
+    double sun_angles[7];
+    double int_cos_theta[2];
+    double int_sin_beta[2];
+    double H_o[2];
+    SW_ATMD *newAtmDem;
+
+    if (!has_tilted_surface(slope, aspect)) {
+        // Horizontal surfaces do not depend on slope and aspect
+        slope = 0.;
+        aspect = SW_MISSING;
+    }
+
+    for (i = 0; i < n; i++) {
+        if (EQ(AtmDemCache->keys[i][0], lat) &&
+            EQ(AtmDemCache->keys[i][1], slope) &&
+            EQ(AtmDemCache->keys[i][2], aspect)) {
+            return AtmDemCache->AtmDem[i];
+        }
+    }
+
+    if (n >= SW_ATMD_CACHE_MAXN) {
+        return NULL; // Cache is full
+    }
+
+    if (isnull(AtmDemCache->AtmDem)) {
+        // Allocate (small) lookup arrays at first use
+        AtmDemCache->keys = (double(*)[3]) Mem_Malloc(
+            sizeof(double[3]) * SW_ATMD_CACHE_MAXN,
+            "SW_PET_cache_get()",
+            LogInfo
+        );
+        if (LogInfo->stopRun) {
+            return NULL; // Exit function prematurely due to error
+        }
+
+        AtmDemCache->AtmDem = (SW_ATMD **) Mem_Malloc(
+            sizeof(SW_ATMD *) * SW_ATMD_CACHE_MAXN,
+            "SW_PET_cache_get()",
+            LogInfo
+        );
+        if (LogInfo->stopRun) {
+            return NULL; // Exit function prematurely due to error
+        }
+    }
+
+    newAtmDem = (SW_ATMD *) Mem_Malloc(
+        sizeof(SW_ATMD), "SW_PET_cache_get()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return NULL; // Exit function prematurely due to error
+    }
+
+    // Fill memoization for every day of year
+    SW_PET_init_run(newAtmDem);
+    for (doy = 1; doy <= MAX_DAYS; doy++) {
+        sun_hourangles(
+            newAtmDem,
+            doy,
+            lat,
+            slope,
+            aspect,
+            sun_angles,
+            int_cos_theta,
+            int_sin_beta
+        );
+        solar_radiation_extraterrestrial(
+            newAtmDem->memoized_G_o, doy, int_cos_theta, H_o
+        );
+    }
+
+    AtmDemCache->keys[n][0] = lat;
+    AtmDemCache->keys[n][1] = slope;
+    AtmDemCache->keys[n][2] = aspect;
+    AtmDemCache->AtmDem[n] = newAtmDem;
+    AtmDemCache->nEntries++;
+
+    return newAtmDem;
+}
+
 /**
 @brief Relative sun-earth distance
 
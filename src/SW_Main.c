@@ -15,8 +15,8 @@
 /* =================================================== */
 /*                INCLUDES / DEFINES                   */
 /* --------------------------------------------------- */
-#include "include/filefuncs.h"      // for sw_message
-#include "include/generic.h"        // for Bool, swFALSE, swTRUE
+#include "include/filefuncs.h"      // for sw_message, DirExists, MkDir
+#include "include/generic.h"        // for Bool, swFALSE, swTRUE, isnull
 #include "include/SW_Control.h"     // for SW_CTL_RunSimSet, SW_CTL_clear_m...
 #include "include/SW_datastructs.h" // for LOG_INFO, SW_RUN, SW_DOMAIN, SW_...
 #include "include/SW_Domain.h"      // for SW_DOM_deconstruct, SW_DOM_init_...
@@ -24,9 +24,10 @@
 #include "include/SW_Main_lib.h"    // for sw_fail_on_error, sw_init_args
 #include "include/SW_Model.h"       // for SW_MDL_get_ModelRun
 #include "include/SW_Output.h"      // for SW_OUT_close_files, SW_OUT_creat...
-#include "include/SW_Weather.h"     // for SW_WTH_finalize_all_weather
+#include "include/SW_Weather.h"     // for SW_WTH_finalize_all_weather, SW_...
 #include "include/Times.h"          // for SW_WT_ReportTime, SW_WT_StartTime
 #include <stdio.h>                  // for NULL, stdout
+#include <stdlib.h>                 // for free
 
 
 #if defined(SWNETCDF)
@@ -55,6 +56,10 @@ int main(int argc, char **argv) {
     Bool EchoInits = swFALSE;
     Bool renameDomainTemplateNC = swFALSE;
     Bool prepareFiles = swFALSE;
+    Bool buildWeatherCache = swFALSE;
+    Bool printMemory = swFALSE;
+    Bool lazyWeather = swFALSE;
+    unsigned int nWeatherCaches = 0;
 
     unsigned long userSUID;
 
@@ -77,6 +82,14 @@ int main(int argc, char **argv) {
         &SW_WallTime.wallTimeLimit,
         &renameDomainTemplateNC,
         &prepareFiles,
+        &buildWeatherCache,
+        &printMemory,
+        &lazyWeather,
+        &SW_WallTime.profileFile,
+        &SW_WallTime.suidDiagFile,
+        &SW_Domain.SW_PathInputs.spinupStateDir,
+        &SW_Domain.SW_PathInputs.climateCacheDir,
+        &SW_Domain.checkpointYears,
         &LogInfo
     );
     if (LogInfo.stopRun) {
@@ -119,6 +132,17 @@ int main(int argc, char **argv) {
         goto finishProgram;
     }
 
+    if (buildWeatherCache) {
+        SW_WTH_build_cache_tree(
+            &sw_template.Weather, &nWeatherCaches, &LogInfo
+        );
+        if (LogInfo.printProgressMsg && !LogInfo.stopRun) {
+            sw_printf("Built %u weather cache(s).\n", nWeatherCaches);
+        }
+
+        goto finishProgram;
+    }
+
 #if defined(SWNETCDF)
     SW_NCIN_check_input_config(
         &SW_Domain.netCDFInput,
@@ -146,7 +170,25 @@ int main(int argc, char **argv) {
     }
 #endif
 
-    // finalize daily weather
+    // finalize daily weather (or, if daily weather is read per simulation
+    // unit, defer it to the simulated years of each simulation unit);
+    // weather that is shared by all simulation units is finalized once
+#if defined(SWNETCDF)
+    sw_template.Weather.finalizeLazily =
+        (Bool) (lazyWeather &&
+                SW_Domain.netCDFInput.readInVars[eSW_InWeather][0]);
+#else
+    sw_template.Weather.finalizeLazily = swFALSE;
+#endif
+    if (lazyWeather && !sw_template.Weather.finalizeLazily) {
+        LogError(
+            &LogInfo,
+            LOGWARN,
+            "Option '-l' is ignored because daily weather is shared by all "
+            "simulation units and is finalized once."
+        );
+    }
+
 #if defined(SWNETCDF)
     if (!SW_Domain.netCDFInput.readInVars[eSW_InWeather][0] && !prepareFiles) {
 #endif
@@ -212,6 +254,11 @@ int main(int argc, char **argv) {
     }
 #endif // SWNETCDF
 
+    if (printMemory) {
+        SW_CTL_print_memory(&sw_template, &SW_Domain, &LogInfo);
+        goto finishProgram;
+    }
+
     SW_OUT_create_files(&sw_template.SW_PathOutputs, &SW_Domain, &LogInfo);
     if (LogInfo.stopRun || prepareFiles) {
         if (prepareFiles) {
@@ -225,6 +272,24 @@ int main(int argc, char **argv) {
         echo_all_inputs(&sw_template, &SW_Domain.OutDom, &LogInfo);
     }
 
+    // directory of spinup state snapshots
+    if (!isnull(SW_Domain.SW_PathInputs.spinupStateDir) &&
+        !DirExists(SW_Domain.SW_PathInputs.spinupStateDir)) {
+        MkDir(SW_Domain.SW_PathInputs.spinupStateDir, &LogInfo);
+        if (LogInfo.stopRun) {
+            goto closeFiles;
+        }
+    }
+
+    // directory of cached climate summaries
+    if (!isnull(SW_Domain.SW_PathInputs.climateCacheDir) &&
+        !DirExists(SW_Domain.SW_PathInputs.climateCacheDir)) {
+        MkDir(SW_Domain.SW_PathInputs.climateCacheDir, &LogInfo);
+        if (LogInfo.stopRun) {
+            goto closeFiles;
+        }
+    }
+
     // run simulations: loop over simulation set
     SW_CTL_RunSimSet(&sw_template, &SW_Domain, &SW_WallTime, &LogInfo);
 
@@ -240,6 +305,10 @@ finishProgram: {
     SW_DOM_deconstruct(&SW_Domain); // Includes closing netCDF files if needed
     SW_CTL_clear_model(swTRUE, &sw_template);
 
+    SW_WT_WriteProfile(&SW_WallTime, &LogInfo);
+    free(SW_WallTime.profileFile);
+    free(SW_WallTime.suidDiagFile);
+
     sw_write_warnings("(main) ", &LogInfo);
     SW_WT_ReportTime(SW_WallTime, &LogInfo);
     sw_wrapup_logs(&LogInfo);
@@ -42,7 +42,8 @@ static void sw_print_usage(void) {
         "Ecosystem water simulation model SOILWAT2\n"
         "More details at https://github.com/Burke-Lauenroth-Lab/SOILWAT2\n"
         "Usage: ./SOILWAT2 [-d startdir] [-f files.in] [-e] [-q] [-v] [-h] "
-        "[-s 1] [-t 10] [-r]\n"
+        "[-s 1] [-t 10] [-r] [-p] [-w] [-P profile.csv] [-u suids.csv] "
+        "[-S spinupdir] [-C 10] [-m] [-l] [-k climatedir]\n"
         "  -d : operate (chdir) in startdir (default=.)\n"
         "  -f : name of main input file (default=files.in)\n"
         "       a preceeding path applies to all input files\n"
@@ -57,6 +58,30 @@ static void sw_print_usage(void) {
         "  -r : rename netCDF domain template file "
         "[name provided in 'Input_nc/files_nc.in']\n"
         "  -p : solely prepare domain/progress, index, and output files\n"
+        "  -w : solely build binary weather caches for all weather files\n"
+        "       in the weather directory (and subdirectories)\n"
+        "  -P : write wall time of simulation phases to file\n"
+        "       (csv or, if file ends with '.json', json format);\n"
+        "       requires compilation with SWPROFILE\n"
+        "  -u : write diagnostics of each simulation unit to csv file\n"
+        "       (wall time, soil layers, generated weather days, warnings,\n"
+        "       errors, peak memory of the process, spinup years, and\n"
+        "       memory held by the run)\n"
+        "  -S : reuse state after spinup from snapshots in spinupdir\n"
+        "       (spinup is run and a snapshot is stored if inputs or spinup\n"
+        "       settings of a simulation unit have changed)\n"
+        "  -C : write a checkpoint of each simulation unit every N years\n"
+        "       and resume interrupted simulation units from it;\n"
+        "       netCDF-based SOILWAT2 only (ignored with a warning by\n"
+        "       text-based SOILWAT2)\n"
+        "  -m : solely print the memory footprint of a simulation unit\n"
+        "       and of the domain\n"
+        "  -l : finalize daily weather (impute, scale, and check) of each\n"
+        "       year just before it is simulated instead of all years upfront;\n"
+        "       only used if daily weather is read per simulation unit\n"
+        "       (netCDF weather inputs)\n"
+        "  -k : reuse climate summaries (used to estimate vegetation) from\n"
+        "       climatedir (calculated and stored for new daily weather)\n"
     );
 }
 
@@ -118,6 +143,24 @@ void sw_print_version(void) {
 @param[out] prepareFiles Should we only prepare domain/progress, index,
             and output files? If so, simulations will occur without this
             flag being turned on
+@param[out] buildWeatherCache Should we only build binary weather caches
+            (see SW_WTH_build_cache_tree())?
+@param[out] printMemory Should we only print the memory footprint
+            (see SW_CTL_print_memory())?
+@param[out] lazyWeather Should daily weather of each year be finalized
+            just before it is simulated (see SW_WTH_new_year())?
+@param[out] profileFile Name of file to which wall time of phases is
+            written (see SW_WT_WriteProfile()); NULL if not requested
+@param[out] suidDiagFile Name of file to which diagnostics of each
+            simulation unit are written (see SW_WT_OpenSuidDiag());
+            NULL if not requested
+@param[out] spinupStateDir Name of directory of spinup state snapshots
+            (see SW_CTL_read_spinup_state()); NULL if not requested
+@param[out] climateCacheDir Name of directory of cached climate summaries
+            (see SW_WTH_calc_climate_averages()); NULL if not requested
+@param[out] checkpointYears Write a checkpoint of each simulation run every
+            `checkpointYears` years (see SW_CTL_write_checkpoint());
+            0 if not requested
 @param[out] LogInfo Holds information on warnings and errors
 */
 void sw_init_args(
@@ -129,6 +172,14 @@ void sw_init_args(
     double *wallTimeLimit,
     Bool *renameDomainTemplateNC,
     Bool *prepareFiles,
+    Bool *buildWeatherCache,
+    Bool *printMemory,
+    Bool *lazyWeather,
+    char **profileFile,
+    char **suidDiagFile,
+    char **spinupStateDir,
+    char **climateCacheDir,
+    TimeInt *checkpointYears,
     LOG_INFO *LogInfo
 ) {
 
@@ -150,11 +201,28 @@ void sw_init_args(
 
     /* valid options */
     char const *opts[] = {
-        "-d", "-f", "-e", "-q", "-v", "-h", "-s", "-t", "-r", "-p"
+        "-d",
+        "-f",
+        "-e",
+        "-q",
+        "-v",
+        "-h",
+        "-s",
+        "-t",
+        "-r",
+        "-p",
+        "-w",
+        "-P",
+        "-u",
+        "-S",
+        "-C",
+        "-m",
+        "-l",
+        "-k"
     };
 
     /* indicates options with values: 0=none, 1=required, -1=optional */
-    int valopts[] = {1, 1, 0, 0, 0, 0, 1, 1, 0, 0};
+    int valopts[] = {1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1};
 
     int i;  /* looper through all cmdline arguments */
     int a;  /* current valid argument-value position */
@@ -170,6 +238,14 @@ void sw_init_args(
 
     *EchoInits = swFALSE;
     *renameDomainTemplateNC = swFALSE;
+    *buildWeatherCache = swFALSE;
+    *printMemory = swFALSE;
+    *lazyWeather = swFALSE;
+    *profileFile = NULL;
+    *suidDiagFile = NULL;
+    *spinupStateDir = NULL;
+    *climateCacheDir = NULL;
+    *checkpointYears = 0;
     *userSUID = 0; // Default (if no input) is 0 (i.e., all suids)
 
     a = 1;
@@ -308,6 +384,78 @@ void sw_init_args(
 #endif
             break;
 
+        case 10: /* -w */
+            *buildWeatherCache = swTRUE;
+            break;
+
+        case 11: /* -P */
+#if defined(SWPROFILE)
+            free(*profileFile);
+            *profileFile = Str_Dup(str, LogInfo);
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+#else
+            LogError(
+                LogInfo,
+                LOGWARN,
+                "Option '-P %s' is ignored: phases are timed only if "
+                "compiled with SWPROFILE.",
+                str
+            );
+#endif
+            break;
+
+        case 12: /* -u */
+            free(*suidDiagFile);
+            *suidDiagFile = Str_Dup(str, LogInfo);
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+            break;
+
+        case 13: /* -S */
+            free(*spinupStateDir);
+            *spinupStateDir = Str_Dup(str, LogInfo);
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+            break;
+
+        case 14: /* -C */
+#if defined(SW_OUTARRAY)
+            *checkpointYears = (TimeInt) sw_strtoul(str, errMsg, LogInfo);
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+#else
+            LogError(
+                LogInfo,
+                LOGWARN,
+                "Option '-C %s' is ignored: checkpoints are only available "
+                "in netCDF-based SOILWAT2 (text output files are recreated "
+                "by each run).",
+                str
+            );
+#endif
+            break;
+
+        case 15: /* -m */
+            *printMemory = swTRUE;
+            break;
+
+        case 16: /* -l */
+            *lazyWeather = swTRUE;
+            break;
+
+        case 17: /* -k */
+            free(*climateCacheDir);
+            *climateCacheDir = Str_Dup(str, LogInfo);
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+            break;
+
         default:
             LogError(
                 LogInfo,
@@ -100,35 +100,23 @@ void (*test_temp_correct_wetdry)(
 #endif
 
 
-/** Calculate multivariate normal variates for a set of
-    minimum and maximum temperature means, variances, and their covariance
-    for a specific day
-
-    @param wTmax Mean weekly maximum daily temperature (degree Celsius);
-           previously `_ucov[0]`
-    @param wTmin Mean weekly minimum daily temperature (degree Celsius);
-           previously `_ucov[1]`
-    @param wTmax_var Mean weekly variance of maximum daily temperature;
-           previously `vc00 = _vcov[0][0]`
-    @param wTmin_var Mean weekly variance of minimum daily temperature;
-           previously `vc11 = _vcov[1][1]`
-    @param wT_covar Mean weekly covariance between maximum and minimum
-           daily temperature; previously `vc10 = _vcov[1][0]`
-        @param markov_rng Random number generator of the weather
-                   generator
-        @param LogInfo Holds information on warnings and errors
-
-    @return Daily minimum (*tmin) and maximum (*tmax) temperature.
+/**
+@brief Cholesky factor of the 2-dimensional variance-covariance matrix
+    of daily maximum and minimum temperature
+
+@param wTmax_var Mean weekly variance of maximum daily temperature
+@param wTmin_var Mean weekly variance of minimum daily temperature
+@param wT_covar Mean weekly covariance between maximum and minimum
+    daily temperature
+@param[out] chol Lower-triangular factor: sd of maximum temperature,
+    `vc10`, and `vc11` (see `mvnorm()`)
+@param[out] LogInfo Holds information on warnings and errors
 */
-static void mvnorm(
-    double *tmax,
-    double *tmin,
-    double wTmax,
-    double wTmin,
+static void mvnorm_chol(
     double wTmax_var,
     double wTmin_var,
     double wT_covar,
-    sw_random_t *markov_rng,
+    double chol[],
     LOG_INFO *LogInfo
 ) {
     /* --------------------------------------------------- */
@@ -148,11 +136,8 @@ static void mvnorm(
      *       C converts the floats transparently.
      */
     double s;
-    double z1;
-    double z2;
     double wTmax_sd;
     double vc10;
-    double vc11;
 
     // Gentle, J. E. 2009. Computational statistics. Springer, Dordrecht; New
     // York.
@@ -176,10 +161,6 @@ static void mvnorm(
     //   s = covar ^ 2 / var1
     //   vc11 = sqrt(var2 - covar ^ 2 / var1)
 
-    // Generate two independent standard normal random numbers
-    z1 = RandNorm(0., 1., markov_rng);
-    z2 = RandNorm(0., 1., markov_rng);
-
     wTmax_sd = sqrt(wTmax_var);
     vc10 = (GT(wTmax_sd, 0.)) ? wT_covar / wTmax_sd : 0;
     s = vc10 * vc10;
@@ -193,14 +174,84 @@ static void mvnorm(
        for some values of `s` and `wTmin_var` (e.g., 99.264050000, 99.264050000)
        that both `GT(s, wTmin_var)` and `EQ(wTmin_var, s)` are FALSE;
        and thus, `vc11` becomes `NaN` */
-    vc11 = (LE(wTmin_var, s)) ? 0. : sqrt(wTmin_var - s);
+    chol[0] = wTmax_sd;
+    chol[1] = vc10;
+    chol[2] = (LE(wTmin_var, s)) ? 0. : sqrt(wTmin_var - s); // vc11
+}
+
+/**
+@brief Draw daily maximum and minimum temperature from a bivariate normal
+    distribution with a precomputed Cholesky factor
+
+@param[out] tmax Maximum daily temperature
+@param[out] tmin Minimum daily temperature
+@param wTmax Mean weekly maximum daily temperature
+@param wTmin Mean weekly minimum daily temperature
+@param chol Cholesky factor as produced by `mvnorm_chol()`
+@param markov_rng Random number generator of the weather generator
+*/
+static void mvnorm_draw(
+    double *tmax,
+    double *tmin,
+    double wTmax,
+    double wTmin,
+    const double chol[],
+    sw_random_t *markov_rng
+) {
+    double z1;
+    double z2;
+
+    // Generate two independent standard normal random numbers
+    z1 = RandNorm(0., 1., markov_rng);
+    z2 = RandNorm(0., 1., markov_rng);
 
     // mvnorm = mean + A * z
-    *tmax = wTmax_sd * z1 + wTmax;
-    *tmin = fmin(*tmax, (vc10 * z1) + (vc11 * z2) + wTmin);
+    *tmax = chol[0] * z1 + wTmax;
+    *tmin = fmin(*tmax, (chol[1] * z1) + (chol[2] * z2) + wTmin);
 }
 
 #ifdef SWDEBUG
+/** Calculate multivariate normal variates for a set of
+    minimum and maximum temperature means, variances, and their covariance
+    for a specific day
+
+    @param wTmax Mean weekly maximum daily temperature (degree Celsius);
+           previously `_ucov[0]`
+    @param wTmin Mean weekly minimum daily temperature (degree Celsius);
+           previously `_ucov[1]`
+    @param wTmax_var Mean weekly variance of maximum daily temperature;
+           previously `vc00 = _vcov[0][0]`
+    @param wTmin_var Mean weekly variance of minimum daily temperature;
+           previously `vc11 = _vcov[1][1]`
+    @param wT_covar Mean weekly covariance between maximum and minimum
+           daily temperature; previously `vc10 = _vcov[1][0]`
+        @param markov_rng Random number generator of the weather
+                   generator
+        @param LogInfo Holds information on warnings and errors
+
+    @return Daily minimum (*tmin) and maximum (*tmax) temperature.
+*/
+static void mvnorm(
+    double *tmax,
+    double *tmin,
+    double wTmax,
+    double wTmin,
+    double wTmax_var,
+    double wTmin_var,
+    double wT_covar,
+    sw_random_t *markov_rng,
+    LOG_INFO *LogInfo
+) {
+    double chol[3];
+
+    mvnorm_chol(wTmax_var, wTmin_var, wT_covar, chol, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    mvnorm_draw(tmax, tmin, wTmax, wTmin, chol, markov_rng);
+}
+
 // since `mvnorm` is static we cannot do unit tests unless we set it up
 // as an externed function pointer
 // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
@@ -229,6 +280,8 @@ void SW_MKV_init_ptrs(SW_MARKOV *SW_Markov) {
     SW_Markov->cfxd = NULL;
     SW_Markov->cfnw = NULL;
     SW_Markov->cfnd = NULL;
+
+    SW_Markov->v_chol_ok = swFALSE;
 }
 
 /**
@@ -253,6 +306,7 @@ void SW_MKV_construct(unsigned long rng_seed, SW_MARKOV *SW_Markov) {
 #endif
 
     SW_Markov->ppt_events = 0;
+    SW_Markov->n_genDays = 0;
 }
 
 /**
@@ -386,6 +440,10 @@ void copyMKV(SW_MARKOV *dest_MKV, SW_MARKOV *template_MKV) {
     Mem_Copy(dest_MKV->cfxd, template_MKV->cfxd, s);
     Mem_Copy(dest_MKV->cfnw, template_MKV->cfnw, s);
     Mem_Copy(dest_MKV->cfnd, template_MKV->cfnd, s);
+
+    /* Cholesky factors of the weekly covariance matrices */
+    Mem_Copy(dest_MKV->v_chol, template_MKV->v_chol, sizeof dest_MKV->v_chol);
+    dest_MKV->v_chol_ok = template_MKV->v_chol_ok;
 }
 
 /**
@@ -426,6 +484,16 @@ void SW_MKV_today(
     double p;
     double x;
 
+    if (!SW_Markov->v_chol_ok) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Weather generator: Cholesky factors of the weekly covariance "
+            "matrices are not set up (see `SW_MKV_setup_chol()`)."
+        );
+        return; // Exit function prematurely due to error
+    }
+
 #ifdef SWDEBUG
     if (debug) {
         sw_printf(
@@ -461,29 +529,22 @@ void SW_MKV_today(
     if (GT(*rain, 0.)) {
         SW_Markov->ppt_events++;
     }
+    SW_Markov->n_genDays++;
 
     /* Calculate temperature */
     week = doy2week(doy0 + 1);
 
-    mvnorm(
+    mvnorm_draw(
         tmax,
         tmin,
         // mean weekly maximum daily temp
         SW_Markov->u_cov[week][0],
         // mean weekly minimum daily temp
         SW_Markov->u_cov[week][1],
-        // mean weekly variance of maximum daily temp
-        SW_Markov->v_cov[week][0][0],
-        // mean weekly variance of minimum daily temp
-        SW_Markov->v_cov[week][1][1],
-        // mean weekly covariance of min/max daily temp
-        SW_Markov->v_cov[week][1][0],
-        &SW_Markov->markov_rng,
-        LogInfo
+        // Cholesky factor of weekly covariance matrix of min/max daily temp
+        SW_Markov->v_chol[week],
+        &SW_Markov->markov_rng
     );
-    if (LogInfo->stopRun) {
-        return; // Exit the function prematurely due to error
-    }
 
     temp_correct_wetdry(
         tmax,
@@ -870,6 +931,43 @@ closeFile: { CloseFile(&f, LogInfo); }
     return result;
 }
 
+/**
+@brief Precompute weekly Cholesky factors of the covariance matrices
+    of daily maximum and minimum temperature
+
+Must be called whenever `v_cov` changes and before `SW_MKV_today()`
+(which reports an error otherwise). All weeks are checked, i.e., a
+covariance matrix that is not positive definite is an error even if its
+week is never generated.
+
+@param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
+        related to temperature and weather generator
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_MKV_setup_chol(SW_MARKOV *SW_Markov, LOG_INFO *LogInfo) {
+    TimeInt week;
+
+    SW_Markov->v_chol_ok = swFALSE;
+
+    for (week = 0; week < MAX_WEEKS; week++) {
+        mvnorm_chol(
+            // mean weekly variance of maximum daily temp
+            SW_Markov->v_cov[week][0][0],
+            // mean weekly variance of minimum daily temp
+            SW_Markov->v_cov[week][1][1],
+            // mean weekly covariance of min/max daily temp
+            SW_Markov->v_cov[week][1][0],
+            SW_Markov->v_chol[week],
+            LogInfo
+        );
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
+    }
+
+    SW_Markov->v_chol_ok = swTRUE;
+}
+
 void SW_MKV_setup(
     SW_MARKOV *SW_Markov,
     unsigned long Weather_rng_seed,
@@ -914,5 +1012,10 @@ void SW_MKV_setup(
             "Weather generator requested but could not open %s",
             txtInFiles[eMarkovCov]
         );
+        return; // Exit function prematurely due to error
+    }
+
+    if (read_cov) {
+        SW_MKV_setup_chol(SW_Markov, LogInfo);
     }
 }
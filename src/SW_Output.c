@@ -43,6 +43,7 @@ History:
 #include "include/SW_VegEstab.h"    // for echo_VegEstab
 #include "include/SW_VegProd.h"     // for echo_VegProd
 #include "include/Times.h"          // for Time_days_in_month, WKDAYS
+#include <stddef.h>                 // for offsetof, size_t
 #include <stdio.h>                  // for snprintf, fprintf, printf
 #include <string.h>                 // for strcmp, memccpy, memset
 
@@ -56,6 +57,11 @@ History:
 #include "include/SW_Output_outtext.h" // for SW_OUT_close_textfiles, SW_OU...
 #endif
 
+// Binary columnar output declarations:
+#if defined(SW_OUTBIN)
+#include "include/SW_Output_outbin.h" // for SW_OUT_create_binfiles, SW_OUT...
+#endif
+
 #if defined(SWNETCDF)
 #include "include/SW_netCDF_General.h"
 #include "include/SW_netCDF_Input.h" // for eSW_InDomain, vNCdom
@@ -177,14 +183,30 @@ static OutPeriod str2period(char *s);
 static OutKey str2key(char *s, LOG_INFO *LogInfo);
 static OutSum str2stype(char *s, LOG_INFO *LogInfo);
 
-static void collect_sums(
+static void SW_OUT_read_outformat(
     SW_RUN *sw,
     SW_OUT_DOM *OutDom,
-    ObjType otyp,
-    OutPeriod op,
+    char *inbuf,
+    const char *fileName,
     LOG_INFO *LogInfo
 );
 
+static void *get_accu(SW_RUN *sw, ObjType otyp, OutPeriod pd);
+
+static void update_accu(
+    void *dst,
+    const void *src,
+    const SW_OUT_DOM *OutDom,
+    int k,
+    LyrIndex n_layers
+);
+
+static Bool has_YearFromMonths(SW_RUN *sw, SW_OUT_DOM *OutDom, int k);
+
+static void collect_sums(
+    SW_RUN *sw, SW_OUT_DOM *OutDom, ObjType otyp, LOG_INFO *LogInfo
+);
+
 static void sumof_wth(
     SW_WEATHER *v, SW_WEATHER_OUTPUTS *s, OutKey k, LOG_INFO *LogInfo
 );
@@ -217,6 +239,18 @@ static void average_for(
     LOG_INFO *LogInfo
 );
 
+static void add_accuFields(
+    SW_OUT_DOM *OutDom,
+    OutKey k,
+    size_t offsetFirst,
+    size_t offsetEnd,
+    Bool byLayer
+);
+
+static void set_accuFields(SW_OUT_DOM *OutDom, OutKey k);
+
+static void compile_OutDispatch(SW_OUT_DOM *OutDom);
+
 #ifdef STEPWAT
 static void set_SXWrequests_helper(
     SW_OUT_DOM *OutDom,
@@ -278,6 +312,78 @@ static OutSum str2stype(char *s, LOG_INFO *LogInfo) {
     return (OutSum) styp;
 }
 
+/** Interpret the `OUTFORMAT` line of `outsetup.in`
+
+Format: `OUTFORMAT csv` (default) or `OUTFORMAT binary [compress]`,
+see SW_Output_outbin.c
+*/
+static void SW_OUT_read_outformat(
+    SW_RUN *sw,
+    SW_OUT_DOM *OutDom,
+    char *inbuf,
+    const char *fileName,
+    LOG_INFO *LogInfo
+) {
+    char keyname[20];
+    char format[20];
+    char option[20];
+    int x;
+    Bool isBinary;
+    Bool isCompressed = swFALSE;
+
+    x = sscanf(inbuf, "%19s %19s %19s", keyname, format, option);
+
+    isBinary = (Bool) (x >= 2 && Str_CompareI(format, (char *) "BINARY") == 0);
+
+    if (x < 2 || (!isBinary && Str_CompareI(format, (char *) "CSV") != 0)) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "%s: Unknown output format in line '%s' "
+            "(expected 'csv' or 'binary').",
+            fileName,
+            inbuf
+        );
+        return; // Exit function prematurely due to error
+    }
+
+    if (x == 3) {
+        isCompressed =
+            (Bool) (isBinary && Str_CompareI(option, (char *) "COMPRESS") == 0);
+
+        if (!isCompressed) {
+            LogError(
+                LogInfo,
+                LOGERROR,
+                "%s: Unknown output format option in line '%s' "
+                "(expected 'compress' after 'binary').",
+                fileName,
+                inbuf
+            );
+            return; // Exit function prematurely due to error
+        }
+    }
+
+#if defined(SW_OUTBIN)
+    OutDom->useBinaryOutput = isBinary;
+    OutDom->compressBinaryOutput = isCompressed;
+    sw->OutRun.useOutval = isBinary;
+#else
+    (void) sw;
+    (void) OutDom;
+
+    if (isBinary) {
+        LogError(
+            LogInfo,
+            LOGWARN,
+            "%s: Binary output is not available in this build; "
+            "'OUTFORMAT binary' is ignored.",
+            fileName
+        );
+    }
+#endif
+}
+
 /** Checks whether a output variable (key) comes with soil layer or not.
 
 See also function `has_keyname_soillayers`.
@@ -609,6 +715,7 @@ static void average_for(
     LyrIndex i;
     int k;
     int j;
+    IntUS ik;
     LyrIndex n_layers = sw->Site.n_layers;
     LyrIndex n_evap_layers = sw->Site.n_evap_lyrs;
 
@@ -641,11 +748,9 @@ static void average_for(
 
     } else {
         // carefully aggregate for specific time period and aggregation type
-        // (mean, sum, final value)
-        ForEachOutKey(k) {
-            if (!OutDom->use[k]) {
-                continue;
-            }
+        // (mean, sum, final value) for each active output key of `otyp`
+        for (ik = 0; ik < OutDom->n_sumKeys[otyp][pd]; ik++) {
+            k = OutDom->sumKeys[otyp][pd][ik];
 
             switch (pd) {
             case eSW_Week:
@@ -675,7 +780,7 @@ static void average_for(
                 break;
             } /* end switch(pd) */
 
-            if (OutDom->myobj[k] != otyp || curr_pd < sw->OutRun.first[k] ||
+            if (curr_pd < sw->OutRun.first[k] ||
                 curr_pd > sw->OutRun.last[k]) {
                 continue;
             }
@@ -979,119 +1084,468 @@ static void average_for(
                 return; // Exit function prematurely due to error
             }
 
-        } /* end ForEachKey */
+        } /* end loop over active output keys */
     }
 }
 
+/** Obtain the accumulator of an object type for an output period
+
+@return Pointer to accumulator struct (`p_accu`) of object type `otyp`
+    or NULL if `otyp` has no accumulators
+*/
+static void *get_accu(SW_RUN *sw, ObjType otyp, OutPeriod pd) {
+    void *accu = NULL;
+
+    switch (otyp) {
+    case eSWC:
+        accu = (void *) sw->SoilWat.p_accu[pd];
+        break;
+    case eWTH:
+        accu = (void *) sw->Weather.p_accu[pd];
+        break;
+    case eVES:
+        accu = (void *) sw->VegEstab.p_accu[pd];
+        break;
+    case eVPD:
+        accu = (void *) sw->VegProd.p_accu[pd];
+        break;
+    default:
+        break;
+    }
+
+    return accu;
+}
+
+/** Add the accumulator fields of output key `k` of `src` to those of `dst`
+    or, if `src` is NULL, reset the accumulator fields of `dst` to zero
+
+Only the fields that hold values of output key `k` are visited
+(and of those organized by soil layer, only the first `n_layers` values)
+instead of the entire accumulator struct.
+*/
+static void update_accu(
+    void *dst,
+    const void *src,
+    const SW_OUT_DOM *OutDom,
+    int k,
+    LyrIndex n_layers
+) {
+    IntUS ig;
+    size_t i;
+    size_t r;
+    size_t nrow;
+    size_t ncol;
+    size_t stride;
+    double *d;
+    const double *s;
+    const SW_OUT_ACCUFIELDS *g;
+
+    for (ig = 0; ig < OutDom->n_accuFields[k]; ig++) {
+        g = &OutDom->accuFields[k][ig];
+
+        if (g->byLayer) {
+            nrow = g->n / MAX_LAYERS;
+            ncol = n_layers;
+            stride = MAX_LAYERS;
+        } else {
+            nrow = 1;
+            ncol = g->n;
+            stride = g->n;
+        }
+
+        for (r = 0; r < nrow; r++) {
+            d = (double *) ((char *) dst + g->offset) + r * stride;
+
+            if (isnull(src)) {
+                for (i = 0; i < ncol; i++) {
+                    d[i] = 0.;
+                }
+            } else {
+                s = (const double *) ((const char *) src + g->offset) +
+                    r * stride;
+                for (i = 0; i < ncol; i++) {
+                    d[i] += s[i];
+                }
+            }
+        }
+    }
+}
+
+/** Determine whether yearly sums of output key `k` are rolled up from
+    completed months instead of summed from daily values
+
+This is the case if monthly and yearly values are summed and if
+all simulated days of the current year are within the requested output
+days of `k` (then, months and year cover the same days).
+*/
+static Bool has_YearFromMonths(SW_RUN *sw, SW_OUT_DOM *OutDom, int k) {
+    return (Bool) (OutDom->sumOutPeriod[k][eSW_Month] &&
+                   OutDom->sumOutPeriod[k][eSW_Year] &&
+                   sw->OutRun.first[k] <= 1 &&
+                   sw->OutRun.last[k] >= sw->Model.lastdoy);
+}
+
 static void collect_sums(
-    SW_RUN *sw,
-    SW_OUT_DOM *OutDom,
-    ObjType otyp,
-    OutPeriod op,
-    LOG_INFO *LogInfo
+    SW_RUN *sw, SW_OUT_DOM *OutDom, ObjType otyp, LOG_INFO *LogInfo
 ) {
-    TimeInt pd = 0;
-    int i;
     int k;
-    Bool use_help;
-    Bool use_KeyPeriodCombo;
+    IntUS ik;
+    LyrIndex n_layers = sw->Site.n_layers;
+    TimeInt doy = sw->Model.doy;
+    TimeInt week = sw->Model.week + 1;
+    TimeInt month = sw->Model.month + 1;
+    Bool inDays;
+    void *today = get_accu(sw, otyp, eSW_Day);
+
+    // Sum daily values of each active output key that belongs to the output
+    // type `otyp` (eSWC, eWTH, eVES, eVPD) once (via `sumof_XXX`) into the
+    // day accumulator and add them from there to the accumulators of the
+    // other active output periods
+    for (ik = 0; ik < OutDom->n_dailyKeys[otyp]; ik++) {
+        k = OutDom->dailyKeys[otyp][ik];
+
+        update_accu(today, NULL, OutDom, k, n_layers);
+
+        switch (otyp) {
+        case eSWC:
+            sumof_swc(
+                &sw->SoilWat,
+                sw->SoilWat.p_accu[eSW_Day],
+                (OutKey) k,
+                &sw->Site,
+                LogInfo
+            );
+            break;
+
+        case eWTH:
+            sumof_wth(
+                &sw->Weather, sw->Weather.p_accu[eSW_Day], (OutKey) k, LogInfo
+            );
+            break;
+
+        case eVES:
+            sumof_ves(
+                &sw->VegEstab, sw->VegEstab.p_accu[eSW_Day], (OutKey) k
+            ); /* nothing to sum, y'see */
+            break;
+
+        case eVPD:
+            sumof_vpd(
+                &sw->VegProd,
+                sw->VegProd.p_accu[eSW_Day],
+                (OutKey) k,
+                doy,
+                LogInfo
+            );
+            break;
+
+        default:
+            break;
+        }
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
+
+        inDays = (Bool) (doy >= sw->OutRun.first[k] &&
+                         doy <= sw->OutRun.last[k]);
+
+        if (OutDom->sumOutPeriod[k][eSW_Week] && week >= sw->OutRun.first[k] &&
+            week <= sw->OutRun.last[k]) {
+            update_accu(
+                get_accu(sw, otyp, eSW_Week), today, OutDom, k, n_layers
+            );
+        }
+
+        if (OutDom->sumOutPeriod[k][eSW_Month] &&
+            month >= sw->OutRun.first[k] && month <= sw->OutRun.last[k]) {
+            update_accu(
+                get_accu(sw, otyp, eSW_Month), today, OutDom, k, n_layers
+            );
+        }
+
+        // yearly sums are rolled up from completed months if possible
+        // (see `SW_OUT_sum_today()`)
+        if (OutDom->sumOutPeriod[k][eSW_Year] && inDays &&
+            !has_YearFromMonths(sw, OutDom, k)) {
+            update_accu(
+                get_accu(sw, otyp, eSW_Year), today, OutDom, k, n_layers
+            );
+        }
+
+        if (OutDom->sumOutPeriod[k][eSW_Day] && !inDays) {
+            // no daily output values outside of requested output days
+            update_accu(today, NULL, OutDom, k, n_layers);
+        }
+    } /* end loop over active output keys */
+}
+
+/** Add a group of consecutive accumulator fields to output key `k`
+
+@param[in,out] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[in] k Output key
+@param[in] offsetFirst Offset [bytes] of first field in accumulator struct
+@param[in] offsetEnd Offset [bytes] of the end of the last field
+@param[in] byLayer TRUE if fields are rows of `MAX_LAYERS` values
+*/
+static void add_accuFields(
+    SW_OUT_DOM *OutDom,
+    OutKey k,
+    size_t offsetFirst,
+    size_t offsetEnd,
+    Bool byLayer
+) {
+    SW_OUT_ACCUFIELDS *g = &OutDom->accuFields[k][OutDom->n_accuFields[k]];
+
+    g->offset = offsetFirst;
+    g->n = (offsetEnd - offsetFirst) / sizeof(double);
+    g->byLayer = byLayer;
+
+    OutDom->n_accuFields[k]++;
+}
+
+/* offset [bytes] of the end of member `m` of struct `type` */
+#define ENDOF(type, m) (offsetof(type, m) + sizeof(((type *) 0)->m))
+
+/* compile-time check of `cond` (C99 has no `static_assert`) */
+#define ACCU_ASSERT(cond) ((void) sizeof(char[(cond) ? 1 : -1]))
+
+/* group of consecutive accumulator fields `m1` to `m2` of struct `type`
+   that consists of exactly `nValues` values of type double */
+#define ACCU(type, m1, m2, nValues, byLayer)                        \
+    do {                                                            \
+        ACCU_ASSERT(                                                \
+            ENDOF(type, m2) - offsetof(type, m1) ==                 \
+            (size_t) (nValues) * sizeof(double)                     \
+        );                                                          \
+        add_accuFields(                                             \
+            OutDom, k, offsetof(type, m1), ENDOF(type, m2), byLayer \
+        );                                                          \
+    } while (0)
+
+/** Describe the accumulator fields that `sumof_XXX` sums up for output key
+    `k` (and that `average_for()` aggregates)
+
+Fields of a group must be declared consecutively in their accumulator struct
+(all fields are of type double); `ACCU()` fails to compile if a group does not
+span exactly the stated number of values, e.g., after fields are added to,
+removed from, or reordered in an accumulator struct.
 
-    switch (op) {
-    case eSW_Day:
-        pd = sw->Model.doy;
+@param[in,out] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[in] k Output key
+*/
+static void set_accuFields(SW_OUT_DOM *OutDom, OutKey k) {
+    OutDom->n_accuFields[k] = 0;
+
+    switch (k) {
+    case eSW_Temp:
+        ACCU(SW_WEATHER_OUTPUTS, temp_max, temp_avg, 3, swFALSE);
+        ACCU(SW_WEATHER_OUTPUTS, surfaceAvg, surfaceMin, 3, swFALSE);
         break;
-    case eSW_Week:
-        pd = sw->Model.week + 1;
+    case eSW_Precip:
+        ACCU(SW_WEATHER_OUTPUTS, ppt, snowloss, 5, swFALSE);
         break;
-    case eSW_Month:
-        pd = sw->Model.month + 1;
+    case eSW_SoilInf:
+        ACCU(SW_WEATHER_OUTPUTS, soil_inf, soil_inf, 1, swFALSE);
         break;
-    case eSW_Year:
-        pd = sw->Model.doy;
+    case eSW_Runoff:
+        ACCU(SW_WEATHER_OUTPUTS, snowRunoff, surfaceRunon, 3, swFALSE);
         break;
-    default:
-        LogError(
-            LogInfo, LOGERROR, "PGMR: Invalid outperiod in collect_sums()"
+
+    case eSW_VWCBulk:
+        ACCU(SW_SOILWAT_OUTPUTS, vwcBulk, vwcBulk, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_VWCMatric:
+        ACCU(SW_SOILWAT_OUTPUTS, vwcMatric, vwcMatric, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_SWCBulk:
+        ACCU(SW_SOILWAT_OUTPUTS, swcBulk, swcBulk, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_SWABulk:
+        ACCU(SW_SOILWAT_OUTPUTS, swaBulk, swaBulk, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_SWAMatric:
+        ACCU(SW_SOILWAT_OUTPUTS, swaMatric, swaMatric, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_SWA:
+        ACCU(
+            SW_SOILWAT_OUTPUTS,
+            SWA_VegType,
+            SWA_VegType,
+            NVEGTYPES * MAX_LAYERS,
+            swTRUE
         );
         break;
+    case eSW_SWPMatric:
+        ACCU(SW_SOILWAT_OUTPUTS, swpMatric, swpMatric, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_SurfaceWater:
+        ACCU(SW_SOILWAT_OUTPUTS, surfaceWater, surfaceWater, 1, swFALSE);
+        break;
+    case eSW_Transp:
+        ACCU(
+            SW_SOILWAT_OUTPUTS,
+            transp_total,
+            transp,
+            (NVEGTYPES + 1) * MAX_LAYERS,
+            swTRUE
+        );
+        break;
+    case eSW_EvapSoil:
+        ACCU(
+            SW_SOILWAT_OUTPUTS,
+            evap_baresoil,
+            evap_baresoil,
+            MAX_LAYERS,
+            swTRUE
+        );
+        break;
+    case eSW_EvapSurface:
+        ACCU(
+            SW_SOILWAT_OUTPUTS,
+            surfaceWater_evap,
+            litter_evap,
+            NVEGTYPES + 3,
+            swFALSE
+        );
+        break;
+    case eSW_Interception:
+        ACCU(SW_SOILWAT_OUTPUTS, total_int, litter_int, NVEGTYPES + 2, swFALSE);
+        break;
+    case eSW_LyrDrain:
+        ACCU(SW_SOILWAT_OUTPUTS, lyrdrain, lyrdrain, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_HydRed:
+        ACCU(
+            SW_SOILWAT_OUTPUTS,
+            hydred_total,
+            hydred,
+            (NVEGTYPES + 1) * MAX_LAYERS,
+            swTRUE
+        );
+        break;
+    case eSW_AET:
+        ACCU(SW_SOILWAT_OUTPUTS, aet, esurf, 5, swFALSE);
+        break;
+    case eSW_PET:
+        ACCU(SW_SOILWAT_OUTPUTS, pet, H_gt, 5, swFALSE);
+        break;
+    case eSW_WetDays:
+        ACCU(SW_SOILWAT_OUTPUTS, wetdays, wetdays, MAX_LAYERS, swTRUE);
+        break;
+    case eSW_SnowPack:
+        ACCU(SW_SOILWAT_OUTPUTS, snowpack, snowdepth, 2, swFALSE);
+        break;
+    case eSW_DeepSWC:
+        ACCU(SW_SOILWAT_OUTPUTS, deep, deep, 1, swFALSE);
+        break;
+    case eSW_SoilTemp:
+        ACCU(SW_SOILWAT_OUTPUTS, avgLyrTemp, avgLyrTemp, MAX_LAYERS, swTRUE);
+        ACCU(
+            SW_SOILWAT_OUTPUTS,
+            minLyrTemperature,
+            maxLyrTemperature,
+            2 * MAX_LAYERS,
+            swTRUE
+        );
+        break;
+    case eSW_Frozen:
+        ACCU(SW_SOILWAT_OUTPUTS, lyrFrozen, lyrFrozen, MAX_LAYERS, swTRUE);
+        break;
+
+    case eSW_Biomass:
+        ACCU(SW_VEGPROD_OUTPUTS, veg, LAI, 3 * NVEGTYPES + 4, swFALSE);
+        break;
+
+    default:
+        // no summed values: output is obtained directly (e.g., eSW_Estab and
+        // eSW_CO2Effects)
+        break;
     }
+}
 
+#undef ACCU
+#undef ACCU_ASSERT
+#undef ENDOF
+
+/** Compile the dispatch lists of active output key x output period
+    combinations
+
+    The daily output loops (`collect_sums()`, `average_for()`, and
+    `SW_OUT_write_today()`) visit only these combinations instead of
+    checking `use`, `myobj`, and `timeSteps` for every output key each day.
+
+@param[in,out] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+*/
+static void compile_OutDispatch(SW_OUT_DOM *OutDom) {
+    OutPeriod p;
+    unsigned int k;
+    unsigned int i;
+    unsigned int otyp;
+    Bool isActive;
+    Bool hasPeriod;
+
+    OutDom->n_activeOut = 0;
+    for (otyp = 0; otyp < SW_NOBJTYPES; otyp++) {
+        ForEachOutPeriod(p) { OutDom->n_sumKeys[otyp][p] = 0; }
+        OutDom->n_dailyKeys[otyp] = 0;
+    }
 
-    // call `sumof_XXX` for each output key x output period combination
-    // for those output keys that belong to the output type `otyp` (eSWC, eWTH,
-    // eVES, eVPD)
     ForEachOutKey(k) {
-        if (otyp != OutDom->myobj[k] || !OutDom->use[k]) {
+        ForEachOutPeriod(p) { OutDom->sumOutPeriod[k][p] = swFALSE; }
+
+        if (!OutDom->use[k]) {
             continue;
         }
 
-        /* determine whether output period op is active for current output key k
-         */
-        use_KeyPeriodCombo = swFALSE;
+        // Combinations of output key and time step of the daily output loop
         for (i = 0; i < OutDom->used_OUTNPERIODS; i++) {
-            use_help = (Bool) (op == OutDom->timeSteps[k][i]);
-
+            isActive = (Bool) (OutDom->timeSteps[k][i] != eSW_NoTime);
 #ifdef STEPWAT
-            use_help = (Bool) (use_help || op == OutDom->timeSteps_SXW[k][i]);
+            isActive = (Bool) (isActive ||
+                               OutDom->timeSteps_SXW[k][i] != eSW_NoTime);
 #endif
 
-            if (use_help) {
-                use_KeyPeriodCombo = swTRUE;
-                break;
+            if (isActive) {
+                OutDom->activeOutKey[OutDom->n_activeOut] = (OutKey) k;
+                OutDom->activeOutStep[OutDom->n_activeOut] = (IntUS) i;
+                OutDom->n_activeOut++;
             }
         }
 
-        if (use_KeyPeriodCombo && pd >= sw->OutRun.first[k] &&
-            pd <= sw->OutRun.last[k]) {
-            switch (otyp) {
-            case eSWC:
-                sumof_swc(
-                    &sw->SoilWat,
-                    sw->SoilWat.p_accu[op],
-                    (OutKey) k,
-                    &sw->Site,
-                    LogInfo
-                );
-                if (LogInfo->stopRun) {
-                    return; // Exit function prematurely due to error
-                }
-                break;
+        // Output periods for which values of output key are summed up
+        otyp = OutDom->myobj[k];
 
-            case eWTH:
-                sumof_wth(
-                    &sw->Weather, sw->Weather.p_accu[op], (OutKey) k, LogInfo
-                );
-                if (LogInfo->stopRun) {
-                    return; // Exit function prematurely due to error
-                }
-                break;
-            case eVES:
-                if (op == eSW_Year) {
-                    sumof_ves(
-                        &sw->VegEstab, sw->VegEstab.p_accu[eSW_Year], (OutKey) k
-                    ); /* yearly, y'see */
-                }
-                break;
+        ForEachOutPeriod(p) {
+            hasPeriod = swFALSE;
 
-            case eVPD:
-                sumof_vpd(
-                    &sw->VegProd,
-                    sw->VegProd.p_accu[op],
-                    (OutKey) k,
-                    sw->Model.doy,
-                    LogInfo
-                );
-                if (LogInfo->stopRun) {
-                    return; // Exit function prematurely due to error
-                }
-                break;
+            for (i = 0; i < OutDom->used_OUTNPERIODS; i++) {
+                hasPeriod = (Bool) (hasPeriod || OutDom->timeSteps[k][i] == p);
+#ifdef STEPWAT
+                hasPeriod =
+                    (Bool) (hasPeriod || OutDom->timeSteps_SXW[k][i] == p);
+#endif
+            }
 
-            default:
-                break;
+            if (hasPeriod) {
+                OutDom->sumKeys[otyp][p][OutDom->n_sumKeys[otyp][p]] =
+                    (OutKey) k;
+                OutDom->n_sumKeys[otyp][p]++;
+                OutDom->sumOutPeriod[k][p] = swTRUE;
             }
         }
 
-    } /* end ForEachOutKey */
+        // Daily values of output key are summed up once per day
+        ForEachOutPeriod(p) {
+            if (OutDom->sumOutPeriod[k][p]) {
+                OutDom->dailyKeys[otyp][OutDom->n_dailyKeys[otyp]] = (OutKey) k;
+                OutDom->n_dailyKeys[otyp]++;
+                break;
+            }
+        }
+    }
 }
 
 
@@ -1144,7 +1598,8 @@ static void set_SXWrequests_helper(
     information that do not change throughout simulation runs
 
 @sideeffect Uses global variables SW_Output.use and timeSteps to set
-    elements of use_OutPeriod
+    elements of use_OutPeriod and to compile the dispatch lists of
+    active output key x output period combinations
 */
 void find_OutPeriods_inUse(SW_OUT_DOM *OutDom) {
     OutPeriod p;
@@ -1165,6 +1620,8 @@ void find_OutPeriods_inUse(SW_OUT_DOM *OutDom) {
             }
         }
     }
+
+    compile_OutDispatch(OutDom);
 }
 
 /** Determine whether output period `pd` is active for output key `k`
@@ -1282,6 +1739,9 @@ void SW_OUT_set_SXWrequests(SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
     if (LogInfo->stopRun) {
         return; // Exit function prematurely due to error
     }
+
+    // Include SXW requests in dispatch lists of active outputs
+    compile_OutDispatch(OutDom);
 }
 #endif
 
@@ -1314,7 +1774,7 @@ void SW_OUTDOM_init_ptrs(SW_OUT_DOM *OutDom) {
     int column;
 
     ForEachOutKey(key) {
-        for (column = 0; column < 5 * NVEGTYPES + MAX_LAYERS; column++) {
+        for (column = 0; column < SW_OUTNMAXCOLS; column++) {
             OutDom->colnames_OUT[key][column] = NULL;
         }
     }
@@ -1373,6 +1833,9 @@ void SW_OUTDOM_construct(SW_OUT_DOM *OutDom) {
         OutDom->first_orig[k] = 1;
         OutDom->last_orig[k] = 366;
 
+        // describe accumulator fields that hold summed values
+        set_accuFields(OutDom, (OutKey) k);
+
         // assign `get_XXX` functions
         switch (k) {
         case eSW_Temp:
@@ -1918,6 +2381,12 @@ void SW_OUT_construct(
     ForEachOutPeriod(p) {
         SW_PathOutputs->make_soil[p] = swFALSE;
         SW_PathOutputs->make_regular[p] = swFALSE;
+        SW_PathOutputs->fpbuf_reg[p] = NULL;
+        SW_PathOutputs->fpbuf_soil[p] = NULL;
+#if defined(SW_OUTBIN)
+        SW_PathOutputs->bin_reg[p] = NULL;
+        SW_PathOutputs->bin_soil[p] = NULL;
+#endif
     }
 #else
     /* Silence compiler */
@@ -1926,6 +2395,13 @@ void SW_OUT_construct(
 
 #if defined(SW_OUTARRAY)
     ForEachOutPeriod(p) { OutRun->irow_OUT[p] = 0; }
+#if defined(SWNETCDF)
+    ForEachOutPeriod(p) {
+        OutRun->irowOffset_OUT[p] = 0;
+        OutRun->ncFileOffset_OUT[p] = 0;
+        OutRun->ncTimeOffset_OUT[p] = 0;
+    }
+#endif
 #else
     (void) OutRun;
 #endif
@@ -2166,7 +2642,7 @@ void SW_OUT_set_colnames(
     unsigned int tLayers,
     SW_VEGESTAB_INFO **parms,
     const IntUS ncol_OUT[],
-    char *colnames_OUT[][5 * NVEGTYPES + MAX_LAYERS],
+    char *colnames_OUT[][SW_OUTNMAXCOLS],
     LOG_INFO *LogInfo
 ) {
 #ifdef SWDEBUG
@@ -2176,7 +2652,7 @@ void SW_OUT_set_colnames(
     unsigned int i;
     unsigned int j;
     char ctemp[50];
-    const char *Layers_names[MAX_LAYERS] = {
+    const char *Layers_names[] = {
         "Lyr_1",  "Lyr_2",  "Lyr_3",  "Lyr_4",  "Lyr_5",  "Lyr_6",  "Lyr_7",
         "Lyr_8",  "Lyr_9",  "Lyr_10", "Lyr_11", "Lyr_12", "Lyr_13", "Lyr_14",
         "Lyr_15", "Lyr_16", "Lyr_17", "Lyr_18", "Lyr_19", "Lyr_20", "Lyr_21",
@@ -2976,6 +3452,18 @@ void SW_OUT_read(
                 continue; // read next line of `outsetup.in`
             }
 
+            if (Str_CompareI(keyname, (char *) "OUTFORMAT") == 0) {
+                // `OUTFORMAT` does not count towards the numbered items
+                itemno--;
+
+                SW_OUT_read_outformat(sw, OutDom, inbuf, MyFileName, LogInfo);
+                if (LogInfo->stopRun) {
+                    goto closeFile;
+                }
+
+                continue; // read next line of `outsetup.in`
+            }
+
             if (Str_CompareI(keyname, (char *) "OUTSEP") == 0) {
                 // Notify the user that this functionality has been removed
                 LogError(
@@ -3136,6 +3624,13 @@ void SW_OUT_read(
     SW_OUT_set_nrow(&sw->Model, OutDom->use_OutPeriod, OutDom->nrow_OUT);
 #endif
 
+#if defined(SWNETCDF)
+    // Streaming output: hold at most `streamOutYears` years of time steps
+    SW_NCOUT_set_nrow_stream(
+        OutDom->netCDFOutput.streamOutYears, OutDom->nrow_OUT
+    );
+#endif
+
     if (DirExists(outDir)) {
         SW_F_CleanOutDir(outDir, LogInfo);
     } else {
@@ -3226,8 +3721,23 @@ void SW_OUT_sum_today(
     /*  SW_VEGESTAB *v = &SW_VegEstab;  -> we don't need to sum daily for this
      */
     OutPeriod pd;
+    int k;
+    IntUS ik;
+    LyrIndex n_layers = sw->Site.n_layers;
+    void *accu;
+
+    if (isnull(get_accu(sw, otyp, eSW_Day))) {
+        LogError(
+            LogInfo, LOGERROR, "Invalid object type in SW_OUT_sum_today()."
+        );
+        return; // Exit function prematurely due to error
+    }
 
     ForEachOutPeriod(pd) {
+        if (OutDom->n_sumKeys[otyp][pd] == 0) {
+            continue; // no active output key of `otyp` for this period
+        }
+
         // `newperiod[eSW_Day]` is always TRUE
         if (bFlush_output || sw->Model.newperiod[pd]) {
             average_for(sw, OutDom, otyp, pd, bFlush_output, tOffset, LogInfo);
@@ -3236,38 +3746,31 @@ void SW_OUT_sum_today(
                 return; // Exit function prematurely due to error
             }
 
-            switch (otyp) {
-            case eSWC:
-                memset(sw->SoilWat.p_accu[pd], 0, sizeof(SW_SOILWAT_OUTPUTS));
-                break;
-            case eWTH:
-                memset(sw->Weather.p_accu[pd], 0, sizeof(SW_WEATHER_OUTPUTS));
-                break;
-            case eVES:
-                break;
-            case eVPD:
-                memset(sw->VegProd.p_accu[pd], 0, sizeof(SW_VEGPROD_OUTPUTS));
-                break;
-            default:
-                LogError(
-                    LogInfo,
-                    LOGERROR,
-                    "Invalid object type in SW_OUT_sum_today()."
-                );
-                return; // Exit function prematurely due to error
+            if (pd == eSW_Day) {
+                continue; // day accumulators are reset by `collect_sums()`
             }
-        }
-    }
 
-    if (!bFlush_output) {
-        ForEachOutPeriod(pd) {
-            collect_sums(sw, OutDom, otyp, pd, LogInfo);
+            accu = get_accu(sw, otyp, pd);
 
-            if (LogInfo->stopRun) {
-                return; // Exit function prematurely due to error
+            for (ik = 0; ik < OutDom->n_sumKeys[otyp][pd]; ik++) {
+                k = OutDom->sumKeys[otyp][pd][ik];
+
+                // roll up completed month into year
+                if (pd == eSW_Month && has_YearFromMonths(sw, OutDom, k)) {
+                    update_accu(
+                        get_accu(sw, otyp, eSW_Year), accu, OutDom, k, n_layers
+                    );
+                }
+
+                // reset accumulator fields of active output keys
+                update_accu(accu, NULL, OutDom, k, n_layers);
             }
         }
     }
+
+    if (!bFlush_output) {
+        collect_sums(sw, OutDom, otyp, LogInfo);
+    }
 }
 
 /** `SW_OUT_write_today` is called twice
@@ -3334,9 +3837,12 @@ void SW_OUT_write_today(
     int k;
     int i;
     int outPeriod;
+    IntUS ia;
 
 #ifdef SW_OUTTEXT
     Bool fullBuffer = swFALSE;
+    size_t writeSizeReg[SW_OUTNPERIODS];
+    size_t writeSizeSoil[SW_OUTNPERIODS];
 
     char *soilWritePtr[SW_OUTNPERIODS] = {
         sw->SW_PathOutputs.buf_soil[0],
@@ -3355,6 +3861,8 @@ void SW_OUT_write_today(
 #ifdef STEPWAT
     Bool use_help_txt;
     Bool use_help_SXW;
+    size_t writeSizeSoilAgg[SW_OUTNPERIODS];
+    size_t writeSizeRegAgg[SW_OUTNPERIODS];
 
     char *soilAggWritePtr[SW_OUTNPERIODS] = {
         sw->SW_PathOutputs.buf_soil_agg[0],
@@ -3425,221 +3933,229 @@ void SW_OUT_write_today(
     writeit[eSW_Day] = (Bool) (writeit[eSW_Day] && !bFlush_output);
 
 
-    // Loop over output types/keys, over used output time periods, call
+    // Loop over active output key x output period combinations, call
     // formatting functions `get_XXX`, and concatenate for one row of
     // `csv`-output
-    ForEachOutKey(k) {
+    for (ia = 0; ia < OutDom->n_activeOut; ia++) {
+        k = OutDom->activeOutKey[ia];
+        i = OutDom->activeOutStep[ia];
+
+        if (ia == 0 || k != OutDom->activeOutKey[ia - 1]) {
+            // First combination of an output key
 #ifdef SW_OUTTEXT
-        size_t writeSizeReg[SW_OUTNPERIODS] = {
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN)
-        };
+            ForEachOutPeriod(p) {
+                writeSizeReg[p] = (size_t) (MAX_LAYERS * OUTSTRLEN);
+                writeSizeSoil[p] = (size_t) (MAX_LAYERS * OUTSTRLEN);
+#ifdef STEPWAT
+                writeSizeSoilAgg[p] = (size_t) (MAX_LAYERS * OUTSTRLEN);
+                writeSizeRegAgg[p] = (size_t) (MAX_LAYERS * OUTSTRLEN);
+#endif
+            }
+#endif
 
-        size_t writeSizeSoil[SW_OUTNPERIODS] = {
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN)
-        };
+#ifdef SWDEBUG
+            if (debug) {
+                sw_printf("key=%d=%s: ", k, key2str[k]);
+            }
 #endif
+        }
+
+        outPeriod = OutDom->timeSteps[k][i];
+        use_help = (Bool) (outPeriod != eSW_NoTime && writeit[outPeriod]);
 
 #ifdef STEPWAT
-        size_t writeSizeSoilAgg[SW_OUTNPERIODS] = {
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN)
-        };
-        size_t writeSizeRegAgg[SW_OUTNPERIODS] = {
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN),
-            (size_t) (MAX_LAYERS * OUTSTRLEN)
-        };
+        use_help_txt = use_help;
+        use_help_SXW = (Bool) (OutDom->timeSteps_SXW[k][i] != eSW_NoTime &&
+                               writeit[OutDom->timeSteps_SXW[k][i]]);
+        use_help = (Bool) (use_help_txt || use_help_SXW);
 #endif
 
+        if (!use_help) {
+            continue; // don't call any `get_XXX` function
+        }
+
+#if defined(SOILWAT) && !defined(SWNETCDF)
 #ifdef SWDEBUG
         if (debug) {
-            sw_printf("key=%d=%s: ", k, key2str[k]);
+            sw_printf(" call pfunc_text(%d=%s))", outPeriod, pd2str[outPeriod]);
         }
 #endif
+#if defined(SW_OUTBIN)
+        sw->OutRun.n_outval = 0;
+#endif
+        OutDom->pfunc_text[k](outPeriod, sw, LogInfo);
 
-        if (!OutDom->use[k]) {
-            continue;
+#elif defined(RSOILWAT) || defined(SWNETCDF)
+#ifdef SWDEBUG
+        if (debug) {
+            sw_printf(" call pfunc_mem(%d=%s))", outPeriod, pd2str[outPeriod]);
         }
-
-        for (i = 0; i < OutDom->used_OUTNPERIODS; i++) {
-
-            outPeriod = OutDom->timeSteps[k][i];
-            use_help = (Bool) (outPeriod != eSW_NoTime && writeit[outPeriod]);
-
-#ifdef STEPWAT
-            use_help_txt = use_help;
-            use_help_SXW = (Bool) (OutDom->timeSteps_SXW[k][i] != eSW_NoTime &&
-                                   writeit[OutDom->timeSteps_SXW[k][i]]);
-            use_help = (Bool) (use_help_txt || use_help_SXW);
 #endif
+        OutDom->pfunc_mem[k](outPeriod, sw, OutDom);
 
-            if (!use_help) {
-                continue; // don't call any `get_XXX` function
-            }
-
-#if defined(SOILWAT) && !defined(SWNETCDF)
+#elif defined(STEPWAT)
+        if (use_help_SXW) {
 #ifdef SWDEBUG
             if (debug) {
                 sw_printf(
-                    " call pfunc_text(%d=%s))", outPeriod, pd2str[outPeriod]
+                    " call pfunc_SXW(%d=%s))",
+                    OutDom->timeSteps_SXW[k][i],
+                    pd2str[OutDom->timeSteps_SXW[k][i]]
                 );
             }
 #endif
-            OutDom->pfunc_text[k](outPeriod, sw, LogInfo);
+            OutDom->pfunc_SXW[k](
+                OutDom->timeSteps_SXW[k][i], sw, OutDom, LogInfo
+            );
+            if (LogInfo->stopRun) {
+                return;
+            }
+        }
 
-#elif defined(RSOILWAT) || defined(SWNETCDF)
+        if (!use_help_txt) {
+            continue; // SXW output complete; skip to next output period
+        }
+
+        if (OutDom->prepare_IterationSummary) {
 #ifdef SWDEBUG
             if (debug) {
                 sw_printf(
-                    " call pfunc_mem(%d=%s))", outPeriod, pd2str[outPeriod]
+                    " call pfunc_agg(%d=%s))", outPeriod, pd2str[outPeriod]
                 );
             }
 #endif
-            OutDom->pfunc_mem[k](outPeriod, sw, OutDom);
+            OutDom->pfunc_agg[k](outPeriod, sw, OutDom, LogInfo);
+            if (LogInfo->stopRun) {
+                return;
+            }
+        }
 
-#elif defined(STEPWAT)
-            if (use_help_SXW) {
+        if (OutDom->print_SW_Output) {
+            outPeriod = OutDom->timeSteps[k][i];
 #ifdef SWDEBUG
-                if (debug) {
-                    sw_printf(
-                        " call pfunc_SXW(%d=%s))",
-                        OutDom->timeSteps_SXW[k][i],
-                        pd2str[OutDom->timeSteps_SXW[k][i]]
-                    );
-                }
-#endif
-                OutDom->pfunc_SXW[k](
-                    OutDom->timeSteps_SXW[k][i], sw, OutDom, LogInfo
+            if (debug) {
+                sw_printf(
+                    " call pfunc_text(%d=%s))", outPeriod, pd2str[outPeriod]
                 );
-                if (LogInfo->stopRun) {
-                    return;
-                }
             }
-
-            if (!use_help_txt) {
-                continue; // SXW output complete; skip to next output period
-            }
-
-            if (OutDom->prepare_IterationSummary) {
-#ifdef SWDEBUG
-                if (debug) {
-                    sw_printf(
-                        " call pfunc_agg(%d=%s))", outPeriod, pd2str[outPeriod]
-                    );
-                }
 #endif
-                OutDom->pfunc_agg[k](outPeriod, sw, OutDom, LogInfo);
-                if (LogInfo->stopRun) {
-                    return;
-                }
-            }
+            OutDom->pfunc_text[k](outPeriod, sw, LogInfo);
+        }
+#endif
+        if (LogInfo->stopRun) {
+            return;
+        }
 
-            if (OutDom->print_SW_Output) {
-                outPeriod = OutDom->timeSteps[k][i];
 #ifdef SWDEBUG
-                if (debug) {
-                    sw_printf(
-                        " call pfunc_text(%d=%s))", outPeriod, pd2str[outPeriod]
-                    );
-                }
+        if (debug) {
+            sw_printf(" ... ok");
+        }
 #endif
-                OutDom->pfunc_text[k](outPeriod, sw, LogInfo);
+
+#if defined(SW_OUTBIN)
+        /* add values to the current row of binary output files */
+        if (OutDom->useBinaryOutput) {
+            if (sw->OutRun.n_outval != OutDom->ncol_OUT[k]) {
+                LogError(
+                    LogInfo,
+                    LOGERROR,
+                    "%s: produced %d instead of %d binary output values.",
+                    key2str[k],
+                    sw->OutRun.n_outval,
+                    OutDom->ncol_OUT[k]
+                );
+                return; /* Exit prematurely due to error */
             }
-#endif
+
+            SW_OUTBIN_add_values(
+                OutDom->has_sl[k] ? sw->SW_PathOutputs.bin_soil[outPeriod] :
+                                    sw->SW_PathOutputs.bin_reg[outPeriod],
+                sw->OutRun.sw_outval,
+                sw->OutRun.n_outval,
+                LogInfo
+            );
             if (LogInfo->stopRun) {
-                return;
+                return; /* Exit prematurely due to error */
             }
 
-#ifdef SWDEBUG
-            if (debug) {
-                sw_printf(" ... ok");
-            }
+            continue; // no `csv` output
+        }
 #endif
 
 #if defined(SW_OUTTEXT)
-            /* concatenate formatted output for one row of `csv`- files */
-            if (OutDom->print_SW_Output) {
-                (void) sw_memccpy(
-                    tempstr,
-                    sw->OutRun.sw_outstr,
+        /* concatenate formatted output for one row of `csv`- files */
+        if (OutDom->print_SW_Output) {
+            (void) sw_memccpy(
+                tempstr,
+                sw->OutRun.sw_outstr,
+                '\0',
+                (size_t) (MAX_LAYERS * OUTSTRLEN)
+            );
+
+            if (OutDom->has_sl[k]) {
+                fullBuffer = sw_memccpy_inc(
+                    (void **) &soilWritePtr[outPeriod],
+                    (soilWritePtr[outPeriod] +
+                     sizeof soilWritePtr[outPeriod] - 1),
+                    (void *) tempstr,
                     '\0',
-                    (size_t) (MAX_LAYERS * OUTSTRLEN)
+                    &writeSizeSoil[outPeriod]
+                );
+            } else {
+                fullBuffer = sw_memccpy_inc(
+                    (void **) &regWritePtr[outPeriod],
+                    (regWritePtr[outPeriod] +
+                     sizeof regWritePtr[outPeriod] - 1),
+                    (void *) tempstr,
+                    '\0',
+                    &writeSizeReg[outPeriod]
                 );
-
-                if (OutDom->has_sl[k]) {
-                    fullBuffer = sw_memccpy_inc(
-                        (void **) &soilWritePtr[outPeriod],
-                        (soilWritePtr[outPeriod] +
-                         sizeof soilWritePtr[outPeriod] - 1),
-                        (void *) tempstr,
-                        '\0',
-                        &writeSizeSoil[outPeriod]
-                    );
-                } else {
-                    fullBuffer = sw_memccpy_inc(
-                        (void **) &regWritePtr[outPeriod],
-                        (regWritePtr[outPeriod] +
-                         sizeof regWritePtr[outPeriod] - 1),
-                        (void *) tempstr,
-                        '\0',
-                        &writeSizeReg[outPeriod]
-                    );
-                }
-                if (fullBuffer) {
-                    reportFullBuffer(LOGERROR, LogInfo);
-                    return;
-                }
             }
+            if (fullBuffer) {
+                reportFullBuffer(LOGERROR, LogInfo);
+                return;
+            }
+        }
 
 
 #ifdef STEPWAT
-            if (OutDom->print_IterationSummary) {
-                (void) sw_memccpy(
-                    tempstr,
-                    sw->OutRun.sw_outstr_agg,
+        if (OutDom->print_IterationSummary) {
+            (void) sw_memccpy(
+                tempstr,
+                sw->OutRun.sw_outstr_agg,
+                '\0',
+                (size_t) (MAX_LAYERS * OUTSTRLEN)
+            );
+
+            if (OutDom->has_sl[k]) {
+                fullBuffer = sw_memccpy_inc(
+                    (void **) &soilAggWritePtr[outPeriod],
+                    (soilAggWritePtr[outPeriod] +
+                     sizeof soilAggWritePtr[outPeriod] - 1),
+                    (void *) tempstr,
                     '\0',
-                    (size_t) (MAX_LAYERS * OUTSTRLEN)
+                    &writeSizeSoilAgg[outPeriod]
+                );
+            } else {
+                fullBuffer = sw_memccpy_inc(
+                    (void **) &regAggWritePtr[outPeriod],
+                    (regAggWritePtr[outPeriod] +
+                     sizeof regAggWritePtr[outPeriod] - 1),
+                    (void *) tempstr,
+                    '\0',
+                    &writeSizeRegAgg[outPeriod]
                 );
-
-                if (OutDom->has_sl[k]) {
-                    fullBuffer = sw_memccpy_inc(
-                        (void **) &soilAggWritePtr[outPeriod],
-                        (soilAggWritePtr[outPeriod] +
-                         sizeof soilAggWritePtr[outPeriod] - 1),
-                        (void *) tempstr,
-                        '\0',
-                        &writeSizeSoilAgg[outPeriod]
-                    );
-                } else {
-                    fullBuffer = sw_memccpy_inc(
-                        (void **) &regAggWritePtr[outPeriod],
-                        (regAggWritePtr[outPeriod] +
-                         sizeof regAggWritePtr[outPeriod] - 1),
-                        (void *) tempstr,
-                        '\0',
-                        &writeSizeRegAgg[outPeriod]
-                    );
-                }
-                if (fullBuffer) {
-                    reportFullBuffer(LOGERROR, LogInfo);
-                    return;
-                }
             }
+            if (fullBuffer) {
+                reportFullBuffer(LOGERROR, LogInfo);
+                return;
+            }
+        }
 #endif
 #else
-            (void) tempstr;
+        (void) tempstr;
 #endif
-        } // end of loop across `used_OUTNPERIODS`
-    } // end of loop across output keys
+    } // end of loop across active output key x output period combinations
 
 #if defined(SW_OUTTEXT)
     int fprintRes = 0;
@@ -3647,6 +4163,19 @@ void SW_OUT_write_today(
     // write formatted output to csv-files
     ForEachOutPeriod(p) {
         if (OutDom->use_OutPeriod[p] && writeit[p]) {
+#if defined(SW_OUTBIN)
+            if (OutDom->useBinaryOutput) {
+                SW_OUT_write_binrows(
+                    &sw->SW_PathOutputs, p, &sw->Model, tOffset, LogInfo
+                );
+                if (LogInfo->stopRun) {
+                    return; /* Exit prematurely due to error */
+                }
+
+                continue; // no `csv` output
+            }
+#endif
+
             get_outstrleader(p, sizeof str_time, &sw->Model, tOffset, str_time);
 
             if (sw->SW_PathOutputs.make_regular[p]) {
@@ -3667,9 +4196,11 @@ void SW_OUT_write_today(
                         return; /* Exit prematurely due to error */
                     }
 
+#ifdef STEPWAT
                     // STEPWAT2 needs a fflush for yearly output;
                     // other time steps, the soil-layer files, and SOILWAT2 work
-                    // fine without it...
+                    // fine without it (SOILWAT2 writes rows into a large
+                    // buffer that is flushed when full or when closed)
                     if (fflush(sw->SW_PathOutputs.fp_reg[p]) == EOF) {
                         LogError(
                             LogInfo,
@@ -3678,6 +4209,7 @@ void SW_OUT_write_today(
                         );
                         return; /* Exit prematurely due to error */
                     }
+#endif
                 }
 
 #ifdef STEPWAT
@@ -3755,6 +4287,15 @@ void SW_OUT_write_today(
     }
 #endif
 
+#if defined(SWNETCDF)
+    // Streaming output: write full output arrays to output netCDFs
+    if (OutDom->netCDFOutput.streamOutYears > 0) {
+        SW_NCOUT_stream_output(
+            OutDom, &sw->OutRun, &sw->SW_PathOutputs, swFALSE, LogInfo
+        );
+    }
+#endif
+
 #ifdef SWDEBUG
     if (debug) {
         sw_printf("'SW_OUT_write_today': completed\n");
@@ -3785,6 +4326,18 @@ void SW_OUT_create_files(
 #endif
 
 #if defined(SOILWAT) && defined(SW_OUTTEXT)
+#if defined(SW_OUTBIN)
+    if (SW_Domain->OutDom.useBinaryOutput) {
+        SW_OUT_create_binfiles(
+            &SW_Domain->OutDom,
+            SW_PathOutputs,
+            SW_Domain->SW_PathInputs.txtInFiles,
+            LogInfo
+        );
+        return;
+    }
+#endif
+
     SW_OUT_create_textfiles(
         &SW_Domain->OutDom,
         SW_PathOutputs,
@@ -3838,6 +4391,13 @@ void SW_OUT_close_files(
 ) {
 
 #if defined(SW_OUTTEXT)
+#if defined(SW_OUTBIN)
+    if (OutDom->useBinaryOutput) {
+        SW_OUT_close_binfiles(SW_PathOutputs, LogInfo);
+        return;
+    }
+#endif
+
     SW_OUT_close_textfiles(SW_PathOutputs, OutDom, LogInfo);
 #else
     (void) SW_PathOutputs;
@@ -4025,7 +4585,7 @@ void SW_OUTDOM_deepCopy(
     memcpy(dest, source, sizeof(*dest));
 
     ForEachOutKey(k) {
-        for (i = 0; i < 5 * NVEGTYPES + MAX_LAYERS; i++) {
+        for (i = 0; i < SW_OUTNMAXCOLS; i++) {
             if (!isnull(source->colnames_OUT[k][i])) {
 
                 dest->colnames_OUT[k][i] =
@@ -18,7 +18,7 @@ History:
 /*                INCLUDES / DEFINES                   */
 /* --------------------------------------------------- */
 
-#include "include/generic.h"        // for IntU
+#include "include/generic.h"        // for IntU, sw_format_fixed
 #include "include/myMemory.h"       // for sw_memccpy_custom
 #include "include/SW_datastructs.h" // for SW_RUN, SW_OUTTEXT
 #include "include/SW_Defines.h"     // for OUTSEP, OUT_DIGITS, OUTSTRLEN
@@ -49,6 +49,111 @@ History:
 /*             Local Function Definitions              */
 /* --------------------------------------------------- */
 
+#if defined(SW_OUTTEXT)
+/**
+@brief Append a value to an output string
+
+Formats #OUTSEP followed by the value with #OUT_DIGITS decimal digits
+(identical to `"%c%.*f"`) directly into the output string,
+see sw_format_fixed().
+
+If binary output is requested (see SW_OUT_RUN.useOutval), then
+the value is instead stored unformatted in SW_OUT_RUN.sw_outval.
+
+@param[in,out] OutRun Struct of type SW_OUT_RUN that holds output
+    information that may change throughout simulation runs;
+    NULL if the output string is not `sw_outstr`
+@param[in,out] writePtr Location where writing starts; returns the updated
+    location (of the terminating null character)
+@param[out] endOutstr End of the output string which is set to '\0'
+    if the output string is full
+@param[in] value Value to append
+@param[in,out] writeSize Number of bytes available at \p writePtr;
+    returns the updated number
+
+@return A flag specifying if the output string is full
+*/
+static Bool outstr_add_value(
+    SW_OUT_RUN *OutRun,
+    char **writePtr,
+    char *endOutstr,
+    double value,
+    size_t *writeSize
+) {
+    int n;
+
+#if defined(SW_OUTBIN)
+    if (!isnull(OutRun) && OutRun->useOutval) {
+        if (OutRun->n_outval >= SW_OUTNMAXCOLS) {
+            return swTRUE;
+        }
+
+        OutRun->sw_outval[OutRun->n_outval] = value;
+        OutRun->n_outval++;
+
+        return swFALSE;
+    }
+#else
+    (void) OutRun;
+#endif
+
+    n = sw_format_fixed(*writePtr, *writeSize, OUTSEP, value, OUT_DIGITS);
+
+    if (n < 0 || (size_t) n >= *writeSize) {
+        *endOutstr = '\0';
+        return swTRUE;
+    }
+
+    *writePtr += n;
+    *writeSize -= (size_t) n;
+
+    return swFALSE;
+}
+
+/**
+@brief Append an integer value to an output string
+
+Similar to outstr_add_value() but formatted as `"%c%d"`.
+
+@param[in,out] OutRun Struct of type SW_OUT_RUN that holds output
+    information that may change throughout simulation runs
+@param[in,out] writePtr Location where writing starts; returns the updated
+    location (of the terminating null character)
+@param[out] endOutstr End of the output string which is set to '\0'
+    if the output string is full
+@param[in] value Value to append
+@param[in,out] writeSize Number of bytes available at \p writePtr;
+    returns the updated number
+
+@return A flag specifying if the output string is full
+*/
+static Bool outstr_add_int(
+    SW_OUT_RUN *OutRun,
+    char **writePtr,
+    char *endOutstr,
+    int value,
+    size_t *writeSize
+) {
+    char str[OUTSTRLEN];
+
+#if defined(SW_OUTBIN)
+    if (OutRun->useOutval) {
+        return outstr_add_value(
+            OutRun, writePtr, endOutstr, (double) value, writeSize
+        );
+    }
+#else
+    (void) OutRun;
+#endif
+
+    (void) snprintf(str, OUTSTRLEN, "%c%d", OUTSEP, value);
+
+    return sw_memccpy_inc(
+        (void **) writePtr, endOutstr, (void *) str, '\0', writeSize
+    );
+}
+#endif
+
 #ifdef STEPWAT
 static void format_IterationSummary(
     double *p,
@@ -62,7 +167,6 @@ static void format_IterationSummary(
     IntUS i;
     size_t n;
     double sd;
-    char str[OUTSTRLEN];
     size_t writeSize = OUTSTRLEN;
     char *writePtr = sw->OutRun.sw_outstr_agg;
     char *endOutstrAgg =
@@ -74,20 +178,12 @@ static void format_IterationSummary(
         n = iOUT(i, OutRun->irow_OUT[pd], nrow_OUT[pd], ncol_TimeOUT[pd]);
         sd = final_running_sd(sw->Model.runModelIterations, psd[n]);
 
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            p[n],
-            OUTSEP,
-            OUT_DIGITS,
-            sd
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstrAgg, (void *) str, '\0', &writeSize
-        );
+        fullBuffer = (Bool) (outstr_add_value(
+                                 NULL, &writePtr, endOutstrAgg, p[n], &writeSize
+                             ) ||
+                             outstr_add_value(
+                                 NULL, &writePtr, endOutstrAgg, sd, &writeSize
+                             ));
         if (fullBuffer) {
             reportFullBuffer(LOGERROR, LogInfo);
             return;
@@ -109,7 +205,6 @@ static void format_IterationSummary2(
     LyrIndex i;
     size_t n;
     double sd;
-    char str[OUTSTRLEN];
     size_t strLen = strlen(sw->OutRun.sw_outstr_agg);
     size_t writeSize = OUTSTRLEN - strLen;
     char *writePtr = sw->OutRun.sw_outstr_agg + strLen;
@@ -125,24 +220,20 @@ static void format_IterationSummary2(
             );
             sd = final_running_sd(sw->Model.runModelIterations, psd[n]);
 
-            (void) snprintf(
-                str,
-                OUTSTRLEN,
-                "%c%.*f%c%.*f",
-                OUTSEP,
-                OUT_DIGITS,
-                p[n],
-                OUTSEP,
-                OUT_DIGITS,
-                sd
-            );
-            fullBuffer = sw_memccpy_inc(
-                (void **) &writePtr,
-                endOutstrAgg,
-                (void *) str,
-                '\0',
-                &writeSize
-            );
+            fullBuffer = (Bool) (outstr_add_value(
+                                     NULL,
+                                     &writePtr,
+                                     endOutstrAgg,
+                                     p[n],
+                                     &writeSize
+                                 ) ||
+                                 outstr_add_value(
+                                     NULL,
+                                     &writePtr,
+                                     endOutstrAgg,
+                                     sd,
+                                     &writeSize
+                                 ));
             if (fullBuffer) {
                 reportFullBuffer(LOGERROR, LogInfo);
                 return;
@@ -237,7 +328,6 @@ void get_co2effects_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     int k;
     SW_OUT_RUN *OutRun = &sw->OutRun;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     TimeInt simyear = sw->Model.simyear;
@@ -248,32 +338,24 @@ void get_co2effects_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     (void) pd; // hack to silence "-Wunused-parameter"
 
     ForEachVegType(k) {
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            sw->VegProd.veg[k].co2_multipliers[BIO_INDEX][simyear]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun,
+            &writePtr,
+            endOutstr,
+            sw->VegProd.veg[k].co2_multipliers[BIO_INDEX][simyear],
+            &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
         }
     }
     ForEachVegType(k) {
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            sw->VegProd.veg[k].co2_multipliers[WUE_INDEX][simyear]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun,
+            &writePtr,
+            endOutstr,
+            sw->VegProd.veg[k].co2_multipliers[WUE_INDEX][simyear],
+            &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -411,36 +493,23 @@ void get_biomass_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     // fCover for NVEGTYPES plus bare-ground
-    (void) snprintf(
-        str,
-        OUTSTRLEN,
-        "%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        sw->VegProd.bare_cov.fCover
-    );
-    (void) sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, sw->VegProd.bare_cov.fCover, &writeSize
     );
     if (fullBuffer) {
         goto reportFullBuffer;
     }
 
     ForEachVegType(k) {
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            sw->VegProd.veg[k].cov.fCover
-        );
-        (void) sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        (void) outstr_add_value(
+            OutRun,
+            &writePtr,
+            endOutstr,
+            sw->VegProd.veg[k].cov.fCover,
+            &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -448,61 +517,39 @@ void get_biomass_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     }
 
     // biomass (g/m2 as component of total) for NVEGTYPES plus totals and litter
-    (void
-    ) snprintf(str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->biomass_total);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->biomass_total, &writeSize
     );
     if (fullBuffer) {
         goto reportFullBuffer;
     }
 
     ForEachVegType(k) {
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->veg[k].biomass_inveg
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->veg[k].biomass_inveg, &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
         }
     }
-    (void
-    ) snprintf(str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->litter_total);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->litter_total, &writeSize
     );
     if (fullBuffer) {
         goto reportFullBuffer;
     }
 
     // biolive (g/m2 as component of total) for NVEGTYPES plus totals
-    (void
-    ) snprintf(str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->biolive_total);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->biolive_total, &writeSize
     );
     if (fullBuffer) {
         goto reportFullBuffer;
     }
 
     ForEachVegType(k) {
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->veg[k].biolive_inveg
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->veg[k].biolive_inveg, &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -510,9 +557,8 @@ void get_biomass_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     }
 
     // leaf area index [m2/m2]
-    (void) snprintf(str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->LAI);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->LAI, &writeSize
     );
 
 reportFullBuffer:
@@ -814,17 +860,17 @@ void get_estab_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     (void) pd; // silence `-Wunused-parameter`
 
     for (i = 0; i < sw->VegEstab.count; i++) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%d", OUTSEP, sw->VegEstab.parms[i]->estab_doy
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_int(
+            OutRun,
+            &writePtr,
+            endOutstr,
+            (int) sw->VegEstab.parms[i]->estab_doy,
+            &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -952,30 +998,28 @@ void get_estab_agg(
 void get_temp_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_WEATHER_OUTPUTS *vo = sw->Weather.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f%c%.*f%c%.*f%c%.*f%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->temp_max,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->temp_min,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->temp_avg,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceMax,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceMin,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceAvg
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->temp_max, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->temp_min, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->temp_avg, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->surfaceMax, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->surfaceMin, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->surfaceAvg, &writeSize
     );
 
     (void) LogInfo;
@@ -1188,27 +1232,19 @@ OUTTEXT.
 void get_precip_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_WEATHER_OUTPUTS *vo = sw->Weather.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f%c%.*f%c%.*f%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->ppt,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->rain,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->snow,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->snowmelt,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->snowloss
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->ppt, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->rain, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->snow, &writeSize);
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->snowmelt, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->snowloss, &writeSize
     );
 
     (void) LogInfo;
@@ -1409,21 +1445,16 @@ void get_vwcBulk_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
         /* vwcBulk at this point is identical to swcBulk */
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->vwcBulk[i] / sw->Site.soils.width[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun,
+            &writePtr,
+            endOutstr,
+            vo->vwcBulk[i] / sw->Site.soils.width[i],
+            &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -1567,7 +1598,6 @@ void get_vwcMatric_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
@@ -1575,16 +1605,8 @@ void get_vwcMatric_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
         convert = 1. / (1. - sw->Site.soils.fractionVolBulk_gravel[i]) /
                   sw->Site.soils.width[i];
 
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->vwcMatric[i] * convert
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->vwcMatric[i] * convert, &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -1732,21 +1754,12 @@ void get_swa_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachVegType(k) {
         ForEachSoilLayer(i, sw->Site.n_layers) {
-            (void) snprintf(
-                str,
-                OUTSTRLEN,
-                "%c%.*f",
-                OUTSEP,
-                OUT_DIGITS,
-                vo->SWA_VegType[k][i]
-            );
-            fullBuffer = sw_memccpy_inc(
-                (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+            fullBuffer = outstr_add_value(
+                OutRun, &writePtr, endOutstr, vo->SWA_VegType[k][i], &writeSize
             );
             if (fullBuffer) {
                 goto reportFullBuffer;
@@ -1891,15 +1904,11 @@ void get_swcBulk_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->swcBulk[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->swcBulk[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -2075,7 +2084,6 @@ void get_swpMatric_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     LOG_INFO local_log;
     local_log.logfp = NULL;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
@@ -2083,9 +2091,8 @@ void get_swpMatric_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
         val = SW_SWRC_SWCtoSWP(vo->swpMatric[i], &sw->Site, i, &local_log);
 
 
-        (void) snprintf(str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, val);
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, val, &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -2228,15 +2235,11 @@ void get_swaBulk_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->swaBulk[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->swaBulk[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -2371,23 +2374,14 @@ void get_swaMatric_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
         /* swaMatric at this point is identical to swaBulk */
         convert = 1. / (1. - sw->Site.soils.fractionVolBulk_gravel[i]);
 
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->swaMatric[i] * convert
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->swaMatric[i] * convert, &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -2525,15 +2519,13 @@ void get_swaMatric_agg(
 void get_surfaceWater_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_SOILWAT_OUTPUTS *vo = sw->SoilWat.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceWater
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->surfaceWater, &writeSize
     );
 
     (void) LogInfo;
@@ -2634,26 +2626,22 @@ void get_runoffrunon_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     double net;
     SW_WEATHER_OUTPUTS *vo = sw->Weather.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     net = vo->surfaceRunoff + vo->snowRunoff - vo->surfaceRunon;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f%c%.*f%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        net,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceRunoff,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->snowRunoff,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceRunon
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, net, &writeSize);
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->surfaceRunoff, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->snowRunoff, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->surfaceRunon, &writeSize
     );
 
     (void) LogInfo;
@@ -2812,16 +2800,12 @@ void get_transp_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN] = {'\0'};
     OutRun->sw_outstr[0] = '\0';
 
     /* total transpiration */
     ForEachSoilLayer(i, n_layers) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->transp_total[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->transp_total[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -2831,11 +2815,8 @@ void get_transp_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     /* transpiration for each vegetation type */
     ForEachVegType(k) {
         ForEachSoilLayer(i, n_layers) {
-            (void) snprintf(
-                str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->transp[k][i]
-            );
-            fullBuffer = sw_memccpy_inc(
-                (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+            fullBuffer = outstr_add_value(
+                OutRun, &writePtr, endOutstr, vo->transp[k][i], &writeSize
             );
             if (fullBuffer) {
                 goto reportFullBuffer;
@@ -3076,15 +3057,11 @@ void get_evapSoil_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachEvapLayer(i, sw->Site.n_evap_lyrs) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->evap_baresoil[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->evap_baresoil[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -3221,44 +3198,32 @@ void get_evapSurface_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
-    (void
-    ) snprintf(str, sizeof str, "%c%.*f", OUTSEP, OUT_DIGITS, vo->total_evap);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->total_evap, &writeSize
     );
     if (fullBuffer) {
         goto reportFullBuffer;
     }
 
     ForEachVegType(k) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->evap_veg[k]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->evap_veg[k], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
         }
     }
 
-    (void) snprintf(
-        str,
-        OUTSTRLEN,
-        "%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->litter_evap,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->surfaceWater_evap
-    );
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->litter_evap, &writeSize
     );
+    if (!fullBuffer) {
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->surfaceWater_evap, &writeSize
+        );
+    }
 
 reportFullBuffer:
     if (fullBuffer) {
@@ -3442,34 +3407,26 @@ void get_interception_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
-    (void
-    ) snprintf(str, sizeof str, "%c%.*f", OUTSEP, OUT_DIGITS, vo->total_int);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->total_int, &writeSize
     );
     if (fullBuffer) {
         goto reportFullBuffer;
     }
 
     ForEachVegType(k) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->int_veg[k]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->int_veg[k], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
         }
     }
 
-    (void
-    ) snprintf(str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->litter_int);
-    fullBuffer = sw_memccpy_inc(
-        (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+    fullBuffer = outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->litter_int, &writeSize
     );
 
 reportFullBuffer:
@@ -3628,15 +3585,13 @@ void get_soilinf_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
      * get_runoffrunon(); */
     SW_WEATHER_OUTPUTS *vo = sw->Weather.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->soil_inf
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->soil_inf, &writeSize
     );
 
     (void) LogInfo;
@@ -3742,15 +3697,11 @@ void get_lyrdrain_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     for (i = 0; i < sw->Site.n_layers - 1; i++) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->lyrdrain[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->lyrdrain[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -3889,16 +3840,12 @@ void get_hydred_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     /* total hydraulic redistribution */
     ForEachSoilLayer(i, n_layers) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->hydred_total[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->hydred_total[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -3908,11 +3855,8 @@ void get_hydred_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     /* hydraulic redistribution for each vegetation type */
     ForEachVegType(k) {
         ForEachSoilLayer(i, n_layers) {
-            (void) snprintf(
-                str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->hydred[k][i]
-            );
-            fullBuffer = sw_memccpy_inc(
-                (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+            fullBuffer = outstr_add_value(
+                OutRun, &writePtr, endOutstr, vo->hydred[k][i], &writeSize
             );
             if (fullBuffer) {
                 goto reportFullBuffer;
@@ -4115,30 +4059,26 @@ void get_aet_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_SOILWAT_OUTPUTS *vo = sw->SoilWat.p_oagg[pd];
     SW_WEATHER_OUTPUTS *vo2 = sw->Weather.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f%c%.*f%c%.*f%c%.*f%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->aet,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->tran,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->esoil,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->ecnw,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->esurf,
-        OUTSEP,
-        OUT_DIGITS,
-        vo2->snowloss // should be `vo->esnow`
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->aet, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->tran, &writeSize);
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->esoil, &writeSize
+    );
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->ecnw, &writeSize);
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->esurf, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun,
+        &writePtr,
+        endOutstr,
+        vo2->snowloss, // should be `vo->esnow`
+        &writeSize
     );
 
     (void) LogInfo;
@@ -4339,28 +4279,16 @@ OUTTEXT
 void get_pet_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_SOILWAT_OUTPUTS *vo = sw->SoilWat.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f%c%.*f%c%.*f%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->pet,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->H_oh,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->H_ot,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->H_gh,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->H_gt
-    );
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->pet, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->H_oh, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->H_ot, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->H_gh, &writeSize);
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->H_gt, &writeSize);
 
     (void) LogInfo;
 }
@@ -4515,16 +4443,16 @@ void get_wetdays_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     if (pd == eSW_Day) {
         ForEachSoilLayer(i, n_layers) {
-            (void) snprintf(
-                str, OUTSTRLEN, "%c%i", OUTSEP, (sw->SoilWat.is_wet[i]) ? 1 : 0
-            );
-            fullBuffer = sw_memccpy_inc(
-                (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+            fullBuffer = outstr_add_int(
+                OutRun,
+                &writePtr,
+                endOutstr,
+                (sw->SoilWat.is_wet[i]) ? 1 : 0,
+                &writeSize
             );
             if (fullBuffer) {
                 goto reportFullBuffer;
@@ -4535,10 +4463,8 @@ void get_wetdays_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
         SW_SOILWAT_OUTPUTS *vo = sw->SoilWat.p_oagg[pd];
 
         ForEachSoilLayer(i, n_layers) {
-            (void
-            ) snprintf(str, OUTSTRLEN, "%c%i", OUTSEP, (int) vo->wetdays[i]);
-            fullBuffer = sw_memccpy_inc(
-                (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+            fullBuffer = outstr_add_int(
+                OutRun, &writePtr, endOutstr, (int) vo->wetdays[i], &writeSize
             );
             if (fullBuffer) {
                 goto reportFullBuffer;
@@ -4690,18 +4616,16 @@ void get_wetdays_agg(
 void get_snowpack_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_SOILWAT_OUTPUTS *vo = sw->SoilWat.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->snowpack,
-        OUTSEP,
-        OUT_DIGITS,
-        vo->snowdepth
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->snowpack, &writeSize
+    );
+    (void) outstr_add_value(
+        OutRun, &writePtr, endOutstr, vo->snowdepth, &writeSize
     );
 
     (void) LogInfo;
@@ -4816,16 +4740,12 @@ void get_snowpack_agg(
 void get_deepswc_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     SW_SOILWAT_OUTPUTS *vo = sw->SoilWat.p_oagg[pd];
     SW_OUT_RUN *OutRun = &sw->OutRun;
+    size_t writeSize = (size_t) (MAX_LAYERS * OUTSTRLEN);
+    char *writePtr = OutRun->sw_outstr;
+    char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
 
     OutRun->sw_outstr[0] = '\0';
-    (void) snprintf(
-        OutRun->sw_outstr,
-        sizeof OutRun->sw_outstr,
-        "%c%.*f",
-        OUTSEP,
-        OUT_DIGITS,
-        vo->deep
-    );
+    (void) outstr_add_value(OutRun, &writePtr, endOutstr, vo->deep, &writeSize);
 
     (void) LogInfo;
 }
@@ -4929,45 +4849,25 @@ void get_soiltemp_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->maxLyrTemperature[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->maxLyrTemperature[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
         }
 
-        (void) snprintf(
-            str,
-            OUTSTRLEN,
-            "%c%.*f",
-            OUTSEP,
-            OUT_DIGITS,
-            vo->minLyrTemperature[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->minLyrTemperature[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
         }
 
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->avgLyrTemp[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->avgLyrTemp[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -5181,15 +5081,11 @@ void get_frozen_text(OutPeriod pd, SW_RUN *sw, LOG_INFO *LogInfo) {
     char *endOutstr = OutRun->sw_outstr + sizeof OutRun->sw_outstr - 1;
     Bool fullBuffer = swFALSE;
 
-    char str[OUTSTRLEN];
     OutRun->sw_outstr[0] = '\0';
 
     ForEachSoilLayer(i, sw->Site.n_layers) {
-        (void) snprintf(
-            str, OUTSTRLEN, "%c%.*f", OUTSEP, OUT_DIGITS, vo->lyrFrozen[i]
-        );
-        fullBuffer = sw_memccpy_inc(
-            (void **) &writePtr, endOutstr, (void *) str, '\0', &writeSize
+        fullBuffer = outstr_add_value(
+            OutRun, &writePtr, endOutstr, vo->lyrFrozen[i], &writeSize
         );
         if (fullBuffer) {
             goto reportFullBuffer;
@@ -0,0 +1,1205 @@
+/********************************************************/
+/********************************************************/
+/**
+@file
+@brief Output functionality for binary columnar output files
+
+SOILWAT2-standalone writes binary columnar output files instead of
+`csv` files if `outsetup.in` contains the line `OUTFORMAT binary`
+(or `OUTFORMAT binary compress`). Each binary file holds the same
+columns as the corresponding `csv` file; values are stored unformatted
+(i.e., with full precision) and the file name uses the extension
+#SW_OUTBIN_EXT instead of the extension of the `csv` file name.
+
+File format (numbers are stored in the byte order of the writing machine
+which is identified by the byte-order mark):
+    - Header
+        - `char[8]` magic "SW2OUTB"
+        - `uint32` format version (currently, 1)
+        - `uint32` byte-order mark `0x01020304`
+        - `uint32` output time step (`OutPeriod`)
+        - `uint32` number of columns `ncol`
+        - `uint32` number of leading time columns `ntime`
+        - string: name of output time step (e.g., "Day")
+        - for each column: `uint8` column type
+          (#SW_OUTBIN_INT32 or #SW_OUTBIN_FLOAT64), string: column name,
+          string: units
+    - Blocks of rows (repeated)
+        - `uint32` number of rows of the block (larger than 0)
+        - for each column: `uint8` encoding, `uint32` number of bytes,
+          encoded values of the column
+    - End of file: `uint32` 0
+
+A string is stored as `uint16` length followed by the characters
+(without terminating null character).
+
+Column encodings:
+    - 0 (raw): one value of the column type for each row
+    - 1 (constant): one value of the column type for all rows
+    - 2 (xor): the bit pattern of each value is XORed with the bit pattern
+      of the previous value of the block (zero for the first value);
+      the result is stored as one byte with the number of significant bytes
+      followed by these bytes (least significant byte first)
+
+Encodings 1 and 2 are only used if compression is requested and
+if they are smaller than the raw encoding.
+
+A reader for R is available in
+`tools/rscripts/Rscript__SW2_read_binary_output.R`.
+*/
+/********************************************************/
+/********************************************************/
+
+
+/* =================================================== */
+/*                INCLUDES / DEFINES                   */
+/* --------------------------------------------------- */
+
+#include "include/SW_Output_outbin.h" // for SW_OUTBIN_open, SW_OUTBIN_read
+#include "include/filefuncs.h"        // for LogError, OpenFile, CloseFile
+#include "include/generic.h"          // for Bool, swFALSE, swTRUE, LOGERROR
+#include "include/myMemory.h"         // for Mem_Malloc, Mem_Calloc, Str_Dup
+#include "include/SW_datastructs.h"   // for SW_OUTBIN_FILE, LOG_INFO
+#include "include/SW_Defines.h"       // for OutPeriod, SW_OUTBUFSIZE
+#include <stdint.h>                   // for uint16_t, uint32_t, uint64_t
+#include <stdio.h>                    // for FILE, fread, fwrite, snprintf
+#include <stdlib.h>                   // for free
+#include <string.h>                   // for memcpy, memcmp, strlen
+
+#if defined(SW_OUTBIN)
+#include "include/SW_Files.h"  // for eOutputDaily, eOutputDaily_soil
+#include "include/SW_Output.h" // for key2str, pd2longstr, ForEachOutKey
+#endif
+
+
+/* =================================================== */
+/*                  Local Variables                    */
+/* --------------------------------------------------- */
+
+static const char outbinMagic[8] = "SW2OUTB";
+static const uint32_t outbinVersion = 1;
+static const uint32_t outbinBOM = 0x01020304;
+
+static const unsigned char outbinEncRaw = 0;
+static const unsigned char outbinEncConst = 1;
+static const unsigned char outbinEncXor = 2;
+
+#if defined(SW_OUTBIN)
+/** Units of output variables (in the order of variables of each output key;
+    see `SW2 units` in `SW2_netCDF_output_variables.tsv`) */
+static const char *const units_OUT[SW_OUTNKEYS][SW_OUTNMAXVARS] = {
+    {NULL}, // eSW_AllWthr
+    {"degC", "degC", "degC", "degC", "degC", "degC"},
+    {"cm", "cm", "cm", "cm", "cm"},
+    {"cm"},
+    {"cm", "cm", "cm", "cm"},
+    {NULL}, // eSW_AllH2O
+    {"cm cm-1"},
+    {"cm cm-1"},
+    {"cm"},
+    {"cm"},
+    {"cm"},
+    {"cm"},
+    {"-1bar"},
+    {"cm"},
+    {"cm", "cm"},
+    {"cm"},
+    {"cm", "cm", "cm", "cm"},
+    {"cm", "cm", "cm"},
+    {"cm"},
+    {"cm", "cm"},
+    {NULL}, // eSW_ET
+    {"cm", "cm", "cm", "cm", "cm", "cm"},
+    {"cm", "MJ m-2", "MJ m-2", "MJ m-2", "MJ m-2"},
+    {"1"},
+    {"cm", "cm"},
+    {"cm"},
+    {"degC", "degC", "degC"},
+    {"1"},
+    {NULL}, // eSW_AllVeg
+    {"1", "1", "1", "1", "1", "1", "1", "1"},
+    {"1", "1"},
+    {"1", "1", "g m-2", "g m-2", "g m-2", "g m-2", "g m-2", "m m-2"}
+};
+
+/** Units of time columns */
+static const char *const units_TimeOUT[SW_OUTNPERIODS] = {
+    "day of year", "week of year", "month of year", "year"
+};
+#endif
+
+
+/* =================================================== */
+/*             Local Function Definitions              */
+/* --------------------------------------------------- */
+
+/** Number of bytes used by a value of a column type */
+static size_t outbin_width(unsigned char type) {
+    return (type == SW_OUTBIN_INT32) ? sizeof(int32_t) : sizeof(double);
+}
+
+/** Convert a value of a column type from its bit pattern */
+static double outbin_frombits(uint64_t bits, unsigned char type) {
+    uint32_t ubits;
+    int32_t ivalue;
+    double value;
+
+    if (type == SW_OUTBIN_INT32) {
+        ubits = (uint32_t) bits;
+        memcpy(&ivalue, &ubits, sizeof ivalue);
+        value = (double) ivalue;
+    } else {
+        memcpy(&value, &bits, sizeof value);
+    }
+
+    return value;
+}
+
+/** Decode one column of a block
+
+@param[in] enc Encoding of the column
+@param[in] src Encoded values
+@param[in] nbytes Number of bytes of \p src
+@param[in] nrow Number of rows of the block
+@param[in] type Column type
+@param[out] dest Decoded values
+
+@return swTRUE if \p src is a valid encoding of \p nrow values
+*/
+static Bool outbin_decode_column(
+    unsigned char enc,
+    const unsigned char *src,
+    size_t nbytes,
+    uint32_t nrow,
+    unsigned char type,
+    double *dest
+) {
+    size_t width = outbin_width(type);
+    size_t pos = 0;
+    size_t b;
+    size_t nsig;
+    uint32_t i;
+    uint64_t bits = 0;
+    uint64_t ubits;
+    int32_t ivalue;
+    double value;
+
+    if (enc == outbinEncRaw) {
+        if (nbytes != (size_t) nrow * width) {
+            return swFALSE;
+        }
+
+        for (i = 0; i < nrow; i++) {
+            if (type == SW_OUTBIN_INT32) {
+                memcpy(&ivalue, src + pos, sizeof ivalue);
+                dest[i] = (double) ivalue;
+            } else {
+                memcpy(&dest[i], src + pos, sizeof(double));
+            }
+            pos += width;
+        }
+
+    } else if (enc == outbinEncConst) {
+        if (nbytes != width) {
+            return swFALSE;
+        }
+
+        if (type == SW_OUTBIN_INT32) {
+            memcpy(&ivalue, src, sizeof ivalue);
+            value = (double) ivalue;
+        } else {
+            memcpy(&value, src, sizeof value);
+        }
+
+        for (i = 0; i < nrow; i++) {
+            dest[i] = value;
+        }
+
+    } else if (enc == outbinEncXor) {
+        for (i = 0; i < nrow; i++) {
+            if (pos >= nbytes) {
+                return swFALSE;
+            }
+            nsig = src[pos];
+            pos++;
+
+            if (nsig > width || pos + nsig > nbytes) {
+                return swFALSE;
+            }
+
+            ubits = 0;
+            for (b = 0; b < nsig; b++) {
+                ubits |= (uint64_t) src[pos] << (8 * b);
+                pos++;
+            }
+
+            bits ^= ubits;
+            dest[i] = outbin_frombits(bits, type);
+        }
+
+        if (pos != nbytes) {
+            return swFALSE;
+        }
+
+    } else {
+        return swFALSE;
+    }
+
+    return swTRUE;
+}
+
+/** Read a string (length followed by characters) and allocate memory */
+static char *outbin_read_string(FILE *fp, LOG_INFO *LogInfo) {
+    uint16_t len;
+    char *str = NULL;
+
+    if (fread(&len, sizeof len, 1, fp) != 1) {
+        return NULL;
+    }
+
+    str = (char *) Mem_Malloc(
+        (size_t) len + 1, "outbin_read_string()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return NULL; // Exit function prematurely due to error
+    }
+
+    if (len > 0 && fread(str, 1, len, fp) != len) {
+        free(str);
+        return NULL;
+    }
+    str[len] = '\0';
+
+    return str;
+}
+
+#if defined(SW_OUTBIN)
+/** Bit pattern of a value of a column type */
+static uint64_t outbin_tobits(double value, unsigned char type) {
+    uint64_t bits;
+    uint32_t ubits;
+    int32_t ivalue;
+
+    if (type == SW_OUTBIN_INT32) {
+        ivalue = (int32_t) value;
+        memcpy(&ubits, &ivalue, sizeof ubits);
+        bits = ubits;
+    } else {
+        memcpy(&bits, &value, sizeof bits);
+    }
+
+    return bits;
+}
+
+/** Encode one column of a block
+
+@param[in] values Values of the column
+@param[in] nrow Number of rows of the block
+@param[in] type Column type
+@param[in] compress Use the smallest of the available encodings
+    (otherwise, raw encoding)
+@param[out] dest Encoded values (at least `nrow` times the width of
+    the column type)
+@param[out] enc Encoding of the column
+
+@return Number of bytes written to \p dest
+*/
+static size_t outbin_encode_column(
+    const double *values,
+    uint32_t nrow,
+    unsigned char type,
+    Bool compress,
+    unsigned char *dest,
+    unsigned char *enc
+) {
+    size_t width = outbin_width(type);
+    size_t nraw = (size_t) nrow * width;
+    size_t n = 0;
+    size_t nsig;
+    uint32_t i;
+    uint64_t bits;
+    uint64_t prev = 0;
+    uint64_t ubits;
+    int32_t ivalue;
+
+    if (compress) {
+        // Constant column
+        bits = outbin_tobits(values[0], type);
+        for (i = 1; i < nrow && outbin_tobits(values[i], type) == bits; i++) {
+        }
+
+        if (i == nrow) {
+            ubits = bits;
+            if (type == SW_OUTBIN_INT32) {
+                ivalue = (int32_t) values[0];
+                memcpy(dest, &ivalue, sizeof ivalue);
+            } else {
+                memcpy(dest, &values[0], sizeof(double));
+            }
+            *enc = outbinEncConst;
+            return width;
+        }
+
+        // XOR with previous value; stop if not smaller than raw encoding
+        for (i = 0; i < nrow; i++) {
+            bits = outbin_tobits(values[i], type);
+            ubits = bits ^ prev;
+            prev = bits;
+
+            for (nsig = 0; nsig < width && (ubits >> (8 * nsig)) != 0;
+                 nsig++) {
+            }
+
+            if (n + 1 + nsig >= nraw) {
+                break;
+            }
+
+            dest[n] = (unsigned char) nsig;
+            n++;
+            for (; nsig > 0; nsig--) {
+                dest[n] = (unsigned char) (ubits & 0xFF);
+                ubits >>= 8;
+                n++;
+            }
+        }
+
+        if (i == nrow) {
+            *enc = outbinEncXor;
+            return n;
+        }
+    }
+
+    // Raw values
+    n = 0;
+    for (i = 0; i < nrow; i++) {
+        if (type == SW_OUTBIN_INT32) {
+            ivalue = (int32_t) values[i];
+            memcpy(dest + n, &ivalue, sizeof ivalue);
+        } else {
+            memcpy(dest + n, &values[i], sizeof(double));
+        }
+        n += width;
+    }
+
+    *enc = outbinEncRaw;
+    return n;
+}
+
+/** Write a string (length followed by characters) */
+static Bool outbin_write_string(FILE *fp, const char *str) {
+    size_t len = strlen(str);
+    uint16_t len16 = (uint16_t) len;
+
+    return (Bool) (len <= UINT16_MAX &&
+                   fwrite(&len16, sizeof len16, 1, fp) == 1 &&
+                   fwrite(str, 1, len, fp) == len);
+}
+
+/** Write the complete rows of the current block to disk */
+static void outbin_write_block(SW_OUTBIN_FILE *bf, LOG_INFO *LogInfo) {
+    uint32_t nrow = bf->nrow;
+    uint32_t nbytes;
+    unsigned int icol;
+    unsigned char type;
+    unsigned char enc;
+    size_t n;
+    Bool ok;
+
+    if (nrow == 0) {
+        return;
+    }
+
+    ok = (Bool) (fwrite(&nrow, sizeof nrow, 1, bf->fp) == 1);
+
+    for (icol = 0; ok && icol < bf->ncol; icol++) {
+        type = (icol < bf->ntime) ? SW_OUTBIN_INT32 : SW_OUTBIN_FLOAT64;
+
+        n = outbin_encode_column(
+            bf->values + (size_t) icol * bf->nrowBlock,
+            nrow,
+            type,
+            bf->compress,
+            bf->encBuffer,
+            &enc
+        );
+        nbytes = (uint32_t) n;
+
+        ok = (Bool) (fwrite(&enc, 1, 1, bf->fp) == 1 &&
+                     fwrite(&nbytes, sizeof nbytes, 1, bf->fp) == 1 &&
+                     fwrite(bf->encBuffer, 1, n, bf->fp) == n);
+    }
+
+    if (!ok) {
+        LogError(LogInfo, LOGERROR, "Could not write binary output file.");
+    }
+
+    bf->nrow = 0;
+}
+
+/** Create name of binary output file from name of `csv` output file */
+static void outbin_filename(
+    const char *csvName, char *fname, size_t sizeof_fname, LOG_INFO *LogInfo
+) {
+    const char *ext = strrchr(csvName, '.');
+    const char *sep = strrchr(csvName, '/');
+    int lenBase;
+    int resSNP;
+
+    if (isnull(ext) || (!isnull(sep) && ext < sep)) {
+        lenBase = (int) strlen(csvName);
+    } else {
+        lenBase = (int) (ext - csvName);
+    }
+
+    resSNP = snprintf(
+        fname, sizeof_fname, "%.*s.%s", lenBase, csvName, SW_OUTBIN_EXT
+    );
+    if (resSNP < 0 || (unsigned) resSNP >= sizeof_fname) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Binary output file name is too long: '%s'.",
+            csvName
+        );
+    }
+}
+
+/** Units of a column of an output key
+
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[in] k Output key
+@param[in] icol Column (base0) of the output key
+
+@return Units of the variable to which the column belongs
+*/
+static const char *outbin_units(SW_OUT_DOM *OutDom, OutKey k, IntUS icol) {
+    IntUS ivar;
+    IntUS ncol;
+    IntUS iunit;
+    unsigned int csum = 0;
+
+    for (ivar = 0; ivar < OutDom->nvar_OUT[k]; ivar++) {
+        ncol = 1;
+        iunit = SW_OUTNMAXVARS - 1;
+
+        if (ivar < SW_OUTNMAXVARS) {
+            iunit = ivar;
+
+            if (OutDom->nsl_OUT[k][ivar] > 0) {
+                ncol = OutDom->nsl_OUT[k][ivar];
+            }
+            if (OutDom->npft_OUT[k][ivar] > 0) {
+                ncol *= OutDom->npft_OUT[k][ivar];
+            }
+        }
+
+        csum += ncol;
+        if (icol < csum) {
+            return isnull(units_OUT[k][iunit]) ? "" : units_OUT[k][iunit];
+        }
+    }
+
+    return "";
+}
+
+/** Create and open one binary output file with columns of all output keys
+    that are active for an output period and match \p isSoil */
+static void outbin_create_file(
+    SW_OUT_DOM *OutDom,
+    OutPeriod pd,
+    Bool isSoil,
+    const char *csvName,
+    SW_OUTBIN_FILE **bf,
+    LOG_INFO *LogInfo
+) {
+    char fname[FILENAME_MAX];
+    char ctemp[MAX_FILENAMESIZE];
+    char **colnames = NULL;
+    char **units = NULL;
+    unsigned int ncol;
+    unsigned int ntime = (pd == eSW_Year) ? 1 : 2;
+    unsigned int icol;
+    IntUS i;
+    int k;
+    int resSNP;
+
+    outbin_filename(csvName, fname, sizeof fname, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    // Count columns
+    ncol = ntime;
+    ForEachOutKey(k) {
+        if (OutDom->use[k] && OutDom->has_sl[k] == isSoil &&
+            has_OutPeriod_inUse(
+                pd, (OutKey) k, OutDom->used_OUTNPERIODS, OutDom->timeSteps
+            )) {
+            ncol += OutDom->ncol_OUT[k];
+        }
+    }
+
+    colnames = (char **) Mem_Calloc(
+        ncol, sizeof(char *), "outbin_create_file()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    units = (char **) Mem_Calloc(
+        ncol, sizeof(char *), "outbin_create_file()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto freeMem;
+    }
+
+    // Time columns
+    colnames[0] = Str_Dup(SW_YEAR_LONG, LogInfo);
+    units[0] = (char *) units_TimeOUT[eSW_Year];
+    if (ntime > 1 && !LogInfo->stopRun) {
+        colnames[1] = Str_Dup(pd2longstr[pd], LogInfo);
+        units[1] = (char *) units_TimeOUT[pd];
+    }
+    if (LogInfo->stopRun) {
+        goto freeMem;
+    }
+
+    // Value columns (same order as `csv` output)
+    icol = ntime;
+    ForEachOutKey(k) {
+        if (OutDom->use[k] && OutDom->has_sl[k] == isSoil &&
+            has_OutPeriod_inUse(
+                pd, (OutKey) k, OutDom->used_OUTNPERIODS, OutDom->timeSteps
+            )) {
+            for (i = 0; i < OutDom->ncol_OUT[k]; i++) {
+                resSNP = snprintf(
+                    ctemp,
+                    sizeof ctemp,
+                    "%s_%s",
+                    key2str[k],
+                    OutDom->colnames_OUT[k][i]
+                );
+                if (resSNP < 0 || (unsigned) resSNP >= sizeof ctemp) {
+                    LogError(
+                        LogInfo,
+                        LOGERROR,
+                        "Binary output column name is too long: '%s'.",
+                        OutDom->colnames_OUT[k][i]
+                    );
+                    goto freeMem;
+                }
+
+                colnames[icol] = Str_Dup(ctemp, LogInfo);
+                if (LogInfo->stopRun) {
+                    goto freeMem;
+                }
+                units[icol] = (char *) outbin_units(OutDom, (OutKey) k, i);
+                icol++;
+            }
+        }
+    }
+
+    *bf = (SW_OUTBIN_FILE *) Mem_Malloc(
+        sizeof(SW_OUTBIN_FILE), "outbin_create_file()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto freeMem;
+    }
+
+    SW_OUTBIN_open(
+        *bf,
+        fname,
+        pd,
+        ncol,
+        ntime,
+        colnames,
+        units,
+        OutDom->compressBinaryOutput,
+        LogInfo
+    );
+
+freeMem:
+    if (!isnull(colnames)) {
+        for (icol = 0; icol < ncol; icol++) {
+            free(colnames[icol]);
+        }
+        free((void *) colnames);
+    }
+    free((void *) units);
+}
+#endif
+
+
+/* =================================================== */
+/*             Global Function Definitions             */
+/* --------------------------------------------------- */
+
+#if defined(SW_OUTBIN)
+/**
+@brief Create a binary columnar output file and write its header
+
+@param[out] bf Binary output file
+@param[in] fname Name of the file
+@param[in] pd Output time step
+@param[in] ncol Number of columns (time and value columns)
+@param[in] ntime Number of leading (integer) time columns
+@param[in] colnames Names of the columns (array of length \p ncol)
+@param[in] units Units of the columns (array of length \p ncol)
+@param[in] compress Encode columns to reduce file size
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUTBIN_open(
+    SW_OUTBIN_FILE *bf,
+    const char *fname,
+    OutPeriod pd,
+    unsigned int ncol,
+    unsigned int ntime,
+    char *colnames[],
+    char *units[],
+    Bool compress,
+    LOG_INFO *LogInfo
+) {
+    uint32_t header[5];
+    unsigned int icol;
+    unsigned char type;
+    size_t nrowBlock;
+    Bool ok;
+
+    bf->fp = NULL;
+    bf->ncol = ncol;
+    bf->ntime = ntime;
+    bf->nrow = 0;
+    bf->icol = ntime;
+    bf->compress = compress;
+    bf->values = NULL;
+    bf->encBuffer = NULL;
+
+    // Rows of a block occupy about SW_OUTBUFSIZE bytes
+    nrowBlock = SW_OUTBUFSIZE / ((size_t) ncol * sizeof(double));
+    bf->nrowBlock = (nrowBlock > 0) ? (unsigned int) nrowBlock : 1;
+
+    bf->values = (double *) Mem_Malloc(
+        (size_t) ncol * bf->nrowBlock * sizeof(double),
+        "SW_OUTBIN_open()",
+        LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    bf->encBuffer = (unsigned char *) Mem_Malloc(
+        (size_t) bf->nrowBlock * sizeof(double), "SW_OUTBIN_open()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    bf->fp = OpenFile(fname, "wb", LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    header[0] = outbinVersion;
+    header[1] = outbinBOM;
+    header[2] = (uint32_t) pd;
+    header[3] = (uint32_t) ncol;
+    header[4] = (uint32_t) ntime;
+
+    ok = (Bool) (fwrite(outbinMagic, 1, sizeof outbinMagic, bf->fp) ==
+                     sizeof outbinMagic &&
+                 fwrite(header, sizeof header[0], 5, bf->fp) == 5 &&
+                 outbin_write_string(bf->fp, pd2longstr[pd]));
+
+    for (icol = 0; ok && icol < ncol; icol++) {
+        type = (icol < ntime) ? SW_OUTBIN_INT32 : SW_OUTBIN_FLOAT64;
+
+        ok = (Bool) (fwrite(&type, 1, 1, bf->fp) == 1 &&
+                     outbin_write_string(bf->fp, colnames[icol]) &&
+                     outbin_write_string(bf->fp, units[icol]));
+    }
+
+    if (!ok) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Could not write header of binary output file '%s'.",
+            fname
+        );
+    }
+}
+
+/**
+@brief Add values to the current row of a binary output file
+
+@param[in,out] bf Binary output file
+@param[in] values Values to add (in column order)
+@param[in] nvalues Number of values
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUTBIN_add_values(
+    SW_OUTBIN_FILE *bf,
+    const double values[],
+    unsigned int nvalues,
+    LOG_INFO *LogInfo
+) {
+    unsigned int i;
+    double *dest;
+
+    if (bf->icol + nvalues > bf->ncol) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Binary output: too many values for a row (%u > %u).",
+            bf->icol + nvalues,
+            bf->ncol
+        );
+        return; // Exit function prematurely due to error
+    }
+
+    dest = bf->values + (size_t) bf->icol * bf->nrowBlock + bf->nrow;
+    for (i = 0; i < nvalues; i++) {
+        *dest = values[i];
+        dest += bf->nrowBlock;
+    }
+
+    bf->icol += nvalues;
+}
+
+/**
+@brief Complete the current row of a binary output file
+
+The block of rows is written to disk once it is full.
+
+@param[in,out] bf Binary output file
+@param[in] timeValues Values of the time columns
+    (array of length `bf->ntime`)
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUTBIN_end_row(
+    SW_OUTBIN_FILE *bf, const int timeValues[], LOG_INFO *LogInfo
+) {
+    unsigned int i;
+
+    if (bf->icol != bf->ncol) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Binary output: row has %u instead of %u columns.",
+            bf->icol,
+            bf->ncol
+        );
+        return; // Exit function prematurely due to error
+    }
+
+    for (i = 0; i < bf->ntime; i++) {
+        bf->values[(size_t) i * bf->nrowBlock + bf->nrow] =
+            (double) timeValues[i];
+    }
+
+    bf->nrow++;
+    bf->icol = bf->ntime;
+
+    if (bf->nrow == bf->nrowBlock) {
+        outbin_write_block(bf, LogInfo);
+    }
+}
+
+/**
+@brief Write remaining rows, close a binary output file, and free memory
+
+@param[in,out] bf Binary output file
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUTBIN_close(SW_OUTBIN_FILE *bf, LOG_INFO *LogInfo) {
+    uint32_t endMarker = 0;
+
+    if (!isnull(bf->fp)) {
+        outbin_write_block(bf, LogInfo);
+
+        if (fwrite(&endMarker, sizeof endMarker, 1, bf->fp) != 1) {
+            LogError(LogInfo, LOGERROR, "Could not write binary output file.");
+        }
+
+        CloseFile(&bf->fp, LogInfo);
+    }
+
+    free(bf->values);
+    bf->values = NULL;
+    free(bf->encBuffer);
+    bf->encBuffer = NULL;
+}
+
+/**
+@brief Units of an output variable
+
+@param[in] k Output key
+@param[in] ivar Variable (base0) of the output key
+
+@return Units of the variable (see `SW2 units` in
+    `SW2_netCDF_output_variables.tsv`) or NULL if \p k has no
+    units for variable \p ivar
+*/
+const char *SW_OUTBIN_units(OutKey k, IntUS ivar) {
+    return (ivar < SW_OUTNMAXVARS) ? units_OUT[k][ivar] : NULL;
+}
+
+/**
+@brief Create binary output files for all active output periods
+
+Binary output files correspond to the `csv` output files (see
+SW_OUT_create_textfiles()): one file for output keys without and
+one file for output keys with values for each soil layer.
+
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[in,out] SW_PathOutputs Struct of type SW_PATH_OUTPUTS which
+    holds basic information about output files and values
+@param[in] txtInFiles Array of program in/output files
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUT_create_binfiles(
+    SW_OUT_DOM *OutDom,
+    SW_PATH_OUTPUTS *SW_PathOutputs,
+    char *txtInFiles[],
+    LOG_INFO *LogInfo
+) {
+    OutPeriod pd;
+
+    ForEachOutPeriod(pd) {
+        if (!OutDom->use_OutPeriod[pd]) {
+            continue;
+        }
+
+        if (SW_PathOutputs->make_regular[pd]) {
+            outbin_create_file(
+                OutDom,
+                pd,
+                swFALSE,
+                txtInFiles[eOutputDaily + pd],
+                &SW_PathOutputs->bin_reg[pd],
+                LogInfo
+            );
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+        }
+
+        if (SW_PathOutputs->make_soil[pd]) {
+            outbin_create_file(
+                OutDom,
+                pd,
+                swTRUE,
+                txtInFiles[eOutputDaily_soil + pd],
+                &SW_PathOutputs->bin_soil[pd],
+                LogInfo
+            );
+            if (LogInfo->stopRun) {
+                return; // Exit function prematurely due to error
+            }
+        }
+    }
+}
+
+/**
+@brief Complete the current rows of binary output files of an output period
+
+@param[in,out] SW_PathOutputs Struct of type SW_PATH_OUTPUTS which
+    holds basic information about output files and values
+@param[in] pd Output time step
+@param[in] SW_Model Struct of type SW_MODEL holding basic time information
+    about the simulation
+@param[in] tOffset Offset describing the previous or current period
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUT_write_binrows(
+    SW_PATH_OUTPUTS *SW_PathOutputs,
+    OutPeriod pd,
+    SW_MODEL *SW_Model,
+    TimeInt tOffset,
+    LOG_INFO *LogInfo
+) {
+    int timeValues[2] = {(int) SW_Model->simyear, 0};
+
+    switch (pd) {
+    case eSW_Day:
+        timeValues[1] = (int) SW_Model->doy;
+        break;
+    case eSW_Week:
+        timeValues[1] = (int) ((SW_Model->week + 1) - tOffset);
+        break;
+    case eSW_Month:
+        timeValues[1] = (int) ((SW_Model->month + 1) - tOffset);
+        break;
+    default:
+        break;
+    }
+
+    if (!isnull(SW_PathOutputs->bin_reg[pd])) {
+        SW_OUTBIN_end_row(SW_PathOutputs->bin_reg[pd], timeValues, LogInfo);
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
+    }
+
+    if (!isnull(SW_PathOutputs->bin_soil[pd])) {
+        SW_OUTBIN_end_row(SW_PathOutputs->bin_soil[pd], timeValues, LogInfo);
+    }
+}
+
+/**
+@brief Close all binary output files and free memory
+
+@param[in,out] SW_PathOutputs Struct of type SW_PATH_OUTPUTS which
+    holds basic information about output files and values
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUT_close_binfiles(SW_PATH_OUTPUTS *SW_PathOutputs, LOG_INFO *LogInfo) {
+    OutPeriod pd;
+
+    ForEachOutPeriod(pd) {
+        if (!isnull(SW_PathOutputs->bin_reg[pd])) {
+            SW_OUTBIN_close(SW_PathOutputs->bin_reg[pd], LogInfo);
+            free(SW_PathOutputs->bin_reg[pd]);
+            SW_PathOutputs->bin_reg[pd] = NULL;
+        }
+
+        if (!isnull(SW_PathOutputs->bin_soil[pd])) {
+            SW_OUTBIN_close(SW_PathOutputs->bin_soil[pd], LogInfo);
+            free(SW_PathOutputs->bin_soil[pd]);
+            SW_PathOutputs->bin_soil[pd] = NULL;
+        }
+    }
+}
+#endif
+
+/**
+@brief Read a binary columnar output file
+
+Integer time columns are converted to double values.
+
+@param[in] fname Name of the file
+@param[out] data Content of the file; free with SW_OUTBIN_free_data()
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_OUTBIN_read(
+    const char *fname, SW_OUTBIN_DATA *data, LOG_INFO *LogInfo
+) {
+    FILE *fp;
+    char magic[sizeof outbinMagic];
+    char *pdName = NULL;
+    uint32_t header[5];
+    uint32_t nrow;
+    uint32_t nbytes;
+    unsigned int icol;
+    unsigned char enc;
+    unsigned char *buffer = NULL;
+    size_t sizeBuffer = 0;
+    size_t irow;
+    long startBlocks;
+    Bool ok;
+
+    data->pd = eSW_Day;
+    data->ncol = 0;
+    data->ntime = 0;
+    data->nrow = 0;
+    data->colnames = NULL;
+    data->units = NULL;
+    data->type = NULL;
+    data->values = NULL;
+
+    fp = OpenFile(fname, "rb", LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    // Header
+    ok = (Bool) (fread(magic, 1, sizeof magic, fp) == sizeof magic &&
+                 memcmp(magic, outbinMagic, sizeof magic) == 0 &&
+                 fread(header, sizeof header[0], 5, fp) == 5);
+
+    if (ok && header[1] != outbinBOM) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "'%s': binary output file was written on a machine with "
+            "a different byte order.",
+            fname
+        );
+        goto closeFile;
+    }
+
+    if (!ok || header[0] != outbinVersion || header[2] >= SW_OUTNPERIODS ||
+        header[3] == 0 || header[4] > header[3]) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "'%s': not a (supported) binary output file.",
+            fname
+        );
+        goto closeFile;
+    }
+
+    data->pd = (OutPeriod) header[2];
+    data->ncol = header[3];
+    data->ntime = header[4];
+
+    pdName = outbin_read_string(fp, LogInfo);
+    if (LogInfo->stopRun) {
+        goto closeFile;
+    }
+    ok = (Bool) !isnull(pdName);
+    free(pdName);
+
+    data->colnames = (char **) Mem_Calloc(
+        data->ncol, sizeof(char *), "SW_OUTBIN_read()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto closeFile;
+    }
+
+    data->units = (char **) Mem_Calloc(
+        data->ncol, sizeof(char *), "SW_OUTBIN_read()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto closeFile;
+    }
+
+    data->type = (unsigned char *) Mem_Calloc(
+        data->ncol, sizeof(unsigned char), "SW_OUTBIN_read()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto closeFile;
+    }
+
+    for (icol = 0; ok && icol < data->ncol; icol++) {
+        ok = (Bool) (fread(&data->type[icol], 1, 1, fp) == 1 &&
+                     (data->type[icol] == SW_OUTBIN_INT32 ||
+                      data->type[icol] == SW_OUTBIN_FLOAT64));
+
+        if (ok) {
+            data->colnames[icol] = outbin_read_string(fp, LogInfo);
+            if (LogInfo->stopRun) {
+                goto closeFile;
+            }
+            data->units[icol] = outbin_read_string(fp, LogInfo);
+            if (LogInfo->stopRun) {
+                goto closeFile;
+            }
+            ok = (Bool) (!isnull(data->colnames[icol]) &&
+                         !isnull(data->units[icol]));
+        }
+    }
+
+    // First pass: count rows and determine largest encoded column
+    startBlocks = ftell(fp);
+
+    while (ok) {
+        ok = (Bool) (fread(&nrow, sizeof nrow, 1, fp) == 1);
+        if (!ok || nrow == 0) {
+            break;
+        }
+
+        data->nrow += nrow;
+
+        for (icol = 0; ok && icol < data->ncol; icol++) {
+            ok = (Bool) (fread(&enc, 1, 1, fp) == 1 &&
+                         fread(&nbytes, sizeof nbytes, 1, fp) == 1 &&
+                         fseek(fp, (long) nbytes, SEEK_CUR) == 0);
+
+            if (nbytes > sizeBuffer) {
+                sizeBuffer = nbytes;
+            }
+        }
+    }
+
+    if (!ok) {
+        LogError(
+            LogInfo, LOGERROR, "'%s': binary output file is corrupt.", fname
+        );
+        goto closeFile;
+    }
+
+    // Second pass: decode values
+    data->values = (double *) Mem_Malloc(
+        ((data->nrow > 0) ? data->nrow : 1) * data->ncol * sizeof(double),
+        "SW_OUTBIN_read()",
+        LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto closeFile;
+    }
+
+    buffer = (unsigned char *) Mem_Malloc(
+        (sizeBuffer > 0) ? sizeBuffer : 1, "SW_OUTBIN_read()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto closeFile;
+    }
+
+    ok = (Bool) (fseek(fp, startBlocks, SEEK_SET) == 0);
+    irow = 0;
+
+    while (ok && irow < data->nrow) {
+        ok = (Bool) (fread(&nrow, sizeof nrow, 1, fp) == 1 && nrow > 0);
+
+        for (icol = 0; ok && icol < data->ncol; icol++) {
+            ok = (Bool) (fread(&enc, 1, 1, fp) == 1 &&
+                         fread(&nbytes, sizeof nbytes, 1, fp) == 1 &&
+                         fread(buffer, 1, nbytes, fp) == nbytes &&
+                         outbin_decode_column(
+                             enc,
+                             buffer,
+                             nbytes,
+                             nrow,
+                             data->type[icol],
+                             data->values + icol * data->nrow + irow
+                         ));
+        }
+
+        irow += nrow;
+    }
+
+    if (!ok) {
+        LogError(
+            LogInfo, LOGERROR, "'%s': binary output file is corrupt.", fname
+        );
+    }
+
+closeFile:
+    free(buffer);
+    CloseFile(&fp, LogInfo);
+
+    if (LogInfo->stopRun) {
+        SW_OUTBIN_free_data(data);
+    }
+}
+
+/**
+@brief Free memory of the content of a binary columnar output file
+
+@param[in,out] data Content of a file as read by SW_OUTBIN_read()
+*/
+void SW_OUTBIN_free_data(SW_OUTBIN_DATA *data) {
+    unsigned int icol;
+
+    for (icol = 0; icol < data->ncol; icol++) {
+        if (!isnull(data->colnames)) {
+            free(data->colnames[icol]);
+        }
+        if (!isnull(data->units)) {
+            free(data->units[icol]);
+        }
+    }
+
+    free((void *) data->colnames);
+    data->colnames = NULL;
+    free((void *) data->units);
+    data->units = NULL;
+    free(data->type);
+    data->type = NULL;
+    free(data->values);
+    data->values = NULL;
+    data->ncol = 0;
+    data->nrow = 0;
+}
@@ -215,6 +215,31 @@ freeMem:
 
 
 #if defined(SOILWAT) && !defined(SWNETCDF)
+/**
+@brief Attach a large, fully buffered stdio buffer to an output file
+
+Rows are formatted directly into the buffer by `fprintf()` and
+written to disk with a single `write()` whenever the buffer is full
+and when the file is closed.
+
+@param[in,out] fp Newly opened output file
+@param[out] fpbuf Pointer to the allocated buffer of size #SW_OUTBUFSIZE;
+    must be freed after `fp` is closed
+@param[out] LogInfo Holds information on warnings and errors
+*/
+static void set_outbuffer(FILE *fp, char **fpbuf, LOG_INFO *LogInfo) {
+    *fpbuf = (char *) Mem_Malloc(SW_OUTBUFSIZE, "set_outbuffer()", LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    if (setvbuf(fp, *fpbuf, _IOFBF, SW_OUTBUFSIZE) != 0) {
+        // Not fatal: stdio continues to use its default buffer
+        free(*fpbuf);
+        *fpbuf = NULL;
+    }
+}
+
 /**
 @brief Create `csv` output files for specified time step
 
@@ -242,6 +267,13 @@ static void create_csv_files(
         if (LogInfo->stopRun) {
             return; // Exit function prematurely due to error
         }
+
+        set_outbuffer(
+            SW_PathOutputs->fp_reg[pd], &SW_PathOutputs->fpbuf_reg[pd], LogInfo
+        );
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
     }
 
     if (SW_PathOutputs->make_soil[pd]) {
@@ -250,6 +282,15 @@ static void create_csv_files(
         if (LogInfo->stopRun) {
             return; // Exit function prematurely due to error
         }
+
+        set_outbuffer(
+            SW_PathOutputs->fp_soil[pd],
+            &SW_PathOutputs->fpbuf_soil[pd],
+            LogInfo
+        );
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
     }
 }
 #endif
@@ -857,5 +898,13 @@ void SW_OUT_close_textfiles(
 #endif
             }
         }
+
+#if defined(SOILWAT)
+        // Free stdio buffers only after their files are closed
+        free(SW_PathOutputs->fpbuf_reg[p]);
+        SW_PathOutputs->fpbuf_reg[p] = NULL;
+        free(SW_PathOutputs->fpbuf_soil[p]);
+        SW_PathOutputs->fpbuf_soil[p] = NULL;
+#endif
     }
 }
@@ -1145,15 +1145,16 @@ void get_dSWAbulk(
     double newFraction;
     double inner_loop_veg_type; // set to inner loop veg type
     smallestCritVal = SW_VegProd->critSoilWater[SW_VegProd->rank_SWPcrits[0]];
-    double dSWA_bulk[NVEGTYPES * NVEGTYPES][NVEGTYPES * NVEGTYPES][MAX_LAYERS];
-    double dSWA_bulk_repartioned[NVEGTYPES * NVEGTYPES][NVEGTYPES * NVEGTYPES]
-                                [MAX_LAYERS];
+    // scratch space for layer `i` only: keeps the per-layer working set
+    // contiguous (two cache lines) instead of striding across all layers
+    double dSWA_bulk[NVEGTYPES][NVEGTYPES];
+    double dSWA_bulk_repartioned[NVEGTYPES][NVEGTYPES];
 
     // need to initialize to 0
     for (curr_vegType = 0; curr_vegType < NVEGTYPES; curr_vegType++) {
         for (kv = 0; kv < NVEGTYPES; kv++) {
-            dSWA_bulk_repartioned[curr_vegType][kv][i] = 0.;
-            dSWA_bulk[curr_vegType][kv][i] = 0.;
+            dSWA_bulk_repartioned[curr_vegType][kv] = 0.;
+            dSWA_bulk[curr_vegType][kv] = 0.;
         }
     }
 
@@ -1191,25 +1192,24 @@ void get_dSWAbulk(
                 // [0=tree(-2.0,off), 1=shrub(-3.9,on),
                 // 2=grass(-3.5,on), 3=forb(-2.0,on)]
                 // dSWA_bulk: set to 0 to ensure no absent values
-                dSWA_bulk[curr_crit_rank_index][kv_veg_type][i] = 0.;
+                dSWA_bulk[curr_crit_rank_index][kv_veg_type] = 0.;
                 swa_master[curr_crit_rank_index][kv_veg_type][i] = 0.;
-                dSWA_bulk_repartioned[curr_crit_rank_index][kv_veg_type][i] =
-                    0.;
+                dSWA_bulk_repartioned[curr_crit_rank_index][kv_veg_type] = 0.;
             } else {
                 // check if need to recalculate for veg types in use
                 if (crit_val < prev_crit_val) {
                     // if true then we need to recalculate
                     if (swa_master[curr_crit_rank_index][kv_veg_type][i] == 0) {
-                        dSWA_bulk[curr_crit_rank_index][kv_veg_type][i] = 0.;
+                        dSWA_bulk[curr_crit_rank_index][kv_veg_type] = 0.;
                     } else {
-                        dSWA_bulk[curr_crit_rank_index][kv_veg_type][i] =
+                        dSWA_bulk[curr_crit_rank_index][kv_veg_type] =
                             swa_master[curr_crit_rank_index][kv_veg_type][i] -
                             swa_master[curr_crit_rank_index][prev_crit_veg_type]
                                       [i];
                     }
                 } else if (crit_val == prev_crit_val) {
                     // critical values equal just set to itself
-                    dSWA_bulk[curr_crit_rank_index][kv_veg_type][i] =
+                    dSWA_bulk[curr_crit_rank_index][kv_veg_type] =
                         swa_master[curr_crit_rank_index][kv_veg_type][i];
                 } else {
                     // do nothing if crit val >. this will be handled later
@@ -1224,19 +1224,17 @@ void get_dSWAbulk(
                     prev_crit_val != crit_val) {
                     // if largest critical value and only veg type with that
                     // value just set it to dSWAbulk
-                    dSWA_bulk_repartioned[curr_crit_rank_index][kv_veg_type]
-                                         [i] = dSWA_bulk[curr_crit_rank_index]
-                                                        [kv_veg_type][i];
+                    dSWA_bulk_repartioned[curr_crit_rank_index][kv_veg_type] =
+                        dSWA_bulk[curr_crit_rank_index][kv_veg_type];
                 } else {
                     // all values other than largest well need repartitioning
                     if (crit_val == smallestCritVal) {
                         // if smallest value then all veg_types have access to
                         // it so just need to multiply by its fraction
-                        dSWA_bulk_repartioned[curr_crit_rank_index][kv_veg_type]
-                                             [i] =
-                                                 dSWA_bulk[curr_crit_rank_index]
-                                                          [kv_veg_type][i] *
-                                                 veg_type_in_use;
+                        dSWA_bulk_repartioned[curr_crit_rank_index]
+                                             [kv_veg_type] =
+                            dSWA_bulk[curr_crit_rank_index][kv_veg_type] *
+                            veg_type_in_use;
                         // multiply by fraction for index of curr_vegType not kv
                     } else {
                         // critical values that more than one veg type have
@@ -1264,11 +1262,10 @@ void get_dSWAbulk(
 
                         // divide veg fraction by sum to get new fraction value
                         newFraction = veg_type_in_use / vegFractionSum;
-                        dSWA_bulk_repartioned[curr_crit_rank_index][kv_veg_type]
-                                             [i] =
-                                                 dSWA_bulk[curr_crit_rank_index]
-                                                          [kv_veg_type][i] *
-                                                 newFraction;
+                        dSWA_bulk_repartioned[curr_crit_rank_index]
+                                             [kv_veg_type] =
+                            dSWA_bulk[curr_crit_rank_index][kv_veg_type] *
+                            newFraction;
                     }
                 }
             }
@@ -1280,9 +1277,9 @@ void get_dSWAbulk(
             greater_veg_type = SW_VegProd->rank_SWPcrits[j];
             if (SW_VegProd->critSoilWater[SW_VegProd->rank_SWPcrits[j - 1]] >
                 SW_VegProd->critSoilWater[SW_VegProd->rank_SWPcrits[j]]) {
-                dSWA_bulk[curr_crit_rank_index][greater_veg_type][i] = 0.;
-                dSWA_bulk_repartioned[curr_crit_rank_index][greater_veg_type]
-                                     [i] = 0.;
+                dSWA_bulk[curr_crit_rank_index][greater_veg_type] = 0.;
+                dSWA_bulk_repartioned[curr_crit_rank_index][greater_veg_type] =
+                    0.;
             }
         }
     }
@@ -1293,18 +1290,18 @@ void get_dSWAbulk(
                 dSWA_repart_sum[curr_vegType][i] = 0.;
             } else {
                 dSWA_repart_sum[curr_vegType][i] +=
-                    dSWA_bulk_repartioned[curr_vegType][kv][i];
+                    dSWA_bulk_repartioned[curr_vegType][kv];
             }
         }
     }
 
     /*int x = 0;
                 printf("dSWAbulk_repartition forb[%d,0,%d]:
-       %f\n",x,i,dSWA_bulk_repartioned[x][0][i]); printf("dSWAbulk_repartition
-       forb[%d,1,%d]: %f\n",x,i,dSWA_bulk_repartioned[x][1][i]);
+       %f\n",x,i,dSWA_bulk_repartioned[x][0]); printf("dSWAbulk_repartition
+       forb[%d,1,%d]: %f\n",x,i,dSWA_bulk_repartioned[x][1]);
                 printf("dSWAbulk_repartition forb[%d,2,%d]:
-       %f\n",x,i,dSWA_bulk_repartioned[x][2][i]); printf("dSWAbulk_repartition
-       forb[%d,3,%d]: %f\n\n",x,i,dSWA_bulk_repartioned[x][3][i]);
+       %f\n",x,i,dSWA_bulk_repartioned[x][2]); printf("dSWAbulk_repartition
+       forb[%d,3,%d]: %f\n\n",x,i,dSWA_bulk_repartioned[x][3]);
                 printf("dSWA_repartitioned_sum[%d][%d]: %f\n\n", x,i,
        SW_SoilWat->dSWA_repartitioned_sum[x][i]);
 
@@ -594,6 +594,8 @@ void SW_VPD_init_ptrs(SW_VEGPROD *SW_VegProd) {
         SW_VegProd->p_accu[pd] = NULL;
         SW_VegProd->p_oagg[pd] = NULL;
     }
+
+    SW_VegProd->climateCacheDir = NULL;
 }
 
 /**
@@ -1135,17 +1137,23 @@ void estimateVegetationFromClimate(
         return; // Exit function prematurely due to error
     }
 
-    calcSiteClimate(
+    SW_WTH_calc_climate_averages(
         Weather_hist,
         SW_Model->cum_monthdays,
         SW_Model->days_in_month,
         numYears,
         SW_Model->startyr,
         inNorthHem,
-        &climateOutput
+        SW_VegProd->climateCacheDir,
+        &climateOutput,
+        &climateAverages,
+        LogInfo
     );
-
-    averageClimateAcrossYears(&climateOutput, numYears, &climateAverages);
+    if (LogInfo->stopRun) {
+        // Deallocate climate structs' memory before error
+        deallocateClimateStructs(&climateOutput, &climateAverages);
+        return; // Exit function prematurely due to error
+    }
 
     if (SW_VegProd->veg_method == 1) {
 
@@ -82,7 +82,7 @@
 /* --------------------------------------------------- */
 #include "include/SW_Weather.h"      // for SW_WTH_alloc_outptrs, SW_WTH_co...
 #include "include/filefuncs.h"       // for LogError, CloseFile, GetALine
-#include "include/generic.h"         // for Bool, mean, LOGERROR, swFALSE
+#include "include/generic.h"         // for Bool, mean, LOGERROR, sw_split...
 #include "include/myMemory.h"        // for Mem_Malloc, Mem_Calloc
 #include "include/SW_datastructs.h"  // for SW_WEATHER_HIST, LOG_INFO, SW_W...
 #include "include/SW_Defines.h"      // for missing, SW_MISSING, TimeInt
@@ -91,10 +91,14 @@
 #include "include/SW_Markov.h"       // for SW_MKV_today
 #include "include/SW_SoilWater.h"    // for SW_SWC_adjust_snow
 #include "include/Times.h"           // for Time_get_lastdoy_y, Time_days_i...
+#include <ctype.h>                   // for isdigit
+#include <dirent.h>                  // for dirent, closedir, DIR, opendir, re...
 #include <math.h>                    // for exp, fmin, fmax
 #include <stdio.h>                   // for NULL, sscanf, FILE, fclose, fopen
+#include <stdint.h>                  // for uint64_t
 #include <stdlib.h>                  // for free
 #include <string.h>                  // for memset, NULL
+#include <sys/stat.h>                // for stat, S_ISDIR, S_ISREG
 
 
 /* Weather generation methods */
@@ -104,10 +108,436 @@ static const unsigned int wgMKV = 2;
 /** Weather generation method LOCF, see generateMissingWeather() */
 static const unsigned int wgLOCF = 1;
 
+/** Format version of binary weather caches, see SW_WTH_write_cache() */
+static const unsigned int wthCacheVersion = 1;
+
+/** Byte-order mark of binary weather caches (which are native-endian) */
+static const unsigned int wthCacheBOM = 0x01020304;
+
+/** Maximum directory depth explored by SW_WTH_build_cache_tree() */
+static const int wthCacheMaxDepth = 21;
+
+/** Header of a binary weather cache */
+typedef struct {
+    char magic[8];
+    unsigned int version;
+    unsigned int bom;
+    unsigned int sizeofDouble;
+    unsigned int maxDays;
+    unsigned int n_input_forcings;
+    unsigned int dailyInputIndices[MAX_INPUT_COLUMNS];
+    unsigned int dailyInputFlags[MAX_INPUT_COLUMNS];
+    unsigned int firstYear;
+    unsigned int nYears;
+} SW_WTH_CACHE_HEADER;
+
+/** State of the source weather file of one year in a binary weather cache */
+typedef struct {
+    long long mtime;
+    long long size;
+    unsigned int year;
+    unsigned int exists;
+} SW_WTH_CACHE_YEAR;
+
+/** Format version of cached climate summaries,
+    see SW_WTH_write_climate_cache() */
+static const unsigned int climCacheVersion = 2;
+
+/** Header of a cached climate summary */
+typedef struct {
+    char magic[8];
+    unsigned int version;
+    unsigned int bom;
+    unsigned int sizeofDouble;
+    unsigned int maxMonths;
+    uint64_t hash;
+} SW_CLIM_CACHE_HEADER;
+
 /* =================================================== */
 /*             Local Function Definitions              */
 /* --------------------------------------------------- */
 
+static void generateMissingWeatherYears(
+    SW_MARKOV *SW_Markov,
+    SW_WEATHER_HIST *allHist,
+    unsigned int startYear,
+    unsigned int n_years,
+    unsigned int method,
+    unsigned int optLOCF_nMax,
+    SW_WEATHER_NOW *yesterday,
+    LOG_INFO *LogInfo
+);
+
+static void checkWeatherYears(
+    SW_WEATHER *weather, TimeInt firstYear, TimeInt nYears, LOG_INFO *LogInfo
+);
+
+/**
+@brief Set weather of the day before the first day of daily weather
+    to missing values, see generateMissingWeatherYears()
+
+@param[out] yesterday Weather of the previous day
+*/
+static void clearYesterdayWeather(SW_WEATHER_NOW *yesterday) {
+    yesterday->temp_max = SW_MISSING;
+    yesterday->temp_min = SW_MISSING;
+    yesterday->temp_avg = SW_MISSING;
+    yesterday->ppt = SW_MISSING;
+    yesterday->rain = SW_MISSING;
+    yesterday->cloudCover = SW_MISSING;
+    yesterday->windSpeed = SW_MISSING;
+    yesterday->relHumidity = SW_MISSING;
+    yesterday->shortWaveRad = SW_MISSING;
+    yesterday->actualVaporPressure = SW_MISSING;
+}
+
+/**
+@brief Create file name of the binary weather cache:
+    `[weather-file prefix].` #SW_WTH_CACHE_EXT
+
+@param[in] txtWeatherPrefix File name of weather data without extension.
+@param[out] fname Buffer of size #MAX_FILENAMESIZE receiving the file name
+@param[out] LogInfo Holds information on warnings and errors
+*/
+static void wthCacheFileName(
+    const char txtWeatherPrefix[], char fname[], LOG_INFO *LogInfo
+) {
+    int resSNP = snprintf(
+        fname, MAX_FILENAMESIZE, "%s.%s", txtWeatherPrefix, SW_WTH_CACHE_EXT
+    );
+
+    if (resSNP < 0 || (unsigned) resSNP >= MAX_FILENAMESIZE) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Weather cache file name is too long for '%s'.",
+            txtWeatherPrefix
+        );
+    }
+}
+
+/**
+@brief Create file name of a cached climate summary:
+    `[cacheDir]/climate_[hash].` #SW_CLIM_CACHE_EXT
+
+@param[in] cacheDir Directory of cached climate summaries
+@param[in] hash Hash of daily weather, see SW_WTH_hash_climate()
+@param[out] fname Buffer of size `FILENAME_MAX` receiving the file name
+@param[out] LogInfo Holds information on warnings and errors
+*/
+static void climCacheFileName(
+    const char *cacheDir, uint64_t hash, char fname[], LOG_INFO *LogInfo
+) {
+    int resSNP = snprintf(
+        fname,
+        FILENAME_MAX,
+        "%s/climate_%016llx.%s",
+        cacheDir,
+        (unsigned long long) hash,
+        SW_CLIM_CACHE_EXT
+    );
+
+    if (resSNP < 0 || (unsigned) resSNP >= FILENAME_MAX) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Climate cache file name is too long for '%s'.",
+            cacheDir
+        );
+    }
+}
+
+/**
+@brief Set up the header of a cached climate summary
+
+@param[out] header Header of a cached climate summary
+@param[in] hash Hash of daily weather, see SW_WTH_hash_climate()
+*/
+static void climCacheHeader(SW_CLIM_CACHE_HEADER *header, uint64_t hash) {
+    memset(header, 0, sizeof *header);
+    (void) snprintf(header->magic, sizeof header->magic, "%s", "SW2CLIM");
+    header->version = climCacheVersion;
+    header->bom = wthCacheBOM;
+    header->sizeofDouble = (unsigned int) sizeof(double);
+    header->maxMonths = MAX_MONTHS;
+    header->hash = hash;
+}
+
+/**
+@brief Read or write the values of a climate summary
+
+Values that are read from an incomplete file are not meaningful;
+they need to be recalculated.
+
+@param[in] f File that is open for binary reading or writing
+@param[in] doWrite Write (swTRUE) or read (swFALSE) values
+@param[in,out] climateAverages Structure of type SW_CLIMATE_CLIM that holds
+    averages and standard deviations output by `averageClimateAcrossYears()`
+
+@return swTRUE if all values were read or written
+*/
+static Bool climCacheIO(
+    FILE *f, Bool doWrite, SW_CLIMATE_CLIM *climateAverages
+) {
+    double *arrays[] = {
+        climateAverages->meanTempMon_C,
+        climateAverages->maxTempMon_C,
+        climateAverages->minTempMon_C,
+        climateAverages->PPTMon_cm,
+        climateAverages->sdC4,
+        climateAverages->sdCheatgrass
+    };
+    const size_t nValues[] = {
+        MAX_MONTHS, MAX_MONTHS, MAX_MONTHS, MAX_MONTHS, 3, 3
+    };
+    double *values[] = {
+        &climateAverages->meanTemp_C,
+        &climateAverages->PPT_cm,
+        &climateAverages->PPT7thMon_mm,
+        &climateAverages->meanTempDriestQtr_C,
+        &climateAverages->minTemp2ndMon_C,
+        &climateAverages->ddAbove65F_degday,
+        &climateAverages->frostFree_days,
+        &climateAverages->minTemp7thMon_C
+    };
+    const int nArrays = 6;
+    const int nSingleValues = 8;
+    Bool ok = swTRUE;
+    size_t n;
+    int k;
+
+    for (k = 0; k < nArrays && ok; k++) {
+        n = doWrite ? fwrite(arrays[k], sizeof(double), nValues[k], f) :
+                      fread(arrays[k], sizeof(double), nValues[k], f);
+        ok = (Bool) (n == nValues[k]);
+    }
+
+    for (k = 0; k < nSingleValues && ok; k++) {
+        n = doWrite ? fwrite(values[k], sizeof(double), 1, f) :
+                      fread(values[k], sizeof(double), 1, f);
+        ok = (Bool) (n == 1);
+    }
+
+    return ok;
+}
+
+/**
+@brief Obtain modification time and size of a weather input file
+
+@param[in] txtWeatherPrefix File name of weather data without extension.
+@param[in] year Calendar year of the weather input file
+@param[out] state State of `[weather-file prefix].[year]`;
+    `exists` is zero if the file is not present
+*/
+static void wthCacheSourceState(
+    const char txtWeatherPrefix[], unsigned int year, SW_WTH_CACHE_YEAR *state
+) {
+    char fname[MAX_FILENAMESIZE];
+    struct stat statbuf;
+    int resSNP;
+
+    memset(state, 0, sizeof *state);
+    state->year = year;
+
+    resSNP = snprintf(fname, sizeof fname, "%s.%4u", txtWeatherPrefix, year);
+
+    if (resSNP >= 0 && (unsigned) resSNP < (sizeof fname) &&
+        stat(fname, &statbuf) == 0 && S_ISREG(statbuf.st_mode)) {
+        state->exists = 1;
+        state->mtime = (long long) statbuf.st_mtime;
+        state->size = (long long) statbuf.st_size;
+    }
+}
+
+/**
+@brief Set up the header of a binary weather cache
+
+Two caches are compatible if their headers (apart from years) are identical.
+
+@param[out] header Header of a binary weather cache
+@param[in] n_input_forcings Number of read-in columns from disk
+@param[in] dailyInputIndices An array of size #MAX_INPUT_COLUMNS holding the
+    calculated column number of which a certain variable resides
+@param[in] dailyInputFlags An array of size #MAX_INPUT_COLUMNS holding booleans
+    specifying what variable has daily input on disk
+@param[in] firstYear First calendar year represented by the cache
+@param[in] nYears Number of years represented by the cache
+
+@return Number of variables stored per year
+*/
+static unsigned int wthCacheHeader(
+    SW_WTH_CACHE_HEADER *header,
+    unsigned int n_input_forcings,
+    const unsigned int *dailyInputIndices,
+    const Bool *dailyInputFlags,
+    unsigned int firstYear,
+    unsigned int nYears
+) {
+    unsigned int nVars = 0;
+    int varNum;
+
+    memset(header, 0, sizeof *header);
+    (void) snprintf(header->magic, sizeof header->magic, "%s", "SW2WTHC");
+    header->version = wthCacheVersion;
+    header->bom = wthCacheBOM;
+    header->sizeofDouble = (unsigned int) sizeof(double);
+    header->maxDays = MAX_DAYS;
+    header->n_input_forcings = n_input_forcings;
+    header->firstYear = firstYear;
+    header->nYears = nYears;
+
+    for (varNum = 0; varNum < MAX_INPUT_COLUMNS; varNum++) {
+        if (dailyInputFlags[varNum]) {
+            header->dailyInputFlags[varNum] = 1;
+            header->dailyInputIndices[varNum] = dailyInputIndices[varNum];
+            nVars++;
+        }
+    }
+
+    return nVars;
+}
+
+// NOLINTBEGIN(misc-no-recursion)
+/**
+@brief Build binary weather caches for a directory and its subdirectories
+
+A cache is built in every directory that contains at least one weather
+input file `[weatherBase].[year]`; the cache covers all years from the
+first to the last year present.
+
+@param[in] dname Directory (empty or with trailing path separator)
+@param[in] weatherBase File name of weather data without path and extension
+@param[in] n_input_forcings Number of read-in columns from disk
+@param[in] dailyInputIndices An array of size #MAX_INPUT_COLUMNS holding the
+    calculated column number of which a certain variable resides
+@param[in] dailyInputFlags An array of size #MAX_INPUT_COLUMNS holding booleans
+    specifying what variable has daily input on disk
+@param[in] depth Current depth of the directory tree
+@param[in,out] nCaches Number of caches built so far
+@param[out] LogInfo Holds information on warnings and errors
+*/
+static void wthCacheBuildDir(
+    const char *dname,
+    const char *weatherBase,
+    unsigned int n_input_forcings,
+    const unsigned int *dailyInputIndices,
+    const Bool *dailyInputFlags,
+    int depth,
+    unsigned int *nCaches,
+    LOG_INFO *LogInfo
+) {
+    char path[MAX_FILENAMESIZE];
+    struct stat statbuf;
+    size_t lenBase = strlen(weatherBase);
+    unsigned int year;
+    unsigned int minYear = 0;
+    unsigned int maxYear = 0;
+    Bool hasYears = swFALSE;
+    Bool isYear;
+    int resSNP;
+    int k;
+
+    DIR *dir;
+    struct dirent *ent;
+
+    if (depth >= wthCacheMaxDepth) {
+        LogError(
+            LogInfo,
+            LOGWARN,
+            "Max depth reached and could not explore %s.\n",
+            dname
+        );
+        return;
+    }
+
+    dir = opendir((dname[0] == '\0') ? "." : dname);
+    if (isnull(dir)) {
+        return;
+    }
+
+    while ((ent = readdir(dir)) != NULL) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
+            continue;
+        }
+
+        resSNP = snprintf(path, sizeof path, "%s%s", dname, ent->d_name);
+        if (resSNP < 0 || (unsigned) resSNP + 1 >= (sizeof path)) {
+            LogError(LogInfo, LOGERROR, "Path name is too long: '%s'.", path);
+            goto closeDir;
+        }
+
+        if (stat(path, &statbuf) == 0 && S_ISDIR(statbuf.st_mode)) {
+            path[resSNP] = '/';
+            path[resSNP + 1] = '\0';
+
+            wthCacheBuildDir(
+                path,
+                weatherBase,
+                n_input_forcings,
+                dailyInputIndices,
+                dailyInputFlags,
+                depth + 1,
+                nCaches,
+                LogInfo
+            );
+            if (LogInfo->stopRun) {
+                goto closeDir;
+            }
+
+        } else if (strlen(ent->d_name) == lenBase + 5 &&
+                   strncmp(ent->d_name, weatherBase, lenBase) == 0 &&
+                   ent->d_name[lenBase] == '.') {
+            // Identify `[weatherBase].[year]` with a 4-digit year
+            isYear = swTRUE;
+            year = 0;
+            for (k = 1; k <= 4; k++) {
+                if (!isdigit((unsigned char) ent->d_name[lenBase + k])) {
+                    isYear = swFALSE;
+                    break;
+                }
+                year = 10 * year +
+                       (unsigned int) (ent->d_name[lenBase + k] - '0');
+            }
+
+            if (isYear) {
+                if (!hasYears || year < minYear) {
+                    minYear = year;
+                }
+                if (!hasYears || year > maxYear) {
+                    maxYear = year;
+                }
+                hasYears = swTRUE;
+            }
+        }
+    }
+
+    if (hasYears) {
+        resSNP = snprintf(path, sizeof path, "%s%s", dname, weatherBase);
+        if (resSNP < 0 || (unsigned) resSNP >= (sizeof path)) {
+            LogError(LogInfo, LOGERROR, "Path name is too long: '%s'.", path);
+            goto closeDir;
+        }
+
+        SW_WTH_write_cache(
+            path,
+            minYear,
+            maxYear - minYear + 1,
+            n_input_forcings,
+            dailyInputIndices,
+            dailyInputFlags,
+            LogInfo
+        );
+        if (!LogInfo->stopRun) {
+            (*nCaches)++;
+        }
+    }
+
+closeDir: { closedir(dir); }
+}
+
+// NOLINTEND(misc-no-recursion)
+
+
 /**
 @brief Takes averages through the number of years of the calculated values from
 calc_SiteClimate
@@ -1160,6 +1590,7 @@ void readAllWeather(
     unsigned int yearIndex;
     unsigned int year;
     double ***tempWeatherHist = NULL;
+    Bool *isCached = NULL;
 
     allocate_temp_weather(n_years, &tempWeatherHist, LogInfo);
     if (LogInfo->stopRun) {
@@ -1184,25 +1615,50 @@ void readAllWeather(
             windspeed,
             r_humidity
         );
+    }
 
-        // Read daily weather values from disk
-        if (!use_weathergenerator_only) {
-            read_weather_hist(
-                year,
-                tempWeatherHist[yearIndex],
-                txtWeatherPrefix,
-                n_input_forcings,
-                dailyInputIndices,
-                dailyInputFlags,
-                LogInfo
-            );
-            if (LogInfo->stopRun) {
-                goto freeTempWeather; // Exit function prematurely due to error
+    if (!use_weathergenerator_only) {
+        // Read daily weather values from binary cache (if present)
+        isCached = (Bool *) Mem_Calloc(
+            n_years, sizeof(Bool), "readAllWeather()", LogInfo
+        );
+        if (LogInfo->stopRun) {
+            goto freeTempWeather; // Exit function prematurely due to error
+        }
+
+        SW_WTH_read_cache(
+            txtWeatherPrefix,
+            startYear,
+            n_years,
+            n_input_forcings,
+            dailyInputIndices,
+            dailyInputFlags,
+            tempWeatherHist,
+            isCached,
+            LogInfo
+        );
+        if (LogInfo->stopRun) {
+            goto freeTempWeather; // Exit function prematurely due to error
+        }
+
+        // Read remaining daily weather values from text files
+        for (yearIndex = 0; yearIndex < n_years; yearIndex++) {
+            if (!isCached[yearIndex]) {
+                read_weather_hist(
+                    yearIndex + startYear,
+                    tempWeatherHist[yearIndex],
+                    txtWeatherPrefix,
+                    n_input_forcings,
+                    dailyInputIndices,
+                    dailyInputFlags,
+                    LogInfo
+                );
+                if (LogInfo->stopRun) {
+                    goto freeTempWeather; // Exit function prematurely
+                }
             }
         }
-    }
 
-    if (!use_weathergenerator_only) {
         SW_WTH_setWeatherValues(
             startYear,
             n_years,
@@ -1215,27 +1671,32 @@ void readAllWeather(
     }
 
 freeTempWeather:
+    free(isCached);
     deallocate_temp_weather(n_years, &tempWeatherHist);
 }
 
 /**
-@brief Impute missing values and scale with monthly parameters
+@brief Impute missing values and scale with monthly parameters of
+    consecutive years
 
 @param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
     related to temperature and weather generator
 @param[in,out] w Struct of type SW_WEATHER holding all relevant
     information pretaining to meteorological input data
+@param[in] firstYear Index of the first year of `allHist` to finalize
+@param[in] nYears Number of years of `allHist` to finalize
+@param[in,out] yesterday Imputed weather of the day before the first day,
+    see generateMissingWeatherYears()
 @param[in] cum_monthdays Monthly cumulative number of days for "current" year
 @param[in] days_in_month Number of days per month for "current" year
 @param[out] LogInfo Holds information on warnings and errors
-
-Finalize weather values after they have been read in via
-`readAllWeather()` or `SW_WTH_read()`
-(the latter also handles (re-)allocation).
 */
-void finalizeAllWeather(
+static void finalizeWeatherYears(
     SW_MARKOV *SW_Markov,
     SW_WEATHER *w,
+    TimeInt firstYear,
+    TimeInt nYears,
+    SW_WEATHER_NOW *yesterday,
     TimeInt cum_monthdays[],
     TimeInt days_in_month[],
     LOG_INFO *LogInfo
@@ -1244,14 +1705,19 @@ void finalizeAllWeather(
     unsigned int day;
     unsigned int yearIndex;
 
+    if (nYears == 0) {
+        return; // Nothing to finalize
+    }
+
     // Impute missing values
-    generateMissingWeather(
+    generateMissingWeatherYears(
         SW_Markov,
-        w->allHist,
-        w->startYear,
-        w->n_years,
+        &w->allHist[firstYear],
+        w->startYear + firstYear,
+        nYears,
         w->generateWeatherMethod,
         3, // optLOCF_nMax (TODO: make this user input)
+        yesterday,
         LogInfo
     );
     if (LogInfo->stopRun) {
@@ -1260,7 +1726,8 @@ void finalizeAllWeather(
 
     // Check to see if actual vapor pressure needs to be calculated
     if (w->use_humidityMonthly) {
-        for (yearIndex = 0; yearIndex < w->n_years; yearIndex++) {
+        for (yearIndex = firstYear; yearIndex < firstYear + nYears;
+             yearIndex++) {
             for (day = 0; day < MAX_DAYS; day++) {
 
                 // Make sure calculation of actual vapor pressure is not
@@ -1281,9 +1748,9 @@ void finalizeAllWeather(
 
     // Scale with monthly additive/multiplicative parameters
     scaleAllWeather(
-        w->allHist,
-        w->startYear,
-        w->n_years,
+        &w->allHist[firstYear],
+        w->startYear + firstYear,
+        nYears,
         w->scale_temp_max,
         w->scale_temp_min,
         w->scale_precip,
@@ -1298,42 +1765,169 @@ void finalizeAllWeather(
 
     // Make sure all input, scaled, generated, and calculated daily weather
     // values are within reason
-    checkAllWeather(w, LogInfo);
+    checkWeatherYears(w, firstYear, nYears, LogInfo);
 }
 
-void SW_WTH_finalize_all_weather(
+/**
+@brief Impute missing values and scale with monthly parameters
+
+@param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
+    related to temperature and weather generator
+@param[in,out] w Struct of type SW_WEATHER holding all relevant
+    information pretaining to meteorological input data
+@param[in] cum_monthdays Monthly cumulative number of days for "current" year
+@param[in] days_in_month Number of days per month for "current" year
+@param[out] LogInfo Holds information on warnings and errors
+
+Finalize weather values after they have been read in via
+`readAllWeather()` or `SW_WTH_read()`
+(the latter also handles (re-)allocation).
+*/
+void finalizeAllWeather(
     SW_MARKOV *SW_Markov,
-    SW_WEATHER *SW_Weather,
+    SW_WEATHER *w,
     TimeInt cum_monthdays[],
     TimeInt days_in_month[],
     LOG_INFO *LogInfo
 ) {
 
-    finalizeAllWeather(
-        SW_Markov, SW_Weather, cum_monthdays, days_in_month, LogInfo
+    SW_WEATHER_NOW yesterday;
+
+    clearYesterdayWeather(&yesterday);
+
+    finalizeWeatherYears(
+        SW_Markov,
+        w,
+        0,
+        w->n_years,
+        &yesterday,
+        cum_monthdays,
+        days_in_month,
+        LogInfo
     );
 }
 
 /**
-@brief Apply temperature, precipitation, cloud cover, relative humidity, and
-wind speed scaling to daily weather values
+@brief Finalize daily weather, i.e., impute missing values, scale with
+    monthly parameters, and check values
 
-@param[in,out] allHist 1D array holding all weather data
-@param[in] startYear Start year of the simulation (and `allHist`)
-@param[in] n_years Number of years in simulation (length of `allHist`)
-@param[in] scale_temp_max Array of monthly, additive scaling parameters to
-    modify daily maximum air temperature [C]
-@param[in] scale_temp_min Array of monthly, additive scaling parameters to
-    modify daily minimum air temperature [C]
-@param[in] scale_precip Array of monthly, multiplicative scaling parameters to
-    modify daily precipitation [-]
-@param[in] scale_skyCover Array of monthly, additive scaling parameters to
-    modify daily sky cover [%]
-@param[in] scale_wind Array of monthly, multiplicitive scaling parameters to
-    modify daily wind speed [-]
-@param[in] scale_rH Array of monthly, additive scaling parameters to modify
-    daily relative humidity [%]
-@param[in] scale_actVapPress Array of monthly, multiplicitive scaling
+Daily weather of all years is finalized upfront unless
+`SW_Weather->finalizeLazily` is set; then, finalization is deferred and
+each year is finalized just before it is simulated (see SW_WTH_new_year()).
+Deferred finalization produces identical daily weather.
+
+@param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
+    related to temperature and weather generator
+@param[in,out] SW_Weather Struct of type SW_WEATHER holding all relevant
+    information pretaining to meteorological input data
+@param[in] cum_monthdays Monthly cumulative number of days for "current" year
+@param[in] days_in_month Number of days per month for "current" year
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_finalize_all_weather(
+    SW_MARKOV *SW_Markov,
+    SW_WEATHER *SW_Weather,
+    TimeInt cum_monthdays[],
+    TimeInt days_in_month[],
+    LOG_INFO *LogInfo
+) {
+
+    if (SW_Weather->finalizeLazily) {
+        // The weather generator of deferred years continues from the
+        // current state of `markov_rng`
+        SW_Weather->n_yearsFinalized = 0;
+        clearYesterdayWeather(&SW_Weather->lastFinalized);
+        SW_Weather->finalizeRng = SW_Markov->markov_rng;
+        return;
+    }
+
+    finalizeAllWeather(
+        SW_Markov, SW_Weather, cum_monthdays, days_in_month, LogInfo
+    );
+}
+
+/**
+@brief Finalize daily weather through a year if finalization was
+    deferred (see SW_WTH_finalize_all_weather())
+
+Years are finalized once and in sequence because imputation carries values
+forward and the weather generator draws from one random number stream;
+years that are already finalized remain unchanged.
+
+@param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
+    related to temperature and weather generator
+@param[in,out] SW_Weather Struct of type SW_WEATHER holding all relevant
+    information pretaining to meteorological input data
+@param[in] year Calendar year that is about to be simulated
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_new_year(
+    SW_MARKOV *SW_Markov,
+    SW_WEATHER *SW_Weather,
+    TimeInt year,
+    LOG_INFO *LogInfo
+) {
+
+    TimeInt days_in_month[MAX_MONTHS];
+    TimeInt cum_monthdays[MAX_MONTHS];
+    TimeInt nYears;
+    sw_random_t markov_rng;
+
+    if (!SW_Weather->finalizeLazily || year < SW_Weather->startYear) {
+        return;
+    }
+
+    nYears = year - SW_Weather->startYear + 1;
+    if (nYears > SW_Weather->n_years) {
+        nYears = SW_Weather->n_years;
+    }
+    if (nYears <= SW_Weather->n_yearsFinalized) {
+        return; // Year is already finalized
+    }
+
+    Time_init_model(days_in_month);
+
+    // Draw from the deferred stream of the weather generator;
+    // `markov_rng` of the simulation run remains unchanged
+    markov_rng = SW_Markov->markov_rng;
+    SW_Markov->markov_rng = SW_Weather->finalizeRng;
+
+    finalizeWeatherYears(
+        SW_Markov,
+        SW_Weather,
+        SW_Weather->n_yearsFinalized,
+        nYears - SW_Weather->n_yearsFinalized,
+        &SW_Weather->lastFinalized,
+        cum_monthdays,
+        days_in_month,
+        LogInfo
+    );
+
+    SW_Weather->finalizeRng = SW_Markov->markov_rng;
+    SW_Markov->markov_rng = markov_rng;
+    SW_Weather->n_yearsFinalized = nYears;
+}
+
+/**
+@brief Apply temperature, precipitation, cloud cover, relative humidity, and
+wind speed scaling to daily weather values
+
+@param[in,out] allHist 1D array holding all weather data
+@param[in] startYear Start year of the simulation (and `allHist`)
+@param[in] n_years Number of years in simulation (length of `allHist`)
+@param[in] scale_temp_max Array of monthly, additive scaling parameters to
+    modify daily maximum air temperature [C]
+@param[in] scale_temp_min Array of monthly, additive scaling parameters to
+    modify daily minimum air temperature [C]
+@param[in] scale_precip Array of monthly, multiplicative scaling parameters to
+    modify daily precipitation [-]
+@param[in] scale_skyCover Array of monthly, additive scaling parameters to
+    modify daily sky cover [%]
+@param[in] scale_wind Array of monthly, multiplicitive scaling parameters to
+    modify daily wind speed [-]
+@param[in] scale_rH Array of monthly, additive scaling parameters to modify
+    daily relative humidity [%]
+@param[in] scale_actVapPress Array of monthly, multiplicitive scaling
     parameters to modify daily actual vapor pressure [-]
 @param[in] scale_shortWaveRad Array of monthly, multiplicitive scaling
     parameters to modify daily shortwave radiation [%]
@@ -1463,66 +2057,30 @@ void scaleAllWeather(
 }
 
 /**
-@brief Generate missing weather
-
-Meteorological inputs are required for each day; they can either be
-observed and provided via weather input files or they can be generated
-such as by a weather generator (which has separate input requirements).
-
-SOILWAT2 handles three scenarios of missing data:
-    1. Some individual days are missing (values correspond to #SW_MISSING);
-       if any relevant variable is missing on a day, then all relevant
-       variables are imputed
-    2. An entire year is missing (file `weath.xxxx` for year `xxxx` is absent)
-    3. No daily weather input files are available
-
-Available methods to generate weather:
-    1. Pass through (`method` = 0)
-    2. Imputation by last-value-carried forward "LOCF" (`method` = 1)
-        - affected variables (all implemented):
-            - minimum and maximum temperature
-            - precipitation (which is set to 0 instead of "LOCF")
-            - cloud cover
-            - wind speed
-            - relative humidity
-            - downard surface shortwave radiation
-            - actual vapor pressure
-        - missing values are imputed individually
-        - error if more than `optLOCF_nMax` days per calendar year are missing
-    3. First-order Markov weather generator (`method` = 2)
-        - affected variables (others are passed through as is):
-            - minimum and maximum temperature
-            - precipitation
-        - if a day contains any missing values (of affected variables), then
-          values for all of these variables are replaced by values created by
-          the weather generator
-
-The user can specify that SOILWAT2 generates all weather without reading
-any historical weather data files from disk
-(see `weathsetup.in`: use weather generator for all weather).
-
-@note `SW_MKV_today()` is called if `method` = 2
-(i.e., the weather generator is used);
-this requires that appropriate structures are initialized.
+@brief Generate missing weather of consecutive years
 
-@param[in,out] allHist 1D array holding all weather data
 @param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
     related to temperature and weather generator
-@param[in] startYear Start year of the simulation
-@param[in] n_years Number of years in simulation
+@param[in,out] allHist Array of daily weather of the years
+@param[in] startYear Calendar year of the first element of `allHist`
+@param[in] n_years Number of years of `allHist` to process
 @param[in] method Number to identify which method to apply to generate
-    missing values (see details).
-@param[in] optLOCF_nMax Maximum number of missing days per year (e.g., 5)
+    missing values, see generateMissingWeather()
+@param[in] optLOCF_nMax Maximum number of missing days per year
     before imputation by `LOCF` throws an error.
+@param[in,out] yesterday Weather of the day before the first day of
+    `allHist` (values are #SW_MISSING if there is none);
+    updated to the weather of the last processed day
 @param[out] LogInfo Holds information on warnings and errors
 */
-void generateMissingWeather(
+static void generateMissingWeatherYears(
     SW_MARKOV *SW_Markov,
     SW_WEATHER_HIST *allHist,
     unsigned int startYear,
     unsigned int n_years,
     unsigned int method,
     unsigned int optLOCF_nMax,
+    SW_WEATHER_NOW *yesterday,
     LOG_INFO *LogInfo
 ) {
 
@@ -1532,15 +2090,6 @@ void generateMissingWeather(
     unsigned int day;
     unsigned int nFilledLOCF;
 
-    double yesterdayPPT = SW_MISSING;
-    double yesterdayTempMin = SW_MISSING;
-    double yesterdayTempMax = SW_MISSING;
-    double yesterdayCloudCov = SW_MISSING;
-    double yesterdayWindSpeed = SW_MISSING;
-    double yesterdayRelHum = SW_MISSING;
-    double yesterdayShortWR = SW_MISSING;
-    double yesterdayActVP = SW_MISSING;
-
     Bool any_missing;
     Bool missing_Tmax = swFALSE;
     Bool missing_Tmin = swFALSE;
@@ -1606,7 +2155,7 @@ void generateMissingWeather(
 
                 if (method == wgMKV) {
                     // Markov weather generator (Tmax, Tmin, and PPT)
-                    allHist[yearIndex].ppt[day] = yesterdayPPT;
+                    allHist[yearIndex].ppt[day] = yesterday->ppt;
                     SW_MKV_today(
                         SW_Markov,
                         day,
@@ -1624,35 +2173,35 @@ void generateMissingWeather(
                     // LOCF (temp, cloud cover, wind speed, relative humidity,
                     // shortwave radiation, and actual vapor pressure) + 0 (PPT)
                     allHist[yearIndex].temp_max[day] =
-                        missing_Tmax ? yesterdayTempMax :
+                        missing_Tmax ? yesterday->temp_max :
                                        allHist[yearIndex].temp_max[day];
 
                     allHist[yearIndex].temp_min[day] =
-                        missing_Tmin ? yesterdayTempMin :
+                        missing_Tmin ? yesterday->temp_min :
                                        allHist[yearIndex].temp_min[day];
 
                     allHist[yearIndex].cloudcov_daily[day] =
                         missing_CloudCov ?
-                            yesterdayCloudCov :
+                            yesterday->cloudCover :
                             allHist[yearIndex].cloudcov_daily[day];
 
                     allHist[yearIndex].windspeed_daily[day] =
                         missing_WindSpeed ?
-                            yesterdayWindSpeed :
+                            yesterday->windSpeed :
                             allHist[yearIndex].windspeed_daily[day];
 
                     allHist[yearIndex].r_humidity_daily[day] =
                         missing_RelHum ?
-                            yesterdayRelHum :
+                            yesterday->relHumidity :
                             allHist[yearIndex].r_humidity_daily[day];
 
                     allHist[yearIndex].shortWaveRad[day] =
-                        missing_ShortWR ? yesterdayShortWR :
+                        missing_ShortWR ? yesterday->shortWaveRad :
                                           allHist[yearIndex].shortWaveRad[day];
 
                     allHist[yearIndex].actualVaporPressure[day] =
                         missing_ActVP ?
-                            yesterdayActVP :
+                            yesterday->actualVaporPressure :
                             allHist[yearIndex].actualVaporPressure[day];
 
                     allHist[yearIndex].ppt[day] =
@@ -1662,15 +2211,17 @@ void generateMissingWeather(
                     // Throw an error if too many missing values have
                     // been replaced with non-missing values by the LOCF method
                     // per calendar year
-                    if ((missing_Tmax && !missing(yesterdayTempMax)) ||
-                        (missing_Tmin && !missing(yesterdayTempMin)) ||
+                    if ((missing_Tmax && !missing(yesterday->temp_max)) ||
+                        (missing_Tmin && !missing(yesterday->temp_min)) ||
                         (missing_PPT && !missing(allHist[yearIndex].ppt[day])
                         ) ||
-                        (missing_CloudCov && !missing(yesterdayCloudCov)) ||
-                        (missing_WindSpeed && !missing(yesterdayWindSpeed)) ||
-                        (missing_RelHum && !missing(yesterdayRelHum)) ||
-                        (missing_ShortWR && !missing(yesterdayShortWR)) ||
-                        (missing_ActVP && !missing(yesterdayActVP))) {
+                        (missing_CloudCov && !missing(yesterday->cloudCover)) ||
+                        (missing_WindSpeed && !missing(yesterday->windSpeed)) ||
+                        (missing_RelHum && !missing(yesterday->relHumidity)) ||
+                        (missing_ShortWR &&
+                         !missing(yesterday->shortWaveRad)) ||
+                        (missing_ActVP &&
+                         !missing(yesterday->actualVaporPressure))) {
                         nFilledLOCF++;
                     }
 
@@ -1696,32 +2247,114 @@ void generateMissingWeather(
                     2.;
             }
 
-            yesterdayPPT = allHist[yearIndex].ppt[day];
+            yesterday->ppt = allHist[yearIndex].ppt[day];
 
             if (method == wgLOCF) {
-                yesterdayTempMax = allHist[yearIndex].temp_max[day];
-                yesterdayTempMin = allHist[yearIndex].temp_min[day];
-                yesterdayCloudCov = allHist[yearIndex].cloudcov_daily[day];
-                yesterdayWindSpeed = allHist[yearIndex].windspeed_daily[day];
-                yesterdayRelHum = allHist[yearIndex].r_humidity_daily[day];
-                yesterdayShortWR = allHist[yearIndex].shortWaveRad[day];
-                yesterdayActVP = allHist[yearIndex].actualVaporPressure[day];
+                yesterday->temp_max = allHist[yearIndex].temp_max[day];
+                yesterday->temp_min = allHist[yearIndex].temp_min[day];
+                yesterday->cloudCover = allHist[yearIndex].cloudcov_daily[day];
+                yesterday->windSpeed = allHist[yearIndex].windspeed_daily[day];
+                yesterday->relHumidity =
+                    allHist[yearIndex].r_humidity_daily[day];
+                yesterday->shortWaveRad = allHist[yearIndex].shortWaveRad[day];
+                yesterday->actualVaporPressure =
+                    allHist[yearIndex].actualVaporPressure[day];
             }
         }
     }
 }
 
 /**
-@brief Check weather through all years/days within simultation and make sure
-all input values are reasonable after possible weather generation and scaling.
-If a value is to be found unreasonable, the function will execute a program
-crash.
+@brief Generate missing weather
+
+Meteorological inputs are required for each day; they can either be
+observed and provided via weather input files or they can be generated
+such as by a weather generator (which has separate input requirements).
+
+SOILWAT2 handles three scenarios of missing data:
+    1. Some individual days are missing (values correspond to #SW_MISSING);
+       if any relevant variable is missing on a day, then all relevant
+       variables are imputed
+    2. An entire year is missing (file `weath.xxxx` for year `xxxx` is absent)
+    3. No daily weather input files are available
+
+Available methods to generate weather:
+    1. Pass through (`method` = 0)
+    2. Imputation by last-value-carried forward "LOCF" (`method` = 1)
+        - affected variables (all implemented):
+            - minimum and maximum temperature
+            - precipitation (which is set to 0 instead of "LOCF")
+            - cloud cover
+            - wind speed
+            - relative humidity
+            - downard surface shortwave radiation
+            - actual vapor pressure
+        - missing values are imputed individually
+        - error if more than `optLOCF_nMax` days per calendar year are missing
+    3. First-order Markov weather generator (`method` = 2)
+        - affected variables (others are passed through as is):
+            - minimum and maximum temperature
+            - precipitation
+        - if a day contains any missing values (of affected variables), then
+          values for all of these variables are replaced by values created by
+          the weather generator
+
+The user can specify that SOILWAT2 generates all weather without reading
+any historical weather data files from disk
+(see `weathsetup.in`: use weather generator for all weather).
+
+@note `SW_MKV_today()` is called if `method` = 2
+(i.e., the weather generator is used);
+this requires that appropriate structures are initialized.
+
+@param[in,out] allHist 1D array holding all weather data
+@param[in,out] SW_Markov Struct of type SW_MARKOV which holds values
+    related to temperature and weather generator
+@param[in] startYear Start year of the simulation
+@param[in] n_years Number of years in simulation
+@param[in] method Number to identify which method to apply to generate
+    missing values (see details).
+@param[in] optLOCF_nMax Maximum number of missing days per year (e.g., 5)
+    before imputation by `LOCF` throws an error.
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void generateMissingWeather(
+    SW_MARKOV *SW_Markov,
+    SW_WEATHER_HIST *allHist,
+    unsigned int startYear,
+    unsigned int n_years,
+    unsigned int method,
+    unsigned int optLOCF_nMax,
+    LOG_INFO *LogInfo
+) {
+    SW_WEATHER_NOW yesterday;
+
+    clearYesterdayWeather(&yesterday);
+
+    generateMissingWeatherYears(
+        SW_Markov,
+        allHist,
+        startYear,
+        n_years,
+        method,
+        optLOCF_nMax,
+        &yesterday,
+        LogInfo
+    );
+}
+
+/**
+@brief Check daily weather of consecutive years, see checkAllWeather()
 
 @param[in] weather Struct of type SW_WEATHER holding all relevant information
     pretaining to weather input data
+@param[in] firstYear Index of the first year of `allHist` to check
+@param[in] nYears Number of years of `allHist` to check
 @param[out] LogInfo Holds information on warnings and errors
 */
-void checkAllWeather(SW_WEATHER *weather, LOG_INFO *LogInfo) {
+static void checkWeatherYears(
+    SW_WEATHER *weather, TimeInt firstYear, TimeInt nYears, LOG_INFO *LogInfo
+) {
 
     // Initialize any variables
     TimeInt year;
@@ -1733,7 +2366,7 @@ void checkAllWeather(SW_WEATHER *weather, LOG_INFO *LogInfo) {
     double dailyMaxTemp;
 
     // Loop through `allHist` years
-    for (year = 0; year < weather->n_years; year++) {
+    for (year = firstYear; year < firstYear + nYears; year++) {
         numDaysInYear = Time_get_lastdoy_y(year + weather->startYear);
 
         // Loop through `allHist` days
@@ -1896,6 +2529,20 @@ void checkAllWeather(SW_WEATHER *weather, LOG_INFO *LogInfo) {
     }
 }
 
+/**
+@brief Check weather through all years/days within simultation and make sure
+all input values are reasonable after possible weather generation and scaling.
+If a value is to be found unreasonable, the function will execute a program
+crash.
+
+@param[in] weather Struct of type SW_WEATHER holding all relevant information
+    pretaining to weather input data
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void checkAllWeather(SW_WEATHER *weather, LOG_INFO *LogInfo) {
+    checkWeatherYears(weather, 0, weather->n_years, LogInfo);
+}
+
 /**
 @brief Clears weather history.
 @note Used by rSOILWAT2
@@ -2753,7 +3400,7 @@ void read_weather_hist(
     int varNum;
 
     double weathInput[MAX_INPUT_COLUMNS];
-    char weathInStrs[15][20];
+    char *weathInStrs[MAX_INPUT_COLUMNS + 1];
 
     // Create file name: `[weather-file prefix].[year]`
     char fname[MAX_FILENAMESIZE];
@@ -2779,43 +3426,26 @@ void read_weather_hist(
 
     while (GetALine(f, inbuf, MAX_FILENAMESIZE)) {
         lineno++;
-        x = sscanf(
-            inbuf,
-            "%19s %19s %19s %19s %19s %19s %19s %19s %19s %19s "
-            "%19s %19s %19s %19s %19s",
-            weathInStrs[0],
-            weathInStrs[1],
-            weathInStrs[2],
-            weathInStrs[3],
-            weathInStrs[4],
-            weathInStrs[5],
-            weathInStrs[6],
-            weathInStrs[7],
-            weathInStrs[8],
-            weathInStrs[9],
-            weathInStrs[10],
-            weathInStrs[11],
-            weathInStrs[12],
-            weathInStrs[13],
-            weathInStrs[14]
+        x = (unsigned int) sw_split_tokens(
+            inbuf, weathInStrs, MAX_INPUT_COLUMNS + 1
         );
 
-        if (x != n_input_forcings + 1) {
+        if (x > MAX_INPUT_COLUMNS + 1) {
             LogError(
                 LogInfo,
                 LOGERROR,
-                "%s : Incomplete record %d (doy=%d).",
+                "%s : Too many values in record %d (doy=%d).",
                 fname,
                 lineno,
                 doy
             );
             goto closeFile;
         }
-        if (x > MAX_INPUT_COLUMNS + 1) {
+        if (x != n_input_forcings + 1) {
             LogError(
                 LogInfo,
                 LOGERROR,
-                "%s : Too many values in record %d (doy=%d).",
+                "%s : Incomplete record %d (doy=%d).",
                 fname,
                 lineno,
                 doy
@@ -2894,19 +3524,355 @@ void read_weather_hist(
 closeFile: { CloseFile(&f, LogInfo); }
 }
 
-void initializeClimatePtrs(
-    SW_CLIMATE_YEARLY *climateOutput, SW_CLIMATE_CLIM *climateAverages
+/**
+@brief Write a binary weather cache for a weather-file prefix
+
+The cache `[weather-file prefix].` #SW_WTH_CACHE_EXT is a native-endian,
+versioned file that holds the daily values of the requested input columns
+as returned by read_weather_hist() for each year from `firstYear` to
+`firstYear + nYears - 1` together with modification time and size of
+each source file `[weather-file prefix].[year]`
+(which are used to validate the cache by SW_WTH_read_cache()).
+
+@param[in] txtWeatherPrefix File name of weather data without extension.
+@param[in] firstYear First calendar year represented by the cache
+@param[in] nYears Number of years represented by the cache
+@param[in] n_input_forcings Number of read-in columns from disk
+@param[in] dailyInputIndices An array of size #MAX_INPUT_COLUMNS holding the
+    calculated column number of which a certain variable resides
+@param[in] dailyInputFlags An array of size #MAX_INPUT_COLUMNS holding booleans
+    specifying what variable has daily input on disk
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_write_cache(
+    char txtWeatherPrefix[],
+    unsigned int firstYear,
+    unsigned int nYears,
+    unsigned int n_input_forcings,
+    const unsigned int *dailyInputIndices,
+    const Bool *dailyInputFlags,
+    LOG_INFO *LogInfo
 ) {
+    char fname[MAX_FILENAMESIZE];
+    FILE *f = NULL;
+    SW_WTH_CACHE_HEADER header;
+    SW_WTH_CACHE_YEAR *states = NULL;
+    double ***tempWeatherHist = NULL;
+    Bool failed = swFALSE;
+    unsigned int yearIndex;
+    int varNum;
 
-    climateOutput->PPTMon_cm = NULL;
-    climateOutput->meanTempMon_C = NULL;
-    climateOutput->maxTempMon_C = NULL;
-    climateOutput->minTempMon_C = NULL;
+    wthCacheFileName(txtWeatherPrefix, fname, LogInfo);
+    if (LogInfo->stopRun || nYears == 0) {
+        return; // Exit function prematurely due to error
+    }
 
-    climateOutput->PPT_cm = NULL;
-    climateOutput->PPT7thMon_mm = NULL;
-    climateOutput->meanTemp_C = NULL;
-    climateOutput->meanTempDriestQtr_C = NULL;
+    (void) wthCacheHeader(
+        &header,
+        n_input_forcings,
+        dailyInputIndices,
+        dailyInputFlags,
+        firstYear,
+        nYears
+    );
+
+    states = (SW_WTH_CACHE_YEAR *) Mem_Malloc(
+        sizeof(SW_WTH_CACHE_YEAR) * nYears, "SW_WTH_write_cache()", LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    allocate_temp_weather(nYears, &tempWeatherHist, LogInfo);
+    if (LogInfo->stopRun) {
+        goto freeMem; // Exit function prematurely due to error
+    }
+
+    // Source state is obtained before reading so that a file that is
+    // modified concurrently results in an outdated (and thus ignored) cache
+    for (yearIndex = 0; yearIndex < nYears; yearIndex++) {
+        clear_hist_weather(NULL, tempWeatherHist[yearIndex]);
+
+        wthCacheSourceState(
+            txtWeatherPrefix, firstYear + yearIndex, &states[yearIndex]
+        );
+
+        if (states[yearIndex].exists) {
+            read_weather_hist(
+                firstYear + yearIndex,
+                tempWeatherHist[yearIndex],
+                txtWeatherPrefix,
+                n_input_forcings,
+                dailyInputIndices,
+                dailyInputFlags,
+                LogInfo
+            );
+            if (LogInfo->stopRun) {
+                goto freeMem; // Exit function prematurely due to error
+            }
+        }
+    }
+
+    f = OpenFile(fname, "wb", LogInfo);
+    if (LogInfo->stopRun) {
+        goto freeMem; // Exit function prematurely due to error
+    }
+
+    failed = (Bool) (fwrite(&header, sizeof header, 1, f) != 1 ||
+                     fwrite(states, sizeof *states, nYears, f) != nYears);
+
+    for (yearIndex = 0; yearIndex < nYears && !failed; yearIndex++) {
+        if (states[yearIndex].exists) {
+            for (varNum = 0; varNum < MAX_INPUT_COLUMNS && !failed; varNum++) {
+                if (dailyInputFlags[varNum]) {
+                    failed = (Bool) (fwrite(
+                                         tempWeatherHist[yearIndex][varNum],
+                                         sizeof(double),
+                                         MAX_DAYS,
+                                         f
+                                     ) != MAX_DAYS);
+                }
+            }
+        }
+    }
+
+    CloseFile(&f, LogInfo);
+
+    if (failed) {
+        (void) remove(fname);
+        LogError(
+            LogInfo, LOGERROR, "Failed to write weather cache '%s'.", fname
+        );
+    }
+
+freeMem:
+    free(states);
+    deallocate_temp_weather(nYears, &tempWeatherHist);
+}
+
+/**
+@brief Fill daily weather values from a binary weather cache (if present)
+
+Years are filled only if the cache was built with the same input columns
+and if modification time and size of the source file
+`[weather-file prefix].[year]` (or its absence) are unchanged;
+all other years are left for read_weather_hist().
+
+@param[in] txtWeatherPrefix File name of weather data without extension.
+@param[in] startYear Start year of the simulation
+@param[in] n_years Number of years in simulation
+@param[in] n_input_forcings Number of read-in columns from disk
+@param[in] dailyInputIndices An array of size #MAX_INPUT_COLUMNS holding the
+    calculated column number of which a certain variable resides
+@param[in] dailyInputFlags An array of size #MAX_INPUT_COLUMNS holding booleans
+    specifying what variable has daily input on disk
+@param[out] tempWeatherHist Weather values of each year as read-in from disk,
+    see allocate_temp_weather()
+@param[out] isCached Array of size `n_years` indicating which years were
+    filled from the cache
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_read_cache(
+    char txtWeatherPrefix[],
+    unsigned int startYear,
+    unsigned int n_years,
+    unsigned int n_input_forcings,
+    const unsigned int *dailyInputIndices,
+    const Bool *dailyInputFlags,
+    double ***tempWeatherHist,
+    Bool *isCached,
+    LOG_INFO *LogInfo
+) {
+    char fname[MAX_FILENAMESIZE];
+    FILE *f;
+    SW_WTH_CACHE_HEADER header;
+    SW_WTH_CACHE_HEADER expected;
+    SW_WTH_CACHE_YEAR *states = NULL;
+    SW_WTH_CACHE_YEAR current;
+    double *data = NULL;
+    const double *yearData;
+    size_t nData = 0;
+    size_t offset = 0;
+    unsigned int nVars;
+    unsigned int yearIndex;
+    unsigned int y;
+    Bool isStale = swFALSE;
+    int varNum;
+
+    for (yearIndex = 0; yearIndex < n_years; yearIndex++) {
+        isCached[yearIndex] = swFALSE;
+    }
+
+    wthCacheFileName(txtWeatherPrefix, fname, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    f = fopen(fname, "rb");
+    if (isnull(f)) {
+        // no weather cache --> read text weather inputs
+        return;
+    }
+
+    isStale = swTRUE; // Reset once cache is loaded successfully
+
+    if (fread(&header, sizeof header, 1, f) != 1 || header.nYears == 0) {
+        goto closeFile;
+    }
+
+    nVars = wthCacheHeader(
+        &expected,
+        n_input_forcings,
+        dailyInputIndices,
+        dailyInputFlags,
+        header.firstYear,
+        header.nYears
+    );
+    if (memcmp(&header, &expected, sizeof header) != 0) {
+        goto closeFile;
+    }
+
+    states = (SW_WTH_CACHE_YEAR *) Mem_Malloc(
+        sizeof(SW_WTH_CACHE_YEAR) * header.nYears,
+        "SW_WTH_read_cache()",
+        LogInfo
+    );
+    if (LogInfo->stopRun) {
+        goto closeFile; // Exit function prematurely due to error
+    }
+
+    if (fread(states, sizeof *states, header.nYears, f) != header.nYears) {
+        goto closeFile;
+    }
+
+    for (y = 0; y < header.nYears; y++) {
+        if (states[y].year != header.firstYear + y) {
+            goto closeFile;
+        }
+        if (states[y].exists) {
+            nData += (size_t) nVars * MAX_DAYS;
+        }
+    }
+
+    // Load all daily values at once
+    if (nData > 0) {
+        data = (double *) Mem_Malloc(
+            sizeof(double) * nData, "SW_WTH_read_cache()", LogInfo
+        );
+        if (LogInfo->stopRun) {
+            goto closeFile; // Exit function prematurely due to error
+        }
+
+        if (fread(data, sizeof(double), nData, f) != nData) {
+            goto closeFile;
+        }
+    }
+
+    isStale = swFALSE;
+
+    for (y = 0; y < header.nYears; y++) {
+        yearData = NULL;
+        if (states[y].exists) {
+            yearData = data + offset;
+            offset += (size_t) nVars * MAX_DAYS;
+        }
+
+        if (states[y].year < startYear ||
+            states[y].year - startYear >= n_years) {
+            continue;
+        }
+        yearIndex = states[y].year - startYear;
+
+        wthCacheSourceState(txtWeatherPrefix, states[y].year, &current);
+
+        if (current.exists != states[y].exists ||
+            current.mtime != states[y].mtime ||
+            current.size != states[y].size) {
+            isStale = swTRUE;
+            continue;
+        }
+
+        if (!isnull(yearData)) {
+            for (varNum = 0; varNum < MAX_INPUT_COLUMNS; varNum++) {
+                if (dailyInputFlags[varNum]) {
+                    memcpy(
+                        tempWeatherHist[yearIndex][varNum],
+                        yearData,
+                        sizeof(double) * MAX_DAYS
+                    );
+                    yearData += MAX_DAYS;
+                }
+            }
+        }
+
+        isCached[yearIndex] = swTRUE;
+    }
+
+closeFile: {
+    CloseFile(&f, LogInfo);
+    free(states);
+    free(data);
+
+    if (isStale && !LogInfo->stopRun) {
+        LogError(
+            LogInfo,
+            LOGWARN,
+            "Weather cache '%s' is outdated or incompatible and was "
+            "(partially) ignored; rebuild with 'SOILWAT2 -w'.",
+            fname
+        );
+    }
+}
+}
+
+/**
+@brief Build binary weather caches for all weather input directories
+
+Searches the directory of the weather-file prefix and all of its
+subdirectories for weather input files `[weather-file name].[year]`
+and writes a cache with SW_WTH_write_cache() in each directory where
+such files are present using the input columns configured for
+`SW_Weather`, i.e., as specified by the `weathsetup.in` file.
+
+@param[in] SW_Weather Struct of type SW_WEATHER holding all relevant
+    information pretaining to meteorological input data
+@param[out] nCaches Number of caches built
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_build_cache_tree(
+    SW_WEATHER *SW_Weather, unsigned int *nCaches, LOG_INFO *LogInfo
+) {
+    char dname[MAX_FILENAMESIZE];
+
+    *nCaches = 0;
+
+    DirName(SW_Weather->name_prefix, dname);
+
+    wthCacheBuildDir(
+        dname,
+        BaseName(SW_Weather->name_prefix),
+        SW_Weather->n_input_forcings,
+        SW_Weather->dailyInputIndices,
+        SW_Weather->dailyInputFlags,
+        0,
+        nCaches,
+        LogInfo
+    );
+}
+
+void initializeClimatePtrs(
+    SW_CLIMATE_YEARLY *climateOutput, SW_CLIMATE_CLIM *climateAverages
+) {
+
+    climateOutput->PPTMon_cm = NULL;
+    climateOutput->meanTempMon_C = NULL;
+    climateOutput->maxTempMon_C = NULL;
+    climateOutput->minTempMon_C = NULL;
+
+    climateOutput->PPT_cm = NULL;
+    climateOutput->PPT7thMon_mm = NULL;
+    climateOutput->meanTemp_C = NULL;
+    climateOutput->meanTempDriestQtr_C = NULL;
     climateOutput->minTemp2ndMon_C = NULL;
     climateOutput->minTemp7thMon_C = NULL;
     climateOutput->frostFree_days = NULL;
@@ -3150,3 +4116,255 @@ void deallocateClimateStructs(
         }
     }
 }
+
+/**
+@brief Add the bit pattern of a value to one lane of a word-wise hash,
+    see SW_WTH_hash_climate()
+
+@param[in,out] lane Hash value of the lane
+@param[in] value Value to add to the hash
+*/
+static void climHashWord(uint64_t *lane, double value) {
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof bits);
+
+    // Rotate so that high bits of a value also affect low bits of the hash
+    *lane ^= bits;
+    *lane = (*lane << 31) | (*lane >> 33);
+    *lane *= 1099511628211ULL; // FNV prime
+}
+
+/**
+@brief Hash of the daily weather that determines a climate summary
+
+The hash covers the daily maximum, minimum, and average air temperature and
+precipitation of each year (after imputation and scaling), the number of
+years, the first calendar year, and the hemisphere,
+i.e., all inputs of calcSiteClimate().
+
+Daily values are hashed word-wise in four independent lanes
+(one per variable) which are then combined with a byte-wise FNV-1a hash;
+this is about an order of magnitude faster than hashing all bytes
+so that looking up a cached climate summary is cheaper than
+calculating it (see `BM_ClimateAverages`).
+
+@param[in] allHist Array containing all historical data of a site
+@param[in] numYears Number of years represented within simulation
+@param[in] startYear Calendar year corresponding to first year of `allHist`
+@param[in] inNorthHem Boolean value specifying if site is in northern hemisphere
+
+@return 64-bit FNV-1a hash
+*/
+uint64_t SW_WTH_hash_climate(
+    SW_WEATHER_HIST *allHist,
+    unsigned int numYears,
+    unsigned int startYear,
+    Bool inNorthHem
+) {
+    uint64_t hash = SW_HASH_INIT;
+    uint64_t lanes[4] = {
+        SW_HASH_INIT, SW_HASH_INIT, SW_HASH_INIT, SW_HASH_INIT
+    };
+    TimeInt nDays;
+    TimeInt day;
+    unsigned int yearIndex;
+
+    sw_hash_bytes(&hash, &climCacheVersion, sizeof climCacheVersion);
+    sw_hash_bytes(&hash, &numYears, sizeof numYears);
+    sw_hash_bytes(&hash, &startYear, sizeof startYear);
+    sw_hash_bytes(&hash, &inNorthHem, sizeof inNorthHem);
+
+    for (yearIndex = 0; yearIndex < numYears; yearIndex++) {
+        nDays = Time_get_lastdoy_y(startYear + yearIndex);
+
+        for (day = 0; day < nDays; day++) {
+            climHashWord(&lanes[0], allHist[yearIndex].temp_max[day]);
+            climHashWord(&lanes[1], allHist[yearIndex].temp_min[day]);
+            climHashWord(&lanes[2], allHist[yearIndex].temp_avg[day]);
+            climHashWord(&lanes[3], allHist[yearIndex].ppt[day]);
+        }
+    }
+
+    sw_hash_bytes(&hash, lanes, sizeof lanes);
+
+    return hash;
+}
+
+/**
+@brief Write a cached climate summary
+
+The file `[cacheDir]/climate_[hash].` #SW_CLIM_CACHE_EXT is a
+native-endian, versioned file that holds the across-year averages and
+standard deviations of a climate summary (see averageClimateAcrossYears());
+the file name and header contain the hash of the daily weather
+(which is used to validate the file by SW_WTH_read_climate_cache()).
+
+A file that cannot be written is removed and a warning is issued
+(simulation results are not affected).
+
+@param[in] cacheDir Directory of cached climate summaries
+@param[in] hash Hash of daily weather, see SW_WTH_hash_climate()
+@param[in] climateAverages Structure of type SW_CLIMATE_CLIM that holds
+    averages and standard deviations output by `averageClimateAcrossYears()`
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_write_climate_cache(
+    const char *cacheDir,
+    uint64_t hash,
+    SW_CLIMATE_CLIM *climateAverages,
+    LOG_INFO *LogInfo
+) {
+    char fname[FILENAME_MAX];
+    char tmpName[FILENAME_MAX];
+    SW_CLIM_CACHE_HEADER header;
+    FILE *f;
+    Bool ok = swFALSE;
+    int resSNP;
+
+    climCacheFileName(cacheDir, hash, fname, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    climCacheHeader(&header, hash);
+
+    // Write to a temporary file that replaces the cache once complete
+    // so that other runs never read a partially written cache
+    resSNP = snprintf(tmpName, sizeof tmpName, "%s.tmp", fname);
+    f = (resSNP < 0 || (unsigned) resSNP >= (sizeof tmpName)) ?
+            NULL :
+            fopen(tmpName, "wb");
+
+    if (!isnull(f)) {
+        ok = (Bool) (fwrite(&header, sizeof header, 1, f) == 1 &&
+                     climCacheIO(f, swTRUE, climateAverages));
+
+        if (fclose(f) != 0 || (ok && rename(tmpName, fname) != 0)) {
+            ok = swFALSE;
+        }
+
+        if (!ok) {
+            (void) remove(tmpName);
+        }
+    }
+
+    if (!ok) {
+        LogError(
+            LogInfo, LOGWARN, "Failed to write climate cache '%s'.", fname
+        );
+    }
+}
+
+/**
+@brief Obtain a climate summary from the cache (if present)
+
+@param[in] cacheDir Directory of cached climate summaries
+@param[in] hash Hash of daily weather, see SW_WTH_hash_climate()
+@param[out] climateAverages Structure of type SW_CLIMATE_CLIM that holds
+    averages and standard deviations output by `averageClimateAcrossYears()`;
+    values are not meaningful if the cache is absent or incomplete
+@param[out] LogInfo Holds information on warnings and errors
+
+@return swTRUE if the climate summary was read; swFALSE if the cache is
+    absent, incompatible, or incomplete (and the climate summary needs to be
+    calculated)
+*/
+Bool SW_WTH_read_climate_cache(
+    const char *cacheDir,
+    uint64_t hash,
+    SW_CLIMATE_CLIM *climateAverages,
+    LOG_INFO *LogInfo
+) {
+    char fname[FILENAME_MAX];
+    SW_CLIM_CACHE_HEADER header;
+    SW_CLIM_CACHE_HEADER expected;
+    FILE *f;
+    Bool ok;
+
+    climCacheFileName(cacheDir, hash, fname, LogInfo);
+    if (LogInfo->stopRun) {
+        return swFALSE; // Exit function prematurely due to error
+    }
+
+    f = fopen(fname, "rb");
+    if (isnull(f)) {
+        return swFALSE; // no cached climate summary
+    }
+
+    climCacheHeader(&expected, hash);
+
+    ok = (Bool) (fread(&header, sizeof header, 1, f) == 1 &&
+                 memcmp(&header, &expected, sizeof header) == 0 &&
+                 climCacheIO(f, swFALSE, climateAverages));
+
+    (void) fclose(f);
+
+    return ok;
+}
+
+/**
+@brief Calculate across-year averages and standard deviations of climate
+    variables from daily weather or, if available, obtain them from the cache
+
+Climate summaries are cached by the hash of the daily weather
+(see SW_WTH_hash_climate()) so that simulation runs with identical daily
+weather, e.g., reruns of a scenario or simulation units that share a weather
+source, calculate them only once.
+
+@param[in] allHist Array containing all historical data of a site
+@param[in] cum_monthdays Monthly cumulative number of days for "current" year
+@param[in] days_in_month Number of days per month for "current" year
+@param[in] numYears Number of years represented within simulation
+@param[in] startYear Calendar year corresponding to first year of `allHist`
+@param[in] inNorthHem Boolean value specifying if site is in northern hemisphere
+@param[in] cacheDir Directory of cached climate summaries;
+    NULL if climate summaries are not cached
+@param[out] climateOutput Structure of type SW_CLIMATE_YEARLY that holds all
+    output from `calcSiteClimate()`; not meaningful if the climate summary was
+    obtained from the cache
+@param[out] climateAverages Structure of type SW_CLIMATE_CLIM that holds
+    averages and standard deviations output by `averageClimateAcrossYears()`
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WTH_calc_climate_averages(
+    SW_WEATHER_HIST *allHist,
+    TimeInt cum_monthdays[],
+    TimeInt days_in_month[],
+    unsigned int numYears,
+    unsigned int startYear,
+    Bool inNorthHem,
+    const char *cacheDir,
+    SW_CLIMATE_YEARLY *climateOutput,
+    SW_CLIMATE_CLIM *climateAverages,
+    LOG_INFO *LogInfo
+) {
+    uint64_t hash = 0;
+
+    if (!isnull(cacheDir)) {
+        hash = SW_WTH_hash_climate(allHist, numYears, startYear, inNorthHem);
+
+        if (SW_WTH_read_climate_cache(
+                cacheDir, hash, climateAverages, LogInfo
+            ) ||
+            LogInfo->stopRun) {
+            return; // Climate summary obtained from cache (or error)
+        }
+    }
+
+    calcSiteClimate(
+        allHist,
+        cum_monthdays,
+        days_in_month,
+        numYears,
+        startYear,
+        inNorthHem,
+        climateOutput
+    );
+
+    averageClimateAcrossYears(climateOutput, numYears, climateAverages);
+
+    if (!isnull(cacheDir)) {
+        SW_WTH_write_climate_cache(cacheDir, hash, climateAverages, LogInfo);
+    }
+}
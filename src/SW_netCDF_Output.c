@@ -1679,6 +1679,7 @@ void SW_NCOUT_init_ptrs(SW_NETCDF_OUT *SW_netCDFOut) {
     SW_netCDFOut->crs_projsc.standard_parallel[1] = NAN;
 
     SW_netCDFOut->strideOutYears = -1;
+    SW_netCDFOut->streamOutYears = -1;
     SW_netCDFOut->deflateLevel = 0;
 
     for (index = 0; index < numAllocVars; index++) {
@@ -2157,6 +2158,13 @@ void SW_NCOUT_create_units_converters(SW_OUT_DOM *OutDom, LOG_INFO *LogInfo) {
 @brief Write values to output variables in previously-created
 output netCDF files
 
+Output arrays hold values of `nrowWrite` time steps which
+start at time step `irowOffset` of the simulation run;
+the time steps are written to the corresponding time slices of
+the (time-sliced) output netCDFs.
+Time-slices before `fileOffset` were completely written previously
+and are neither opened nor closed.
+
 @param[in] OutDom Struct of type SW_OUT_DOM that holds output
     information that do not change throughout simulation runs
 @param[in] p_OUT Array of accumulated output values throughout
@@ -2167,6 +2175,15 @@ output netCDF files
 @param[in] ncSuid Unique indentifier of the current suid being simulated
 @param[in] domType Type of domain in which simulations are running
     (gridcell/sites)
+@param[in] nrowWrite Number of time steps to write for each output period
+    (e.g., SW_OUT_DOM.nrow_OUT to write all time steps)
+@param[in] irowOffset Number of time steps of each output period that
+    were previously written
+@param[in,out] fileOffset First time-slice of each output period that
+    is not completely written; updated to the time-slice that
+    holds time step `irowOffset + nrowWrite`
+@param[in,out] timeOffset Time offset of the first time step of
+    time-slice `fileOffset` (updated together with `fileOffset`)
 @param[out] LogInfo Holds information on warnings and errors
 */
 void SW_NCOUT_write_output(
@@ -2176,6 +2193,10 @@ void SW_NCOUT_write_output(
     char **ncOutFileNames[][SW_OUTNPERIODS],
     const size_t ncSuid[],
     const char *domType,
+    const size_t nrowWrite[],
+    const size_t irowOffset[],
+    unsigned int fileOffset[],
+    size_t timeOffset[],
     LOG_INFO *LogInfo
 ) {
 
@@ -2193,20 +2214,29 @@ void SW_NCOUT_write_output(
     size_t start[MAX_NUM_DIMS] = {0};
     size_t pOUTIndex;
     size_t startTime;
+    size_t startWrite;
+    size_t endWrite;
     size_t timeSize = 0;
     size_t countTotal = 0;
+    unsigned int nextFileOffset;
+    size_t nextTimeOffset;
     int vertSize;
     int pftSize;
+    int timeDimIndex = (strcmp(domType, "s") == 0) ? 1 : 2;
 
     start[0] = ncSuid[0];
     start[1] = ncSuid[1];
 
 
     ForEachOutPeriod(pd) {
-        if (!OutDom->use_OutPeriod[pd]) {
+        if (!OutDom->use_OutPeriod[pd] || nrowWrite[pd] == 0) {
             continue; // Skip period iteration
         }
 
+        // Time-slices are identical across output keys
+        nextFileOffset = fileOffset[pd];
+        nextTimeOffset = timeOffset[pd];
+
         ForEachOutKey(key) {
             if (OutDom->nvar_OUT[key] == 0 || !OutDom->use[key]) {
                 continue; // Skip key iteration
@@ -2215,9 +2245,10 @@ void SW_NCOUT_write_output(
             // Loop over output time-slices
 
             // keep track of time across time-sliced files per outkey
-            startTime = 0;
+            startTime = timeOffset[pd];
 
-            for (fileNum = 0; fileNum < numFilesPerKey; fileNum++) {
+            for (fileNum = fileOffset[pd]; fileNum < numFilesPerKey;
+                 fileNum++) {
                 fileName = ncOutFileNames[key][pd][fileNum];
 
                 if (isnull(fileName)) {
@@ -2225,6 +2256,11 @@ void SW_NCOUT_write_output(
                     continue;
                 }
 
+                if (startTime >= irowOffset[pd] + nrowWrite[pd]) {
+                    // this and later time-slices are after the output array
+                    break;
+                }
+
                 SW_NC_open(fileName, NC_WRITE, &currFileID, LogInfo);
                 if (LogInfo->stopRun) {
                     return;
@@ -2238,8 +2274,22 @@ void SW_NCOUT_write_output(
                     goto closeFile; // Exit function prematurely due to error
                 }
 
+                // Time steps of the current time-slice held by output array
+                startWrite = (startTime > irowOffset[pd]) ? startTime :
+                                                            irowOffset[pd];
+                endWrite = startTime + timeSize;
+                if (endWrite > irowOffset[pd] + nrowWrite[pd]) {
+                    endWrite = irowOffset[pd] + nrowWrite[pd];
+                } else {
+                    // Time-slice is complete after this write
+                    nextFileOffset = fileNum + 1;
+                    nextTimeOffset = startTime + timeSize;
+                }
 
-                for (varNum = 0; varNum < OutDom->nvar_OUT[key]; varNum++) {
+
+                for (varNum = 0;
+                     varNum < OutDom->nvar_OUT[key] && endWrite > startWrite;
+                     varNum++) {
                     if (!OutDom->netCDFOutput.reqOutputVars[key][varNum]) {
                         continue; // Skip variable iteration
                     }
@@ -2281,13 +2331,19 @@ void SW_NCOUT_write_output(
                     }
 #endif // SWDEBUG
 
+                    // Restrict to time steps held by the output array
+                    countTotal /= timeSize;
+                    countTotal *= endWrite - startWrite;
+                    count[timeDimIndex] = endWrite - startWrite;
+                    start[timeDimIndex] = startWrite - startTime;
+
 
                     /* Point to contiguous memory where values change fastest
                        for vegtypes, then soil layers, then time, then variables
                     */
                     pOUTIndex =
                         OutDom->netCDFOutput.iOUToffset[key][pd][varNum];
-                    if (startTime > 0) {
+                    if (startWrite > irowOffset[pd]) {
                         // 1 if no soil layers
                         vertSize = (OutDom->nsl_OUT[key][varNum] > 0) ?
                                        OutDom->nsl_OUT[key][varNum] :
@@ -2297,7 +2353,9 @@ void SW_NCOUT_write_output(
                                       OutDom->npft_OUT[key][varNum] :
                                       1;
 
-                        pOUTIndex += iOUTnc(startTime, 0, 0, vertSize, pftSize);
+                        pOUTIndex += iOUTnc(
+                            startWrite - irowOffset[pd], 0, 0, vertSize, pftSize
+                        );
                     }
 
                     p_OUTValPtr = &p_OUT[key][pd][pOUTIndex];
@@ -2341,11 +2399,110 @@ void SW_NCOUT_write_output(
                 nc_close(currFileID);
             }
         }
+
+        fileOffset[pd] = nextFileOffset;
+        timeOffset[pd] = nextTimeOffset;
     }
 
+    return;
+
 closeFile: { nc_close(currFileID); }
 }
 
+/**
+@brief Write output rows of a simulation run to output netCDFs
+if output is streamed
+
+Streaming output (if `streamOutYears` is specified) holds at most
+SW_OUT_DOM.nrow_OUT time steps in output arrays `p_OUT`;
+full output arrays are written to the output netCDFs and
+then re-used for the following time steps.
+
+@param[in] OutDom Struct of type SW_OUT_DOM that holds output
+    information that do not change throughout simulation runs
+@param[in,out] OutRun Struct of type SW_OUT_RUN that holds output
+    information that may change throughout simulation runs
+@param[in] SW_PathOutputs Struct of type SW_PATH_OUTPUTS which
+    holds basic information about output files and values
+@param[in] flushAll Write all rows (e.g., at the end of a simulation run)
+    instead of only full output arrays
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_NCOUT_stream_output(
+    SW_OUT_DOM *OutDom,
+    SW_OUT_RUN *OutRun,
+    SW_PATH_OUTPUTS *SW_PathOutputs,
+    Bool flushAll,
+    LOG_INFO *LogInfo
+) {
+    OutPeriod pd;
+    size_t nrowWrite[SW_OUTNPERIODS] = {0};
+    Bool doWrite = swFALSE;
+
+    ForEachOutPeriod(pd) {
+        if (OutDom->use_OutPeriod[pd] && OutRun->irow_OUT[pd] > 0 &&
+            (flushAll || OutRun->irow_OUT[pd] >= OutDom->nrow_OUT[pd])) {
+            nrowWrite[pd] = OutRun->irow_OUT[pd];
+            doWrite = swTRUE;
+        }
+    }
+
+    if (!doWrite) {
+        return; // Nothing to write
+    }
+
+    SW_NCOUT_write_output(
+        OutDom,
+        OutRun->p_OUT,
+        SW_PathOutputs->numOutFiles,
+        SW_PathOutputs->ncOutFiles,
+        OutRun->ncSuid,
+        OutRun->domType,
+        nrowWrite,
+        OutRun->irowOffset_OUT,
+        OutRun->ncFileOffset_OUT,
+        OutRun->ncTimeOffset_OUT,
+        LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    // Re-use output arrays for the following time steps
+    ForEachOutPeriod(pd) {
+        OutRun->irowOffset_OUT[pd] += nrowWrite[pd];
+        OutRun->irow_OUT[pd] -= nrowWrite[pd];
+    }
+}
+
+/**
+@brief Limit the number of time steps held by output arrays
+if output is streamed
+
+@param[in] streamOutYears Number of years of output to hold in memory
+    (streaming output) or -1 (all years)
+@param[in,out] nrow_OUT Number of output time steps for each output period
+*/
+void SW_NCOUT_set_nrow_stream(int streamOutYears, size_t nrow_OUT[]) {
+    const size_t nrowPerYear[SW_OUTNPERIODS] = {
+        MAX_DAYS, MAX_WEEKS, MAX_MONTHS, 1
+    };
+    size_t nrowStream;
+    OutPeriod pd;
+
+    if (streamOutYears <= 0) {
+        return; // Output is not streamed
+    }
+
+    ForEachOutPeriod(pd) {
+        nrowStream = (size_t) streamOutYears * nrowPerYear[pd];
+
+        if (nrow_OUT[pd] > nrowStream) {
+            nrow_OUT[pd] = nrowStream;
+        }
+    }
+}
+
 /**
 @brief Deconstruct output netCDF information
 
@@ -2479,7 +2636,8 @@ void SW_NCOUT_read_atts(
         "geo_YAxisName",
         "proj_XAxisName",
         "proj_YAxisName",
-        "siteName"
+        "siteName",
+        "streamOutYears"
     };
     static const Bool requiredKeys[NUM_ATT_IN_KEYS] = {
         swTRUE,  swTRUE,  swTRUE,  swFALSE, swFALSE, swTRUE,  swTRUE,
@@ -2560,7 +2718,7 @@ void SW_NCOUT_read_atts(
         // set_hasKey() does not produce errors, only warnings possible
 
         /* Check to see if the line number contains a double or integer value */
-        doIntConv = (Bool) (keyID >= 25 && keyID <= 29);
+        doIntConv = (Bool) ((keyID >= 25 && keyID <= 29) || keyID == 35);
         doDoubleConv = (Bool) ((keyID >= 10 && keyID <= 12) ||
                                (keyID >= 17 && keyID <= 19) ||
                                (keyID >= 23 && keyID <= 24));
@@ -2749,6 +2907,18 @@ void SW_NCOUT_read_atts(
         case 34:
             SW_netCDFOut->siteName = Str_Dup(value, LogInfo);
             break;
+        case 35:
+            if (!infVal) {
+                SW_netCDFOut->streamOutYears = inBufintRes;
+
+                if (SW_netCDFOut->streamOutYears <= 0) {
+                    LogError(
+                        LogInfo, LOGERROR, "The value for 'streamOutYears' <= 0"
+                    );
+                    goto closeFile;
+                }
+            }
+            break;
         case KEY_NOT_FOUND:
         default:
             LogError(
@@ -31,14 +31,18 @@
 /*                INCLUDES / DEFINES                   */
 /* --------------------------------------------------- */
 
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L // for clock_gettime() and CLOCK_MONOTONIC
+#endif
+
 #include "include/Times.h"          // for Jan, Dec, Feb, NoMonth, NoDay
-#include "include/filefuncs.h"      // for sw_message
+#include "include/filefuncs.h"      // for sw_message, OpenFile, CloseFile
 #include "include/generic.h"        // for Bool, GE, final_running_sd, get_...
 #include "include/SW_datastructs.h" // for SW_WALLTIME, LOG_INFO
 #include "include/SW_Defines.h"     // for TimeInt, WallTimeSpec, MAX_DAYS
 #include <stdio.h>                  // for fprintf, FILE, NULL, stdout
-#include <string.h>                 // for NULL, memcpy
-#include <time.h>                   // for time, difftime, gmtime, strftime
+#include <string.h>                 // for NULL, memcpy, strlen, strcmp
+#include <time.h>                   // for time, difftime, clock_gettime
 
 
 /* =================================================== */
@@ -51,6 +55,21 @@ const TimeInt monthdays[MAX_MONTHS] = {
     31, NoDay, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
 };
 
+/** Names of timed phases (see `SW_PHASE`) used in time report and profile */
+static const char *const phaseNames[SW_NPHASES] = {
+    "deepCopy",
+    "inputsNC",
+    "initRun",
+    "spinup",
+    "simulation",
+    "outputsNC",
+    "freeMem",
+    "weather",
+    "waterFlow",
+    "soilTemperature",
+    "outputAggregation"
+};
+
 /* =================================================== */
 /*             Global Function Definitions             */
 /* --------------------------------------------------- */
@@ -331,6 +350,10 @@ void SW_WT_StartTime(SW_WALLTIME *wt) {
 
     wt->nTimedRuns = 0;
     wt->nUntimedRuns = 0;
+
+    SW_WT_InitPhaseTimes(&wt->PhaseTimes);
+    wt->profileFile = NULL;
+    wt->suidDiagFile = NULL;
 }
 
 /* Assumes that all values have been initialized */
@@ -362,7 +385,9 @@ Reports on total wall time, number of simulations timed in the simulation set,
 average time for a simulation run and variation among simulation runs
 (standard deviation, SD; min, minimum; max, maximum),
 as well as the proportion of wall time spent during the loop over the
-simulation set relative to the total wall time.
+simulation set relative to the total wall time;
+and, if phases were timed (see `SW_PHASE_START()`), on wall time and number of
+calls of each phase summed across simulation runs.
 
 Time report is written to
     + `logfile`, if quiet mode is active (`-q` flag) and `logfile` is not `NULL`
@@ -377,6 +402,8 @@ void SW_WT_ReportTime(SW_WALLTIME wt, LOG_INFO *LogInfo) {
     double total_time = 0;
     unsigned long nSims = wt.nTimedRuns + wt.nUntimedRuns;
     int fprintRes = 0;
+    int ph;
+    Bool hasPhases = swFALSE;
 
     FILE *logfp = LogInfo->QuietMode ? LogInfo->logfp : stdout;
 
@@ -450,6 +477,37 @@ void SW_WT_ReportTime(SW_WALLTIME wt, LOG_INFO *LogInfo) {
             "wall time]\n",
             100. * wt.timeSimSet / total_time
         );
+        if (fprintRes < 0) {
+            goto wrapUpErrMsg;
+        }
+    }
+
+    for (ph = 0; ph < SW_NPHASES; ph++) {
+        if (wt.PhaseTimes.nPhase[ph] == 0) {
+            continue;
+        }
+
+        if (!hasPhases) {
+            hasPhases = swTRUE;
+            fprintRes = fprintf(
+                logfp,
+                "    * Wall time of phases: [seconds] (number of calls)\n"
+            );
+            if (fprintRes < 0) {
+                goto wrapUpErrMsg;
+            }
+        }
+
+        fprintRes = fprintf(
+            logfp,
+            "        - %s: %.3f (%lu)\n",
+            phaseNames[ph],
+            wt.PhaseTimes.timePhase[ph],
+            wt.PhaseTimes.nPhase[ph]
+        );
+        if (fprintRes < 0) {
+            goto wrapUpErrMsg;
+        }
     }
 
 wrapUpErrMsg: {
@@ -459,6 +517,334 @@ wrapUpErrMsg: {
 }
 }
 
+/**
+@brief Time stamp of a monotonic clock
+
+Uses `CLOCK_MONOTONIC` if available; otherwise, falls back to `timespec_get()`
+(C11) or to processor time.
+
+@return Time [seconds] since an arbitrary but fixed starting point;
+    negative if time failed
+*/
+double monotonic_walltime(void) {
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+        return (double) ts.tv_sec + (double) ts.tv_nsec / 1.e9;
+    }
+
+#elif SW_TIMESPEC == 1
+    struct timespec ts;
+
+    if (timespec_get(&ts, TIME_UTC) != 0) {
+        return (double) ts.tv_sec + (double) ts.tv_nsec / 1.e9;
+    }
+
+#else
+    clock_t t = clock();
+
+    if (t != (clock_t) (-1)) {
+        return (double) t / CLOCKS_PER_SEC;
+    }
+#endif
+
+    return -1.;
+}
+
+/**
+@brief Reset accumulated phase times
+
+@param[out] pt Accumulator of phase times
+*/
+void SW_WT_InitPhaseTimes(SW_PHASETIMES *pt) {
+    int ph;
+
+    for (ph = 0; ph < SW_NPHASES; ph++) {
+        pt->timePhase[ph] = 0.;
+        pt->timeStartPhase[ph] = -1.;
+        pt->nPhase[ph] = 0;
+    }
+}
+
+/**
+@brief Start timing a call to a phase
+
+Usually called via `SW_PHASE_START()` which is a no-op unless compiled
+with `SWPROFILE`.
+
+@param[in,out] pt Accumulator of phase times; nothing is timed if NULL
+@param[in] ph Phase
+*/
+void SW_WT_PhaseStart(SW_PHASETIMES *pt, SW_PHASE ph) {
+    if (!isnull(pt)) {
+        pt->timeStartPhase[ph] = monotonic_walltime();
+    }
+}
+
+/**
+@brief Stop timing a call to a phase and add its wall time
+
+Usually called via `SW_PHASE_STOP()` which is a no-op unless compiled
+with `SWPROFILE`.
+
+@param[in,out] pt Accumulator of phase times; nothing is timed if NULL
+@param[in] ph Phase
+*/
+void SW_WT_PhaseStop(SW_PHASETIMES *pt, SW_PHASE ph) {
+    double t;
+
+    if (!isnull(pt) && GE(pt->timeStartPhase[ph], 0.)) {
+        t = monotonic_walltime();
+
+        if (GE(t, 0.)) {
+            pt->timePhase[ph] += t - pt->timeStartPhase[ph];
+            pt->nPhase[ph]++;
+        }
+
+        pt->timeStartPhase[ph] = -1.;
+    }
+}
+
+/**
+@brief Add phase times of one accumulator to another
+
+Simulation runs accumulate phase times locally (e.g., per thread);
+local accumulators are combined with this function.
+
+@param[in,out] dest Accumulator of phase times that is added to
+@param[in] src Accumulator of phase times that is added
+*/
+void SW_WT_AddPhaseTimes(SW_PHASETIMES *dest, const SW_PHASETIMES *src) {
+    int ph;
+
+    for (ph = 0; ph < SW_NPHASES; ph++) {
+        dest->timePhase[ph] += src->timePhase[ph];
+        dest->nPhase[ph] += src->nPhase[ph];
+    }
+}
+
+/**
+@brief Write phase times to a machine-readable profile
+
+The profile is written as `json` if the file name ends with ".json";
+otherwise, as `csv` with columns phase, calls, seconds, and
+percent (of summed wall time of stages of simulation runs,
+i.e., phases from #eSW_PhDeepCopy to #eSW_PhFreeMem).
+Nothing is written if `wt->profileFile` is NULL.
+
+@param[in] wt Object with timing information.
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WT_WriteProfile(SW_WALLTIME *wt, LOG_INFO *LogInfo) {
+    FILE *fp;
+    int ph;
+    int fprintRes = 0;
+    size_t lenName;
+    Bool asJSON;
+    double total_time;
+    double timeRuns = 0.;
+
+    if (isnull(wt->profileFile)) {
+        return;
+    }
+
+    lenName = strlen(wt->profileFile);
+    asJSON = (Bool) (lenName >= 5 &&
+                     strcmp(wt->profileFile + lenName - 5, ".json") == 0);
+
+    fp = OpenFile(wt->profileFile, "w", LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    if (asJSON) {
+        total_time = diff_walltime(wt->timeStart, wt->has_walltime);
+
+        fprintRes = fprintf(
+            fp,
+            "{\n  \"totalWallTime\": %.6f,\n"
+            "  \"simulationSetWallTime\": %.6f,\n"
+            "  \"nSimulationRuns\": %lu,\n  \"phases\": [",
+            total_time,
+            wt->timeSimSet,
+            wt->nTimedRuns + wt->nUntimedRuns
+        );
+
+        for (ph = 0; ph < SW_NPHASES && fprintRes >= 0; ph++) {
+            fprintRes = fprintf(
+                fp,
+                "%s\n    {\"phase\": \"%s\", \"calls\": %lu, "
+                "\"seconds\": %.6f}",
+                (ph > 0) ? "," : "",
+                phaseNames[ph],
+                wt->PhaseTimes.nPhase[ph],
+                wt->PhaseTimes.timePhase[ph]
+            );
+        }
+
+        if (fprintRes >= 0) {
+            fprintRes = fprintf(fp, "\n  ]\n}\n");
+        }
+
+    } else {
+        for (ph = eSW_PhDeepCopy; ph <= eSW_PhFreeMem; ph++) {
+            timeRuns += wt->PhaseTimes.timePhase[ph];
+        }
+
+        fprintRes = fprintf(fp, "phase,calls,seconds,percent\n");
+
+        for (ph = 0; ph < SW_NPHASES && fprintRes >= 0; ph++) {
+            if (GT(timeRuns, 0.)) {
+                fprintRes = fprintf(
+                    fp,
+                    "%s,%lu,%.6f,%.3f\n",
+                    phaseNames[ph],
+                    wt->PhaseTimes.nPhase[ph],
+                    wt->PhaseTimes.timePhase[ph],
+                    100. * wt->PhaseTimes.timePhase[ph] / timeRuns
+                );
+            } else {
+                fprintRes = fprintf(
+                    fp,
+                    "%s,%lu,%.6f,NA\n",
+                    phaseNames[ph],
+                    wt->PhaseTimes.nPhase[ph],
+                    wt->PhaseTimes.timePhase[ph]
+                );
+            }
+        }
+    }
+
+    if (fprintRes < 0) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Failed to write profile to '%s'.",
+            wt->profileFile
+        );
+    }
+
+    CloseFile(&fp, LogInfo);
+}
+
+/**
+@brief Create file for diagnostics of each simulation run (suid)
+
+The file is a `csv` with one row per simulated suid (see
+SW_WT_WriteSuidDiag()) and columns
+    + `suid`: simulation unit identifier (base1)
+    + `ncSuid0`, `ncSuid1`: base0 position in the domain, i.e.,
+      (y, x) for gridded domains and (site, 0) for site domains
+    + `wallTime`: wall time [seconds] of the run (NA if failed)
+    + `nLayers`: number of soil layers
+    + `nGeneratedDays`: number of days generated by the weather generator
+    + `nWarnings`: number of warnings
+    + `error`: 1 if the run failed, 0 otherwise
+    + `soilTempError`: 1 if soil temperature failed, 0 otherwise
+    + `processPeakMemory`: peak memory [kilobytes] of the process after the
+      run (NA if not available); this is a running maximum across runs
+      and not specific to the run
+    + `nSpinupYears`: number of simulated spinup years (fewer than the
+      spinup duration if an adaptive spinup converged)
+    + `runMemory`: memory [kilobytes] held by the run, i.e., SW_RUN and its
+      heap allocations (see SW_CTL_sizeof_heap())
+
+@param[in] wt Object with timing information.
+@param[out] LogInfo Holds information on warnings and errors
+
+@return File pointer; NULL if `wt->suidDiagFile` is NULL or on error
+*/
+FILE *SW_WT_OpenSuidDiag(SW_WALLTIME *wt, LOG_INFO *LogInfo) {
+    FILE *fp;
+
+    if (isnull(wt->suidDiagFile)) {
+        return NULL;
+    }
+
+    fp = OpenFile(wt->suidDiagFile, "w", LogInfo);
+    if (LogInfo->stopRun) {
+        return NULL; // Exit function prematurely due to error
+    }
+
+    if (fprintf(
+            fp,
+            "suid,ncSuid0,ncSuid1,wallTime,nLayers,nGeneratedDays,"
+            "nWarnings,error,soilTempError,processPeakMemory,nSpinupYears,"
+            "runMemory\n"
+        ) < 0) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Failed to write to '%s'.",
+            wt->suidDiagFile
+        );
+        CloseFile(&fp, LogInfo);
+        return NULL;
+    }
+
+    return fp;
+}
+
+/**
+@brief Write diagnostics of a simulation run (suid)
+
+@param[in] fp File pointer (see SW_WT_OpenSuidDiag()); nothing is written
+    if NULL
+@param[in] suid Simulation unit identifier (base1)
+@param[in] ncSuid Position of suid in the domain (base0)
+@param[in] diag Diagnostics of the simulation run
+@param[out] LogInfo Holds information on warnings and errors
+*/
+void SW_WT_WriteSuidDiag(
+    FILE *fp,
+    unsigned long suid,
+    const unsigned long ncSuid[],
+    const SW_SUIDDIAG *diag,
+    LOG_INFO *LogInfo
+) {
+    char strTime[32] = "NA";
+    char strMemory[32] = "NA";
+
+    if (isnull(fp)) {
+        return;
+    }
+
+    if (GE(diag->wallTime, 0.)) {
+        (void) snprintf(strTime, sizeof strTime, "%.6f", diag->wallTime);
+    }
+
+    if (diag->processPeakMemory >= 0) {
+        (void) snprintf(
+            strMemory, sizeof strMemory, "%ld", diag->processPeakMemory
+        );
+    }
+
+    if (fprintf(
+            fp,
+            "%lu,%lu,%lu,%s,%u,%lu,%lu,%d,%d,%s,%u,%ld\n",
+            suid,
+            ncSuid[0],
+            ncSuid[1],
+            strTime,
+            (unsigned int) diag->nLayers,
+            diag->nGeneratedDays,
+            diag->nWarnings,
+            diag->hasError ? 1 : 0,
+            diag->soilTempError ? 1 : 0,
+            strMemory,
+            (unsigned int) diag->nSpinupYears,
+            diag->runMemory
+        ) < 0) {
+        LogError(
+            LogInfo,
+            LOGERROR,
+            "Failed to write diagnostics of suid = %lu.",
+            suid
+        );
+    }
+}
+
 /**
 @brief Current date and time in UTC formatted according to ISO 8601
 
@@ -18,7 +18,9 @@
 #include <ctype.h>                  // for isspace
 #include <dirent.h>                 // for dirent, closedir, DIR, opendir, re...
 #include <errno.h>                  // for errno, ERANGE
+#include <float.h>                  // for FLT_EVAL_METHOD
 #include <limits.h>                 // for LONG_MIN, LONG_MAX, INT_MIN, INT_MAX
+#include <locale.h>                 // for localeconv
 #include <math.h>                   // for HUGE_VAL, HUGE_VALF
 #include <stdarg.h>                 // for va_end, va_start
 #include <stdio.h>                  // for NULL, fclose, FILE, fopen, EOF
@@ -177,6 +179,159 @@ closeDir: { closedir(dir); }
 
 // NOLINTEND(misc-no-recursion)
 
+/** Check if a character is a decimal digit (independent of locale) */
+#define isDecDigit(c) ((c) >= '0' && (c) <= '9')
+
+/**
+@brief Fast path to convert a decimal string to a long integer
+
+Handles `[+-]digits` with at most 18 digits which cannot overflow.
+
+@param[in] str Pointer to string to be converted (must be fully consumed).
+@param[out] res Converted value (only set if successful).
+
+@return swTRUE if successful; swFALSE if `strtol()` is required.
+*/
+static Bool sw_strtol_fast(const char *str, long int *res) {
+    const char *p = str;
+    long int value = 0;
+    int nDigits = 0;
+    Bool isNeg = swFALSE;
+
+    if (*p == '-' || *p == '+') {
+        isNeg = (Bool) (*p == '-');
+        p++;
+    }
+
+    for (; isDecDigit(*p); p++) {
+        if (++nDigits > 18 || (nDigits > 9 && LONG_MAX <= INT_MAX)) {
+            return swFALSE;
+        }
+        value = 10 * value + (*p - '0');
+    }
+
+    if (nDigits == 0 || *p != '\0') {
+        return swFALSE;
+    }
+
+    *res = isNeg ? -value : value;
+    return swTRUE;
+}
+
+/**
+@brief Fast path to convert a decimal string to a double
+
+Handles `[+-]digits[.digits][(e|E)[+-]digits]` with a significand of at most
+19 significant digits; the decimal point is always `'.'`
+(independent of locale).
+The result is correctly rounded (identical to `strtod()`) because
+the fast path is only taken if the significand is exactly representable
+(at most 2^53) and if the decimal exponent is within the range of exactly
+representable powers of ten, i.e., a single correctly rounded multiplication
+or division produces the result (Clinger's fast path).
+
+@param[in] str Pointer to string to be converted (must be fully consumed).
+@param[out] res Converted value (only set if successful).
+
+@return swTRUE if successful; swFALSE if `strtod()` is required.
+*/
+static Bool sw_strtod_fast(const char *str, double *res) {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                   1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                   1e18, 1e19, 1e20, 1e21, 1e22};
+    const unsigned long long maxExact = 1ULL << 53;
+    const char *p = str;
+    unsigned long long significand = 0;
+    double value;
+    int nDigits = 0;
+    int exp10 = 0;
+    int expValue = 0;
+    Bool isNeg = swFALSE;
+    Bool isExpNeg = swFALSE;
+    Bool hasDigits = swFALSE;
+
+    if (*p == '-' || *p == '+') {
+        isNeg = (Bool) (*p == '-');
+        p++;
+    }
+
+    // Integer part (leading zeros are not significant)
+    for (; isDecDigit(*p); p++) {
+        hasDigits = swTRUE;
+        if (significand > 0 || *p != '0') {
+            if (++nDigits > 19) {
+                return swFALSE;
+            }
+            significand = 10 * significand + (unsigned long long) (*p - '0');
+        }
+    }
+
+    // Fractional part
+    if (*p == '.') {
+        p++;
+        for (; isDecDigit(*p); p++) {
+            hasDigits = swTRUE;
+            exp10--;
+            if (significand > 0 || *p != '0') {
+                if (++nDigits > 19) {
+                    return swFALSE;
+                }
+                significand =
+                    10 * significand + (unsigned long long) (*p - '0');
+            }
+        }
+    }
+
+    if (!hasDigits) {
+        return swFALSE;
+    }
+
+    // Exponent
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        if (*p == '-' || *p == '+') {
+            isExpNeg = (Bool) (*p == '-');
+            p++;
+        }
+        if (!isDecDigit(*p)) {
+            return swFALSE;
+        }
+        for (; isDecDigit(*p); p++) {
+            if (expValue < 10000) {
+                expValue = 10 * expValue + (*p - '0');
+            }
+        }
+        exp10 += isExpNeg ? -expValue : expValue;
+    }
+
+    if (*p != '\0') {
+        return swFALSE;
+    }
+
+    if (significand == 0) {
+        value = 0.;
+
+    } else if (significand <= maxExact && exp10 >= -22 && exp10 <= 22) {
+        value = (double) significand;
+        value = (exp10 < 0) ? value / pow10[-exp10] : value * pow10[exp10];
+
+    } else {
+        return swFALSE;
+    }
+
+    *res = isNeg ? -value : value;
+    return swTRUE;
+
+#else
+    // Extended precision of intermediate results breaks correct rounding
+    (void) str;
+    (void) res;
+    return swFALSE;
+#endif
+}
+
 /* =================================================== */
 /*             Global Function Definitions             */
 /* --------------------------------------------------- */
@@ -326,6 +481,9 @@ unsigned long int sw_strtoul(
 This function implements cert-err34-c
 "Detect errors when converting a string to a number".
 
+Plain decimal integers are converted by sw_strtol_fast();
+all other strings by `strtol()`.
+
 @param[in] str Pointer to string to be converted.
 @param[in] errMsg Pointer to string included in error message.
 @param[out] LogInfo Holds information on warnings and errors
@@ -334,6 +492,10 @@ long int sw_strtol(const char *str, const char *errMsg, LOG_INFO *LogInfo) {
     long int resl = LONG_MIN;
     char *endStr;
 
+    if (sw_strtol_fast(str, &resl)) {
+        return resl;
+    }
+
     errno = 0;
 
     resl = strtol(str, &endStr, 10);
@@ -394,25 +556,87 @@ int sw_strtoi(const char *str, const char *errMsg, LOG_INFO *LogInfo) {
     return resi;
 }
 
+/**
+@brief Convert a string to a double by `strtod()` with `'.'` as
+decimal point (independent of locale)
+
+`strtod()` uses the decimal point of the current `LC_NUMERIC` locale,
+e.g., if SOILWAT2 is embedded in a host program that called `setlocale()`.
+If that decimal point is not `'.'`, then \p str is converted
+from a copy where `'.'` is replaced by the decimal point of the locale;
+strings that contain the decimal point of such a locale are rejected.
+
+@param[in] str Pointer to string to be converted.
+@param[out] res Converted value.
+
+@return swTRUE if \p str was converted in full; swFALSE otherwise.
+*/
+static Bool sw_strtod_locale(const char *str, double *res) {
+    const char *decPoint = localeconv()->decimal_point;
+    size_t lenDecPoint = strlen(decPoint);
+    char buf[256];
+    size_t pos = 0;
+    const char *p;
+    char *endStr;
+
+    *res = 0.;
+
+    if (lenDecPoint == 0 || strcmp(decPoint, ".") == 0) {
+        *res = strtod(str, &endStr);
+        return (Bool) (endStr != str && '\0' == *endStr);
+    }
+
+    for (p = str; *p != '\0'; p++) {
+        if (strncmp(p, decPoint, lenDecPoint) == 0) {
+            return swFALSE;
+        }
+
+        if (*p == '.') {
+            if (pos + lenDecPoint >= sizeof buf) {
+                return swFALSE;
+            }
+            memcpy(buf + pos, decPoint, lenDecPoint);
+            pos += lenDecPoint;
+
+        } else {
+            if (pos + 1 >= sizeof buf) {
+                return swFALSE;
+            }
+            buf[pos] = *p;
+            pos++;
+        }
+    }
+    buf[pos] = '\0';
+
+    *res = strtod(buf, &endStr);
+    return (Bool) (endStr != buf && '\0' == *endStr);
+}
+
 /**
 @brief Convert string to double with error handling
 
 This function implements cert-err34-c
 "Detect errors when converting a string to a number".
 
+Plain decimal numbers are converted by sw_strtod_fast()
+(identical to `strtod()` in the "C" locale);
+all other strings by sw_strtod_locale().
+Both always use `'.'` as decimal point independent of locale.
+
 @param[in] str Pointer to string to be converted.
 @param[in] errMsg Pointer to string included in error message.
 @param[out] LogInfo Holds information on warnings and errors
 */
 double sw_strtod(const char *str, const char *errMsg, LOG_INFO *LogInfo) {
     double resd = HUGE_VAL;
-    char *endStr;
 
-    errno = 0;
+    if (sw_strtod_fast(str, &resd)) {
+        return resd;
+    }
 
-    resd = strtod(str, &endStr);
+    errno = 0;
 
-    if (endStr == str || '\0' != *endStr) {
+    if (!sw_strtod_locale(str, &resd)) {
         LogError(
             LogInfo,
             LOGERROR,
@@ -588,9 +812,9 @@ Bool ChDir(const char *dname) {
 void MkDir(const char *dname, LOG_INFO *LogInfo) {
     /* make a path with 'mkdir -p' -like behavior. provides an
      * interface for portability problems.
-     * RELATIVE PATH ONLY solves problems like "C:\etc" and null
-     * first element in absolute path.
-     * if you need to make an absolute path, use ChDir() first.
+     * an absolute path (leading path separator) is created from the
+     * root directory; paths with a drive letter (e.g., "C:\etc")
+     * require that the drive exists.
      * if you care about mode of new dir, use mkdir(), not MkDir()
      *
      * Notes:
@@ -634,6 +858,17 @@ void MkDir(const char *dname, LOG_INFO *LogInfo) {
     }
 
     buffer[0] = '\0';
+
+    /* keep root of an absolute path, i.e., null first element */
+    if (dname[0] == '/' || dname[0] == '\\') {
+        fullBuffer = sw_memccpy_inc(
+            (void **) &writePtr, endBuffer, (void *) "/", '\0', &writeSize
+        );
+        if (fullBuffer) {
+            goto freeMem;
+        }
+    }
+
     for (i = 0; i < n; i++) {
         fullBuffer = sw_memccpy_inc(
             (void **) &writePtr, endBuffer, (void *) a[i], '\0', &writeSize
@@ -14,8 +14,10 @@
 #include "include/generic.h"    // for EQ, GE, LE, sqrt, squared, Bool, GT, LT
 #include "include/SW_Defines.h" // for missing
 #include <ctype.h>              // for isspace, tolower, toupper
-#include <stdio.h>              // for NULL
-#include <string.h>             // for strchr, strlen, strstr
+#include <float.h>              // for FLT_EVAL_METHOD
+#include <math.h>               // for fabs, fma, isfinite, signbit
+#include <stdio.h>              // for NULL, snprintf
+#include <string.h>             // for strchr, strlen, strstr, memcpy
 
 /* =================================================== */
 /*             Local Function Definitions              */
@@ -209,6 +211,162 @@ char *sw_strtok(
     return newPtr;
 }
 
+/*****************************************************/
+/**
+@brief Split a line into white-space separated tokens
+
+This is a single-pass, allocation-free replacement for `sscanf()`
+with a series of `"%s"` conversions: white space is overwritten in place
+with `'\0'` and \p tokens point to the beginning of each token.
+Currently, only read_weather_hist() splits lines with this function;
+the other text input readers parse small files once per run and
+continue to use `sscanf()` with field widths.
+
+@param[in,out] inputStr String to split (modified in place).
+@param[out] tokens Array of size \p maxTokens receiving pointers to tokens.
+@param[in] maxTokens Maximum number of tokens stored in \p tokens.
+
+@return Number of tokens in \p inputStr which may exceed \p maxTokens
+    (additional tokens are counted but not stored).
+*/
+int sw_split_tokens(char inputStr[], char *tokens[], int maxTokens) {
+    char *p = inputStr;
+    int nTokens = 0;
+
+    for (;;) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            *p = '\0';
+            p++;
+        }
+
+        if (*p == '\0') {
+            break;
+        }
+
+        if (nTokens < maxTokens) {
+            tokens[nTokens] = p;
+        }
+        nTokens++;
+
+        while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r' &&
+               *p != '\n') {
+            p++;
+        }
+    }
+
+    return nTokens;
+}
+
+/*****************************************************/
+/**
+@brief Format a value with a fixed number of decimal digits
+
+Writes \p sep followed by \p value with \p digits decimal digits into
+\p dest; the result is identical to
+`snprintf(dest, destSize, "%c%.*f", sep, digits, value)`.
+
+The fast path converts the correctly rounded, scaled value to an integer
+and prints its digits; the rounding residual of the scaling is obtained
+exactly with `fma()` so that the decision to round up is exact.
+Non-finite values, values too large for the fast path,
+exact ties (whose rounding is implementation-defined), and
+platforms with extended precision intermediates use `snprintf()`.
+
+@param[out] dest Output buffer of size \p destSize.
+@param[in] destSize Size of \p dest.
+@param[in] sep Separator character written before the value.
+@param[in] value Value to format.
+@param[in] digits Number of decimal digits (precision).
+
+@return Number of characters that would have been written if \p destSize
+    had been sufficiently large (not counting the terminating null character)
+    as `snprintf()`.
+*/
+int sw_format_fixed(
+    char *dest, size_t destSize, char sep, double value, int digits
+) {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    static const double pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+    };
+    static const unsigned long long ipow10[] = {
+        1ULL,
+        10ULL,
+        100ULL,
+        1000ULL,
+        10000ULL,
+        100000ULL,
+        1000000ULL,
+        10000000ULL,
+        100000000ULL,
+        1000000000ULL
+    };
+    char tmp[48];
+    char *p = tmp + sizeof tmp;
+    double absValue;
+    double scaled;
+    double residual;
+    double rest;
+    unsigned long long n;
+    unsigned long long ipart;
+    unsigned long long fpart;
+    int k;
+    int len;
+
+    if (digits >= 0 && digits <= 9 && isfinite(value)) {
+        absValue = fabs(value);
+
+        // Scaled value must be below 2^52 so that 0.5 is representable
+        // as the distance to an integer
+        if (absValue < 4503599627370496. / pow10[digits]) {
+            scaled = absValue * pow10[digits];
+            residual = fma(absValue, pow10[digits], -scaled); // exact
+            n = (unsigned long long) scaled;                  // floor
+            rest = scaled - (double) n;                       // exact
+
+            if (rest != 0.5 || residual != 0.) {
+                if (rest > 0.5 || (rest == 0.5 && residual > 0.)) {
+                    n++;
+                }
+
+                ipart = n / ipow10[digits];
+                fpart = n % ipow10[digits];
+
+                // Write digits backwards
+                for (k = 0; k < digits; k++) {
+                    *--p = (char) ('0' + fpart % 10);
+                    fpart /= 10;
+                }
+                if (digits > 0) {
+                    *--p = '.';
+                }
+                do {
+                    *--p = (char) ('0' + ipart % 10);
+                    ipart /= 10;
+                } while (ipart > 0);
+
+                if (signbit(value)) {
+                    *--p = '-';
+                }
+                *--p = sep;
+
+                len = (int) (tmp + sizeof tmp - p);
+
+                if (destSize > 0) {
+                    k = ((size_t) len < destSize) ? len : (int) destSize - 1;
+                    memcpy(dest, p, (size_t) k);
+                    dest[k] = '\0';
+                }
+
+                return len;
+            }
+        }
+    }
+#endif
+
+    return snprintf(dest, destSize, "%c%.*f", sep, digits, value);
+}
+
 /*****************************************************/
 Bool isDelim(char currChar, const char *delim) {
     while (*delim != '\0') {
@@ -586,3 +744,22 @@ double standardDeviation(double inputArray[], unsigned int length) {
 
     return sqrt(total / (finalLength - 1));
 }
+
+/**
+@brief Update a 64-bit FNV-1a hash with a sequence of bytes
+
+Start a new hash with #SW_HASH_INIT.
+
+@param[in,out] hash Hash value
+@param[in] data Bytes to add to the hash
+@param[in] size Number of bytes
+*/
+void sw_hash_bytes(uint64_t *hash, const void *data, size_t size) {
+    const unsigned char *p = (const unsigned char *) data;
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        *hash ^= (uint64_t) p[i];
+        *hash *= 1099511628211ULL; // FNV prime
+    }
+}
@@ -36,6 +36,11 @@
 #include <stdlib.h>                 // for free, malloc, realloc
 #include <string.h>                 // for strlen, memset, strcpy
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h> // for getrusage, RUSAGE_SELF
+#define SW_HAS_GETRUSAGE 1
+#endif
+
 /* =================================================== */
 /*             Global Function Definitions             */
 /* --------------------------------------------------- */
@@ -286,5 +291,27 @@ void reportFullBuffer(int errmode, LOG_INFO *LogInfo) {
     LogError(LogInfo, errmode, "String buffer was too short.", LogInfo);
 }
 
+/**
+@brief Peak memory usage of the program so far
+
+@return Maximum resident set size [kilobytes] of the process;
+    -1 if not available on this platform
+*/
+long Mem_PeakUsage(void) {
+#if defined(SW_HAS_GETRUSAGE)
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        return (long) (usage.ru_maxrss / 1024); // macOS reports bytes
+#else
+        return (long) usage.ru_maxrss;
+#endif
+    }
+#endif
+
+    return -1;
+}
+
 /* ===============  end of block from gen_funcs.c ----------------- */
 /* ================ see also the end of this file ------------------ */
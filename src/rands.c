@@ -31,6 +31,26 @@
 /* --------------------------------------------------- */
 
 
+/* =================================================== */
+/*             Local Function Definitions              */
+/* --------------------------------------------------- */
+
+#ifndef RSOILWAT
+/**
+@brief Mix bits of a 64-bit integer (finalizer of SplitMix64)
+
+Consecutive input values (e.g., seeds or simulation unit identifiers)
+produce well-separated, uncorrelated initial states.
+*/
+static uint64_t mix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+#endif
+
+
 /* =================================================== */
 /*             Global Function Definitions             */
 /* --------------------------------------------------- */
@@ -84,6 +104,88 @@ void RandSeed(
 #endif
 }
 
+/*****************************************************/
+/**
+@brief Set a random number generator to a reproducible stream that is
+    keyed by seed, simulation unit, and stream identifier.
+
+The sequence depends only on the key (`initstate`, `key`, `streamID`) and
+the draw index `nDraws`, i.e., it does not depend on the order in which
+or on how many other generators were seeded or used;
+for instance, simulation units produce identical results independent of
+the order in which (or the process by which) they are simulated.
+
+`initstate` and `key` are mixed into the initial state and `streamID`
+is used as sequence selector (see `RandSeed()`). The generator is then
+advanced to draw `nDraws` of the stream (see `RandAdvance()`).
+
+If `initstate` is `0u`, then the generator is seeded with system time
+(see `RandSeed()`), i.e., the stream is not reproducible.
+
+@param initstate The initial state of the system, e.g., a domain-wide seed.
+@param key Identifier of the simulation unit, e.g., suid.
+@param streamID Identifier of the random number stream,
+    e.g., #SW_RNG_STREAM_MARKOV.
+@param nDraws Number of draws to skip.
+@param[in,out] pcg_rng The random number generator to set.
+*/
+void RandSeedStream(
+    unsigned long initstate,
+    unsigned long key,
+    unsigned long streamID,
+    unsigned long nDraws,
+    sw_random_t *pcg_rng // NOLINT(readability-non-const-parameter)
+) {
+#ifndef RSOILWAT
+    if (initstate == 0u) {
+        RandSeed(0u, mix64(key) ^ streamID, pcg_rng);
+
+    } else {
+        pcg32_srandom_r(
+            pcg_rng, mix64(mix64(initstate) ^ (uint64_t) key), streamID
+        );
+    }
+
+    RandAdvance(nDraws, pcg_rng);
+
+#else
+    // silence compile warnings [-Wunused-parameter]
+    (void) pcg_rng;
+    (void) initstate;
+    (void) key;
+    (void) streamID;
+    (void) nDraws;
+#endif
+}
+
+/*****************************************************/
+/**
+@brief Advance a random number generator by a number of draws.
+
+Jumps ahead in O(log(nDraws)) steps; the next call to `RandUni()` returns
+the same value as if `RandUni()` had been called `nDraws` times.
+Note that other functions may consume more than one draw per call,
+e.g., `RandNorm()`.
+
+@param nDraws Number of draws to skip.
+@param[in,out] pcg_rng The random number generator to advance.
+*/
+void RandAdvance(
+    unsigned long nDraws,
+    sw_random_t *pcg_rng // NOLINT(readability-non-const-parameter)
+) {
+#ifndef RSOILWAT
+    if (nDraws > 0) {
+        pcg32_advance_r(pcg_rng, nDraws);
+    }
+
+#else
+    // silence compile warnings [-Wunused-parameter]
+    (void) pcg_rng;
+    (void) nDraws;
+#endif
+}
+
 /*****************************************************/
 /**
 @brief A pseudo-random number from the uniform distribution.
@@ -322,6 +424,41 @@ void RandUniList(
     free(klist);
 }
 
+/*****************************************************/
+/**
+@brief Fill an array with pseudo-random numbers from the uniform
+    distribution.
+
+Produces the same values as `count` consecutive calls to `RandUni()`.
+
+@param count Number of values to generate.
+@param[out] list Upon return this array will be filled with random values
+    between 0 and 1.
+@param[in,out] *pcg_rng The random number generator to use.
+*/
+void RandUniFill(
+    unsigned long count,
+    double list[],
+    sw_random_t *pcg_rng // NOLINT(readability-non-const-parameter)
+) {
+    unsigned long i;
+
+#ifndef RSOILWAT
+    for (i = 0; i < count; i++) {
+        list[i] = ldexp(pcg32_random_r(pcg_rng), -32);
+    }
+
+#else
+    (void) pcg_rng; // silence compile warnings [-Wunused-parameter]
+
+    GetRNGstate();
+    for (i = 0; i < count; i++) {
+        list[i] = unif_rand();
+    }
+    PutRNGstate();
+#endif
+}
+
 /*****************************************************/
 /**
 @brief A pseudo-random number from a normal distribution.
@@ -0,0 +1,81 @@
+#include "include/generic.h"                  // for swFALSE
+#include "include/SW_Control.h"               // for SW_CTL_init_run
+#include "include/SW_datastructs.h"           // for SW_RUN, LOG_INFO
+#include "include/SW_Flow.h"                  // for SW_Water_Flow
+#include "include/SW_Model.h"                 // for SW_MDL_new_day
+#include "include/SW_SoilWater.h"             // for SW_SWC_end_day
+#include "include/SW_Weather.h"               // for SW_WTH_new_day
+#include "tests/benchmarks/sw_benchhelpers.h" // for setup_benchRun
+#include "tests/gtests/sw_testhelpers.h"      // for create_test_soillayers
+#include <benchmark/benchmark.h> // for State, DoNotOptimize, BENCHMARK
+
+
+namespace {
+/* Daily water flow (SW_Water_Flow()) of one year of the example simulation
+   with soil profiles of typical depth (argument: number of soil layers)
+
+   The first year is simulated before the benchmark so that soil moisture,
+   soil temperature, and the year-specific arrays represent a realistic
+   state; the benchmark then repeats the daily loop of the year (without
+   output aggregation) and reports simulated days per second. */
+void BM_WaterFlow(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    unsigned int const nLayers = (unsigned int) state.range(0);
+    TimeInt *doy = &sw.Model.doy;
+
+    if (setup_benchRun(&sw, &SW_Domain, swFALSE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    create_test_soillayers(nLayers, &sw.VegProd, &sw.Site, &LogInfo);
+    if (!LogInfo.stopRun) {
+        SW_CTL_init_run(&sw, swFALSE, &LogInfo);
+    }
+    if (!LogInfo.stopRun) {
+        sw.Model.doOutput = swFALSE;
+        sw.Model.year = sw.Model.startyr;
+        SW_CTL_run_current_year(&sw, &SW_Domain.OutDom, &LogInfo);
+    }
+    if (LogInfo.stopRun) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    for (auto _ : state) {
+        for (*doy = sw.Model.firstdoy; *doy <= sw.Model.lastdoy; (*doy)++) {
+            SW_MDL_new_day(&sw.Model);
+            SW_WTH_new_day(
+                &sw.Weather,
+                &sw.Site,
+                sw.SoilWat.snowpack,
+                sw.Model.doy,
+                sw.Model.year,
+                &LogInfo
+            );
+            SW_Water_Flow(&sw, &LogInfo);
+            SW_SWC_end_day(&sw.SoilWat, sw.Site.n_layers);
+        }
+
+        benchmark::DoNotOptimize(sw.SoilWat.swcBulk);
+
+        if (LogInfo.stopRun) {
+            state.SkipWithError(LogInfo.errorMsg);
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(
+        (int64_t) state.iterations() *
+        (sw.Model.lastdoy - sw.Model.firstdoy + 1)
+    );
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+} // namespace
+
+BENCHMARK(BM_WaterFlow)->ArgName("nlyrs")->DenseRange(6, 12, 2);
@@ -0,0 +1,558 @@
+#include "include/generic.h"                  // for swTRUE, Bool, LE, LT, GT
+#include "include/SW_datastructs.h"           // for SW_RUN, LOG_INFO
+#include "include/SW_Defines.h"               // for ForEachVegType, MAX_LAYERS
+#include "include/SW_Flow_lib.h"              // for hydraulic_redistribution
+#include "include/SW_SoilWater.h"             // for SLOW_DRAIN_DEPTH
+#include "include/SW_Times.h"                 // for Today
+#include "tests/benchmarks/sw_benchhelpers.h" // for setup_benchRun
+#include <benchmark/benchmark.h> // for State, DoNotOptimize, BENCHMARK
+#include <math.h>                // for exp, fmax, fmin
+#include <string.h>              // for memcpy, memset
+
+
+namespace {
+// Number of soil moisture profiles of the sweep
+const int nProfiles = 5;
+
+// Number of days of the soil temperature sweep
+const unsigned int nDays = 365;
+
+// Maximum number of lanes, i.e., simulation units that are advanced in
+// lockstep by the prototype percolateUnsaturatedLockstep()
+const unsigned int nLanesMax = 8;
+
+/* Soil parameters of lanes with the same number of soil layers;
+   values are stored by soil layer and lane so that the lanes of a layer
+   are contiguous */
+struct LanesSoils {
+    unsigned int nlanes;
+    unsigned int n_layers;
+    double swcBulk_min[MAX_LAYERS][nLanesMax];
+    double swcBulk_fieldcap[MAX_LAYERS][nLanesMax];
+    double swcBulk_saturated[MAX_LAYERS][nLanesMax];
+    double width[MAX_LAYERS][nLanesMax];
+    double impermeability[MAX_LAYERS][nLanesMax];
+    double slow_drain_coeff[nLanesMax];
+};
+
+// Copy soil parameters of each lane (all lanes use the example site)
+void setLanesSoils(
+    LanesSoils *lanes, const SW_SITE *site, unsigned int nlanes
+) {
+    unsigned int w;
+    unsigned int i;
+
+    lanes->nlanes = nlanes;
+    lanes->n_layers = site->n_layers;
+
+    for (w = 0; w < nlanes; w++) {
+        for (i = 0; i < site->n_layers; i++) {
+            lanes->swcBulk_min[i][w] = site->swcBulk_min[i];
+            lanes->swcBulk_fieldcap[i][w] = site->swcBulk_fieldcap[i];
+            lanes->swcBulk_saturated[i][w] = site->swcBulk_saturated[i];
+            lanes->width[i][w] = site->soils.width[i];
+            lanes->impermeability[i][w] = site->soils.impermeability[i];
+        }
+
+        lanes->slow_drain_coeff[w] = site->slow_drain_coeff;
+    }
+}
+
+/* Prototype of a batched engine for one kernel (not used by the simulation):
+   unsaturated percolation of lanes in lockstep (lane loop inside the soil
+   layer loop); each lane does the same arithmetic as percolate_unsaturated()
+   which is checked by BM_PercolateLanesLockstep */
+void percolateUnsaturatedLockstep(
+    double swc[][nLanesMax],
+    double percolate[][nLanesMax],
+    double drainout[],
+    double standingWater[],
+    double lyrFrozen[][nLanesMax],
+    const LanesSoils *lanes,
+    double slow_drain_depth
+) {
+    unsigned int i;
+    unsigned int j;
+    unsigned int w;
+    unsigned int const nlyrs = lanes->n_layers;
+    double d;
+    double swc_avail;
+    double drainpot;
+    double push;
+    double kunsat_rel;
+    double swcrel;
+    double tmp1;
+    double tmp2;
+
+    for (i = 0; i < nlyrs; i++) {
+        for (w = 0; w < lanes->nlanes; w++) {
+            swc_avail = fmax(0., swc[i][w] - lanes->swcBulk_min[i][w]);
+
+            if (LE(swc_avail, 0.)) {
+                d = 0.;
+
+            } else {
+                drainpot = lanes->slow_drain_coeff[w];
+                kunsat_rel = !ZRO(lyrFrozen[i][w]) ? 0.01 : 1.;
+
+                if (LT(swc[i][w], lanes->swcBulk_fieldcap[i][w])) {
+                    swcrel = fmax(
+                        0.,
+                        fmin(
+                            1.,
+                            swc_avail / (lanes->swcBulk_fieldcap[i][w] -
+                                         lanes->swcBulk_min[i][w])
+                        )
+                    );
+
+                    tmp1 = slow_drain_depth * lanes->swcBulk_fieldcap[i][w] /
+                           lanes->width[i][w];
+                    tmp2 = exp(-tmp1);
+
+                    if (LT(tmp2, 1.)) {
+                        drainpot *=
+                            (exp(tmp1 * (swcrel - 1.)) - tmp2) / (1. - tmp2);
+                    } else {
+                        drainpot = 0.;
+                    }
+                }
+
+                d = kunsat_rel * (1. - lanes->impermeability[i][w]) *
+                    fmin(swc_avail, fmax(0., drainpot));
+            }
+
+            percolate[i][w] += d;
+
+            if (i < nlyrs - 1) {
+                swc[i + 1][w] += d;
+                swc[i][w] -= d;
+            } else {
+                d = fmax(d, 0.0);
+                drainout[w] += d;
+                swc[i][w] -= d;
+            }
+        }
+    }
+
+    // push water upwards if a layer is now above saturated water content
+    for (j = nlyrs; j-- > 0;) {
+        for (w = 0; w < lanes->nlanes; w++) {
+            if (GT(swc[j][w], lanes->swcBulk_saturated[j][w])) {
+                push = swc[j][w] - lanes->swcBulk_saturated[j][w];
+                swc[j][w] -= push;
+                if (j > 0) {
+                    percolate[j - 1][w] -= push;
+                    swc[j - 1][w] += push;
+                } else {
+                    standingWater[w] += push;
+                }
+            }
+        }
+    }
+}
+
+/* Soil moisture profiles of the example soil from wilting point
+   (`k = 0`) to field capacity (`k = nProfiles - 1`) */
+void setupProfiles(const SW_RUN *sw, double swc[][MAX_LAYERS]) {
+    int k;
+    unsigned int i;
+    double w;
+
+    for (k = 0; k < nProfiles; k++) {
+        w = (double) k / (nProfiles - 1);
+
+        for (i = 0; i < sw->Site.n_layers; i++) {
+            swc[k][i] = (1. - w) * sw->Site.swcBulk_wiltpt[i] +
+                        w * sw->Site.swcBulk_fieldcap[i];
+        }
+    }
+}
+
+// Hydraulic redistribution by each vegetation type for each soil moisture
+// profile
+void BM_HydraulicRedistribution(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    double swc0[nProfiles][MAX_LAYERS];
+    double swc[MAX_LAYERS];
+    double hydred[MAX_LAYERS];
+    unsigned int k;
+    int p;
+
+    if (setup_benchRun(&sw, &SW_Domain, swTRUE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    setupProfiles(&sw, swc0);
+
+    for (auto _ : state) {
+        for (p = 0; p < nProfiles; p++) {
+            ForEachVegType(k) {
+                memcpy(swc, swc0[p], sizeof(swc));
+
+                hydraulic_redistribution(
+                    swc,
+                    hydred,
+                    &sw.Site,
+                    k,
+                    sw.Site.n_layers,
+                    sw.SoilWat.lyrFrozen,
+                    sw.VegProd.veg[k].maxCondroot,
+                    sw.VegProd.veg[k].swpMatric50,
+                    sw.VegProd.veg[k].shapeCond,
+                    sw.VegProd.veg[k].cov.fCover,
+                    sw.Model.year,
+                    sw.Model.doy,
+                    &LogInfo
+                );
+                benchmark::DoNotOptimize(hydred);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(
+        (int64_t) state.iterations() * nProfiles * NVEGTYPES
+    );
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+
+// Unsaturated percolation for each soil moisture profile
+void BM_PercolateUnsaturated(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    double swc0[nProfiles][MAX_LAYERS];
+    double swc[MAX_LAYERS];
+    double drain[MAX_LAYERS];
+    double drainout;
+    double standingWater;
+    int p;
+
+    if (setup_benchRun(&sw, &SW_Domain, swTRUE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    setupProfiles(&sw, swc0);
+
+    for (auto _ : state) {
+        for (p = 0; p < nProfiles; p++) {
+            memcpy(swc, swc0[p], sizeof(swc));
+            memset(drain, 0, sizeof(drain));
+            drainout = 0.;
+            standingWater = 0.;
+
+            percolate_unsaturated(
+                swc,
+                drain,
+                &drainout,
+                &standingWater,
+                sw.Site.n_layers,
+                sw.SoilWat.lyrFrozen,
+                &sw.Site,
+                sw.Site.slow_drain_coeff,
+                SLOW_DRAIN_DEPTH
+            );
+            benchmark::DoNotOptimize(drainout);
+        }
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nProfiles);
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+
+// Unsaturated percolation of lanes (argument: number of lanes), one lane after
+// the other; lane `w` uses soil moisture profile `w % nProfiles`
+void BM_PercolateLanesSequential(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    unsigned int const nlanes = (unsigned int) state.range(0);
+    double swc0[nProfiles][MAX_LAYERS];
+    double swc[nLanesMax][MAX_LAYERS];
+    double drain[nLanesMax][MAX_LAYERS];
+    double drainout[nLanesMax];
+    double standingWater[nLanesMax];
+    unsigned int w;
+    unsigned int i;
+
+    if (setup_benchRun(&sw, &SW_Domain, swTRUE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    setupProfiles(&sw, swc0);
+
+    for (auto _ : state) {
+        for (w = 0; w < nlanes; w++) {
+            for (i = 0; i < sw.Site.n_layers; i++) {
+                swc[w][i] = swc0[w % nProfiles][i];
+                drain[w][i] = 0.;
+            }
+            drainout[w] = 0.;
+            standingWater[w] = 0.;
+
+            percolate_unsaturated(
+                swc[w],
+                drain[w],
+                &drainout[w],
+                &standingWater[w],
+                sw.Site.n_layers,
+                sw.SoilWat.lyrFrozen,
+                &sw.Site,
+                sw.Site.slow_drain_coeff,
+                SLOW_DRAIN_DEPTH
+            );
+        }
+        benchmark::DoNotOptimize(drainout);
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nlanes);
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+
+// Unsaturated percolation of lanes (argument: number of lanes) in lockstep;
+// same inputs as BM_PercolateLanesSequential
+void BM_PercolateLanesLockstep(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    unsigned int const nlanes = (unsigned int) state.range(0);
+    LanesSoils lanes;
+    double swc0[nProfiles][MAX_LAYERS];
+    double swc[MAX_LAYERS][nLanesMax];
+    double drain[MAX_LAYERS][nLanesMax];
+    double lyrFrozen[MAX_LAYERS][nLanesMax];
+    double drainout[nLanesMax];
+    double standingWater[nLanesMax];
+    double swcExp[MAX_LAYERS];
+    double drainExp[MAX_LAYERS];
+    double drainoutExp;
+    double standingWaterExp;
+    Bool isIdentical = swTRUE;
+    unsigned int w;
+    unsigned int i;
+
+    if (setup_benchRun(&sw, &SW_Domain, swTRUE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    setupProfiles(&sw, swc0);
+    setLanesSoils(&lanes, &sw.Site, nlanes);
+
+    for (w = 0; w < nlanes; w++) {
+        for (i = 0; i < sw.Site.n_layers; i++) {
+            lyrFrozen[i][w] = sw.SoilWat.lyrFrozen[i];
+            swc[i][w] = swc0[w % nProfiles][i];
+            drain[i][w] = 0.;
+        }
+        drainout[w] = 0.;
+        standingWater[w] = 0.;
+    }
+
+    // Check that each lane is identical to percolate_unsaturated()
+    percolateUnsaturatedLockstep(
+        swc, drain, drainout, standingWater, lyrFrozen, &lanes, SLOW_DRAIN_DEPTH
+    );
+
+    for (w = 0; w < nlanes; w++) {
+        memcpy(swcExp, swc0[w % nProfiles], sizeof(swcExp));
+        memset(drainExp, 0, sizeof(drainExp));
+        drainoutExp = 0.;
+        standingWaterExp = 0.;
+
+        percolate_unsaturated(
+            swcExp,
+            drainExp,
+            &drainoutExp,
+            &standingWaterExp,
+            sw.Site.n_layers,
+            sw.SoilWat.lyrFrozen,
+            &sw.Site,
+            sw.Site.slow_drain_coeff,
+            SLOW_DRAIN_DEPTH
+        );
+
+        isIdentical = (Bool) (isIdentical && drainout[w] == drainoutExp &&
+                              standingWater[w] == standingWaterExp);
+        for (i = 0; i < sw.Site.n_layers; i++) {
+            isIdentical = (Bool) (isIdentical && swc[i][w] == swcExp[i] &&
+                                  drain[i][w] == drainExp[i]);
+        }
+    }
+
+    if (!isIdentical) {
+        state.SkipWithError("Lockstep differs from percolate_unsaturated().");
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    for (auto _ : state) {
+        for (w = 0; w < nlanes; w++) {
+            for (i = 0; i < sw.Site.n_layers; i++) {
+                swc[i][w] = swc0[w % nProfiles][i];
+                drain[i][w] = 0.;
+            }
+            drainout[w] = 0.;
+            standingWater[w] = 0.;
+        }
+
+        percolateUnsaturatedLockstep(
+            swc,
+            drain,
+            drainout,
+            standingWater,
+            lyrFrozen,
+            &lanes,
+            SLOW_DRAIN_DEPTH
+        );
+        benchmark::DoNotOptimize(drainout);
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nlanes);
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+
+// Weighted average of soil water potential across transpiration regions
+// for each vegetation type and soil moisture profile
+void BM_TranspWeightedAvg(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    double swc0[nProfiles][MAX_LAYERS];
+    double swp_avg;
+    unsigned int k;
+    int p;
+
+    if (setup_benchRun(&sw, &SW_Domain, swTRUE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    setupProfiles(&sw, swc0);
+
+    for (auto _ : state) {
+        for (p = 0; p < nProfiles; p++) {
+            ForEachVegType(k) {
+                transp_weighted_avg(
+                    &swp_avg,
+                    &sw.Site,
+                    sw.Site.n_transp_rgn,
+                    sw.Site.n_transp_lyrs[k],
+                    sw.Site.my_transp_rgn[k],
+                    swc0[p],
+                    (int) k,
+                    &LogInfo
+                );
+                benchmark::DoNotOptimize(swp_avg);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(
+        (int64_t) state.iterations() * nProfiles * NVEGTYPES
+    );
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+
+// Soil temperature for each day of the last year of example weather
+// starting from the state at the end of the example simulation
+void BM_SoilTemperature(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    const SW_WEATHER_HIST *wh;
+    double biomass[MAX_DAYS];
+    unsigned int doy;
+    unsigned int k;
+
+    if (setup_benchRun(&sw, &SW_Domain, swTRUE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    wh = &sw.Weather.allHist[sw.Weather.n_years - 1];
+
+    // Live biomass as used by `SW_Water_Flow()`
+    for (doy = 1; doy <= nDays; doy++) {
+        biomass[doy] = 0.;
+        ForEachVegType(k) {
+            biomass[doy] += ((k == SW_TREES || k == SW_SHRUB) ?
+                                 sw.VegProd.veg[k].biolive_daily[doy] :
+                                 sw.VegProd.veg[k].biomass_daily[doy]) *
+                            sw.VegProd.veg[k].cov.fCover;
+        }
+    }
+
+    for (auto _ : state) {
+        for (doy = 1; doy <= nDays; doy++) {
+            soil_temperature(
+                &sw.StRegValues,
+                &sw.Weather.surfaceMin,
+                &sw.Weather.surfaceAvg,
+                &sw.Weather.surfaceMax,
+                sw.SoilWat.minLyrTemperature,
+                sw.SoilWat.avgLyrTemp,
+                sw.SoilWat.maxLyrTemperature,
+                sw.SoilWat.lyrFrozen,
+                sw.Site.methodSurfaceTemperature,
+                sw.SoilWat.snowpack[Today],
+                wh->temp_min[doy - 1],
+                wh->temp_avg[doy - 1],
+                wh->temp_max[doy - 1],
+                sw.SoilWat.H_gt,
+                sw.SoilWat.pet,
+                sw.SoilWat.aet,
+                biomass[doy],
+                sw.SoilWat.swcBulk[Today],
+                sw.Site.swcBulk_saturated,
+                sw.Site.soilBulk_density,
+                sw.Site.soils.width,
+                sw.Site.soils.depths,
+                sw.Site.n_layers,
+                sw.Site.bmLimiter,
+                sw.Site.t1Param1,
+                sw.Site.t1Param2,
+                sw.Site.t1Param3,
+                sw.Site.csParam1,
+                sw.Site.csParam2,
+                sw.Site.shParam,
+                sw.Site.Tsoil_constant,
+                sw.Site.stDeltaX,
+                sw.Site.stMaxDepth,
+                sw.Site.stNRGR,
+                sw.Model.year,
+                doy,
+                &sw.SoilWat.soiltempError,
+                &LogInfo
+            );
+        }
+        benchmark::DoNotOptimize(sw.SoilWat.avgLyrTemp);
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nDays);
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+} // namespace
+
+BENCHMARK(BM_HydraulicRedistribution);
+BENCHMARK(BM_PercolateUnsaturated);
+BENCHMARK(BM_PercolateLanesSequential)->ArgName("lanes")->Arg(4)->Arg(8);
+BENCHMARK(BM_PercolateLanesLockstep)->ArgName("lanes")->Arg(4)->Arg(8);
+BENCHMARK(BM_TranspWeightedAvg);
+BENCHMARK(BM_SoilTemperature);
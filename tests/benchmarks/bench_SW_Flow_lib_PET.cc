@@ -0,0 +1,152 @@
+#include "include/generic.h"                  // for swFALSE
+#include "include/SW_datastructs.h"           // for SW_RUN, SW_ATMD, LOG_INFO
+#include "include/SW_Defines.h"               // for ForEachVegType, MAX_DAYS
+#include "include/SW_Flow_lib_PET.h"          // for petfunc, solar_radiation
+#include "tests/benchmarks/sw_benchhelpers.h" // for setup_benchRun
+#include <benchmark/benchmark.h> // for State, DoNotOptimize, BENCHMARK
+
+
+namespace {
+// Number of days of the sweep (first year of example weather)
+const unsigned int nDays = 365;
+
+// Albedo of the example site as used by `SW_Water_Flow()`
+double siteAlbedo(const SW_RUN *sw) {
+    unsigned int k;
+    double albedo =
+        sw->VegProd.bare_cov.albedo * sw->VegProd.bare_cov.fCover;
+
+    ForEachVegType(k) {
+        albedo += sw->VegProd.veg[k].cov.albedo * sw->VegProd.veg[k].cov.fCover;
+    }
+
+    return albedo;
+}
+
+// Solar radiation for each day of a year of example weather;
+// memoized values are reset every iteration
+void BM_SolarRadiation(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    SW_ATMD SW_AtmDemand;
+    LOG_INFO LogInfo;
+    const SW_WEATHER_HIST *wh;
+    unsigned int doy;
+    double albedo;
+    double cloudCover;
+    double H_oh;
+    double H_ot;
+    double H_gh;
+
+    if (setup_benchRun(&sw, &SW_Domain, swFALSE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    wh = &sw.Weather.allHist[0];
+    albedo = siteAlbedo(&sw);
+
+    for (auto _ : state) {
+        SW_PET_init_run(&SW_AtmDemand);
+
+        for (doy = 1; doy <= nDays; doy++) {
+            cloudCover = wh->cloudcov_daily[doy - 1];
+
+            benchmark::DoNotOptimize(solar_radiation(
+                &SW_AtmDemand,
+                doy,
+                sw.Model.latitude,
+                sw.Model.elevation,
+                sw.Model.slope,
+                sw.Model.aspect,
+                albedo,
+                &cloudCover,
+                wh->actualVaporPressure[doy - 1],
+                wh->shortWaveRad[doy - 1],
+                sw.Weather.desc_rsds,
+                &H_oh,
+                &H_ot,
+                &H_gh,
+                &LogInfo
+            ));
+        }
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nDays);
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+
+// PET for each day of a year of example weather
+void BM_PetFunc(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    SW_ATMD SW_AtmDemand;
+    LOG_INFO LogInfo;
+    const SW_WEATHER_HIST *wh;
+    unsigned int doy;
+    double albedo;
+    double cloudCover[MAX_DAYS];
+    double H_gt[MAX_DAYS];
+    double H_oh;
+    double H_ot;
+    double H_gh;
+
+    if (setup_benchRun(&sw, &SW_Domain, swFALSE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    wh = &sw.Weather.allHist[0];
+    albedo = siteAlbedo(&sw);
+
+    // Radiation as input to PET
+    SW_PET_init_run(&SW_AtmDemand);
+
+    for (doy = 1; doy <= nDays; doy++) {
+        cloudCover[doy - 1] = wh->cloudcov_daily[doy - 1];
+
+        H_gt[doy - 1] = solar_radiation(
+            &SW_AtmDemand,
+            doy,
+            sw.Model.latitude,
+            sw.Model.elevation,
+            sw.Model.slope,
+            sw.Model.aspect,
+            albedo,
+            &cloudCover[doy - 1],
+            wh->actualVaporPressure[doy - 1],
+            wh->shortWaveRad[doy - 1],
+            sw.Weather.desc_rsds,
+            &H_oh,
+            &H_ot,
+            &H_gh,
+            &LogInfo
+        );
+    }
+
+    for (auto _ : state) {
+        for (doy = 0; doy < nDays; doy++) {
+            benchmark::DoNotOptimize(petfunc(
+                H_gt[doy],
+                wh->temp_avg[doy],
+                sw.Model.elevation,
+                albedo,
+                wh->r_humidity_daily[doy],
+                wh->windspeed_daily[doy],
+                cloudCover[doy],
+                &LogInfo
+            ));
+        }
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nDays);
+
+    teardown_benchRun(&sw, &SW_Domain);
+}
+} // namespace
+
+BENCHMARK(BM_SolarRadiation);
+BENCHMARK(BM_PetFunc);
@@ -0,0 +1,75 @@
+#include "include/rands.h"                // for RandNorm, RandSeed
+#include "include/SW_datastructs.h"      // for SW_MARKOV, LOG_INFO
+#include "include/SW_Defines.h"          // for sw_random_t
+#include "include/SW_Main_lib.h"         // for sw_init_logs
+#include "include/SW_Markov.h"           // for SW_MKV_setup, SW_MKV_today
+#include "tests/gtests/sw_testhelpers.h" // for template_SW_Domain
+#include <benchmark/benchmark.h>        // for State, DoNotOptimize, BENCHMARK
+
+
+namespace {
+// Number of days of the sweep
+const unsigned int nDays = 365;
+
+// Number of random draws per iteration
+const int nDraws = 1000;
+
+// Generate a year of daily weather with the weather generator that is
+// parameterized by the example inputs "mkv_prob.in" and "mkv_covar.in"
+void BM_SW_MKV_today(benchmark::State &state) {
+    SW_MARKOV SW_Markov;
+    LOG_INFO LogInfo;
+    unsigned int const generateWeatherMethod = 2;
+    unsigned int doy0;
+    double tmax;
+    double tmin;
+    double ppt = 0.; // `SW_MKV_today()` uses incoming value of `ppt`
+
+    sw_init_logs(NULL, &LogInfo);
+
+    SW_MKV_init_ptrs(&SW_Markov);
+    SW_MKV_setup(
+        &SW_Markov,
+        42,
+        generateWeatherMethod,
+        template_SW_Domain.SW_PathInputs.txtInFiles,
+        &LogInfo
+    );
+    if (LogInfo.stopRun) {
+        state.SkipWithError(LogInfo.errorMsg);
+        SW_MKV_deconstruct(&SW_Markov);
+        return;
+    }
+
+    for (auto _ : state) {
+        for (doy0 = 0; doy0 < nDays; doy0++) {
+            SW_MKV_today(&SW_Markov, doy0, 1980, &tmax, &tmin, &ppt, &LogInfo);
+        }
+        benchmark::DoNotOptimize(ppt);
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nDays);
+
+    SW_MKV_deconstruct(&SW_Markov);
+}
+
+// Draw normally distributed random numbers with the location and scale
+// of daily maximum air temperature
+void BM_RandNorm(benchmark::State &state) {
+    sw_random_t rng;
+    int k;
+
+    RandSeed(42u, 1u, &rng);
+
+    for (auto _ : state) {
+        for (k = 0; k < nDraws; k++) {
+            benchmark::DoNotOptimize(RandNorm(15., 8., &rng));
+        }
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nDraws);
+}
+} // namespace
+
+BENCHMARK(BM_SW_MKV_today);
+BENCHMARK(BM_RandNorm);
@@ -0,0 +1,77 @@
+#include "include/generic.h"             // for swTRUE, swFALSE
+#include "include/SW_Control.h"          // for SW_CTL_main, SW_RUN_deepCopy
+#include "include/SW_datastructs.h"      // for SW_RUN, SW_DOMAIN, LOG_INFO
+#include "include/SW_Defines.h"          // for ForEachOutKey
+#include "include/SW_Domain.h"           // for SW_DOM_deepCopy
+#include "include/SW_Main_lib.h"         // for sw_init_logs
+#include "include/SW_Output.h"           // for find_OutPeriods_inUse
+#include "tests/gtests/sw_testhelpers.h" // for template_SW_Run
+#include <benchmark/benchmark.h>        // for State, BENCHMARK, kMillisecond
+
+
+namespace {
+/* Simulate the example and aggregate output values (without writing output
+   files) with few output keys (argument 0: temperature, precipitation and
+   soil moisture) or with all output keys of the example (argument 1);
+   the difference indicates the cost of output dispatch and aggregation */
+void BM_OutputDispatch(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    Bool const allKeys = (Bool) (state.range(0) != 0);
+    unsigned int k;
+
+    sw_init_logs(NULL, &LogInfo);
+
+    SW_DOM_deepCopy(&template_SW_Domain, &SW_Domain, &LogInfo);
+    if (LogInfo.stopRun) {
+        state.SkipWithError(LogInfo.errorMsg);
+        SW_DOM_deconstruct(&SW_Domain);
+        return;
+    }
+
+    SW_Domain.OutDom.print_SW_Output = swFALSE;
+
+    if (!allKeys) {
+        ForEachOutKey(k) {
+            SW_Domain.OutDom.use[k] =
+                (Bool) (SW_Domain.OutDom.use[k] &&
+                        (k == eSW_Temp || k == eSW_Precip || k == eSW_SWCBulk));
+        }
+        find_OutPeriods_inUse(&SW_Domain.OutDom);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        SW_RUN_deepCopy(
+            &template_SW_Run, &sw, &SW_Domain.OutDom, swTRUE, &LogInfo
+        );
+        sw.Model.doOutput = swTRUE;
+        state.ResumeTiming();
+
+        SW_CTL_main(&sw, &SW_Domain.OutDom, &LogInfo);
+
+        state.PauseTiming();
+        SW_CTL_clear_model(swTRUE, &sw);
+        state.ResumeTiming();
+
+        if (LogInfo.stopRun) {
+            state.SkipWithError(LogInfo.errorMsg);
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(
+        (int64_t) state.iterations() *
+        (template_SW_Run.Model.endyr - template_SW_Run.Model.startyr + 1)
+    );
+
+    SW_DOM_deconstruct(&SW_Domain);
+}
+} // namespace
+
+BENCHMARK(BM_OutputDispatch)
+    ->ArgName("allKeys")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
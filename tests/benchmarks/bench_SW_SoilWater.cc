@@ -0,0 +1,193 @@
+#include "include/SW_datastructs.h"      // for LOG_INFO, SW_SITE
+#include "include/SW_Defines.h"          // for SWRC_PARAM_NMAX, MAX_LAYERS
+#include "include/SW_Main_lib.h"         // for sw_init_logs
+#include "include/SW_Site.h"             // for SWRC_PTF_estimate_parameters
+#include "include/SW_SoilWater.h"        // for SWRC_SWCtoSWP, SWRC_SWPtoSWC
+#include "tests/gtests/sw_testhelpers.h" // for template_SW_Run
+#include <benchmark/benchmark.h>        // for State, DoNotOptimize, BENCHMARK
+#include <string.h>                      // for memset
+
+
+namespace {
+// Number of soil moisture values per soil layer
+const int nSWC = 32;
+
+// SWP values [-bar] from saturation to beyond the air-dry limit
+// (FXW maxes out at 6178.19079 bar)
+const double swps[] = {
+    0., 0.001, 0.01, 0.026, 0.027, 0.1, 0.33, 1., 3., 10., 15., 30., 100., 300.
+};
+const int nSWP = (int) (sizeof(swps) / sizeof(swps[0]));
+
+/* Obtain SWRC parameters for the soil layers of the example simulation
+
+   Campbell1974 parameters are estimated with the PTF "Cosby1984AndOthers"
+   from the texture of each soil layer; PTFs of vanGenuchten1980 and FXW are
+   not implemented in C and the hard-coded parameters of the unit tests
+   (see `test_SW_SoilWater.cc`) are used for every soil layer.
+*/
+void getSWRCp(
+    unsigned int swrc_type,
+    double swrcp[][SWRC_PARAM_NMAX],
+    LOG_INFO *LogInfo
+) {
+    const SW_SITE *SW_Site = &template_SW_Run.Site;
+    unsigned int i;
+
+    for (i = 0; i < SW_Site->n_layers; i++) {
+        memset(swrcp[i], 0, SWRC_PARAM_NMAX * sizeof(swrcp[i][0]));
+
+        switch (swrc_type) {
+        case sw_Campbell1974:
+            SWRC_PTF_estimate_parameters(
+                sw_Cosby1984AndOthers,
+                swrcp[i],
+                SW_Site->soils.fractionWeightMatric_sand[i],
+                SW_Site->soils.fractionWeightMatric_clay[i],
+                SW_Site->soils.fractionVolBulk_gravel[i],
+                SW_Site->soilBulk_density[i],
+                LogInfo
+            );
+            break;
+
+        case sw_vanGenuchten1980:
+            swrcp[i][0] = 0.11214750;
+            swrcp[i][1] = 0.4213539;
+            swrcp[i][2] = 0.007735474;
+            swrcp[i][3] = 1.344678;
+            swrcp[i][4] = 7.78506;
+            break;
+
+        default:
+            swrcp[i][0] = 0.437461;
+            swrcp[i][1] = 0.050757;
+            swrcp[i][2] = 1.247689;
+            swrcp[i][3] = 0.308681;
+            swrcp[i][4] = 22.985379;
+            swrcp[i][5] = 2.697338;
+            break;
+        }
+    }
+}
+
+// Range of matric VWC [cm / cm] in which a SWRC is defined
+void getThetaRange(
+    unsigned int swrc_type,
+    const double *swrcp,
+    double *thetaMin,
+    double *thetaSat
+) {
+    switch (swrc_type) {
+    case sw_Campbell1974:
+        *thetaMin = 0.;
+        *thetaSat = swrcp[1];
+        break;
+
+    case sw_vanGenuchten1980:
+        *thetaMin = swrcp[0];
+        *thetaSat = swrcp[1];
+        break;
+
+    default:
+        *thetaMin = 0.;
+        *thetaSat = swrcp[0];
+        break;
+    }
+}
+
+// SWC -> SWP: sweep soil moisture of each example soil layer from
+// the residual water content to saturation
+void BM_SWRC_SWCtoSWP(benchmark::State &state) {
+    const SW_SITE *SW_Site = &template_SW_Run.Site;
+    unsigned int const swrc_type = (unsigned int) state.range(0);
+    unsigned int i;
+    int k;
+    double swrcp[MAX_LAYERS][SWRC_PARAM_NMAX];
+    double swc[MAX_LAYERS][nSWC];
+    double thetaMin;
+    double thetaSat;
+    double width;
+    double gravel;
+    LOG_INFO LogInfo;
+
+    sw_init_logs(NULL, &LogInfo);
+    getSWRCp(swrc_type, swrcp, &LogInfo);
+    if (LogInfo.stopRun) {
+        state.SkipWithError(LogInfo.errorMsg);
+        return;
+    }
+
+    for (i = 0; i < SW_Site->n_layers; i++) {
+        width = SW_Site->soils.width[i];
+        gravel = SW_Site->soils.fractionVolBulk_gravel[i];
+        getThetaRange(swrc_type, swrcp[i], &thetaMin, &thetaSat);
+
+        for (k = 0; k < nSWC; k++) {
+            // matric VWC in ]theta_min, theta_sat]
+            swc[i][k] = (thetaMin + (thetaSat - thetaMin) * (k + 1) / nSWC) *
+                        width * (1. - gravel);
+        }
+    }
+
+    for (auto _ : state) {
+        for (i = 0; i < SW_Site->n_layers; i++) {
+            for (k = 0; k < nSWC; k++) {
+                benchmark::DoNotOptimize(SWRC_SWCtoSWP(
+                    swc[i][k],
+                    swrc_type,
+                    swrcp[i],
+                    SW_Site->soils.fractionVolBulk_gravel[i],
+                    SW_Site->soils.width[i],
+                    LOGWARN,
+                    &LogInfo
+                ));
+            }
+        }
+    }
+
+    state.SetItemsProcessed(
+        (int64_t) state.iterations() * SW_Site->n_layers * nSWC
+    );
+}
+
+// SWP -> SWC: sweep soil water potential of each example soil layer from
+// saturation to beyond wilting point
+void BM_SWRC_SWPtoSWC(benchmark::State &state) {
+    const SW_SITE *SW_Site = &template_SW_Run.Site;
+    unsigned int const swrc_type = (unsigned int) state.range(0);
+    unsigned int i;
+    int k;
+    double swrcp[MAX_LAYERS][SWRC_PARAM_NMAX];
+    LOG_INFO LogInfo;
+
+    sw_init_logs(NULL, &LogInfo);
+    getSWRCp(swrc_type, swrcp, &LogInfo);
+    if (LogInfo.stopRun) {
+        state.SkipWithError(LogInfo.errorMsg);
+        return;
+    }
+
+    for (auto _ : state) {
+        for (i = 0; i < SW_Site->n_layers; i++) {
+            for (k = 0; k < nSWP; k++) {
+                benchmark::DoNotOptimize(SWRC_SWPtoSWC(
+                    swps[k],
+                    swrc_type,
+                    swrcp[i],
+                    SW_Site->soils.fractionVolBulk_gravel[i],
+                    SW_Site->soils.width[i],
+                    LOGWARN,
+                    &LogInfo
+                ));
+            }
+        }
+    }
+
+    state.SetItemsProcessed(
+        (int64_t) state.iterations() * SW_Site->n_layers * nSWP
+    );
+}
+} // namespace
+
+BENCHMARK(BM_SWRC_SWCtoSWP)->ArgName("swrc")->DenseRange(0, N_SWRCs - 1);
+BENCHMARK(BM_SWRC_SWPtoSWC)->ArgName("swrc")->DenseRange(0, N_SWRCs - 1);
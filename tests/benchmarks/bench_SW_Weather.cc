@@ -0,0 +1,100 @@
+#include "include/filefuncs.h"                // for MkDir
+#include "include/generic.h"                  // for Bool, swFALSE
+#include "include/SW_datastructs.h"           // for SW_RUN, LOG_INFO
+#include "include/SW_Weather.h"               // for SW_WTH_calc_climate_ave...
+#include "tests/benchmarks/sw_benchhelpers.h" // for setup_benchRun
+#include <benchmark/benchmark.h> // for State, DoNotOptimize, BENCHMARK
+#include <stdint.h>                           // for uint64_t
+#include <stdio.h>                            // for snprintf, remove
+
+
+namespace {
+// Directory of cached climate summaries (relative to the example)
+const char *const climCacheDir = "Output/bench_clim";
+
+// Across-year climate summary of the example weather (31 years) that is
+// used to estimate vegetation from climate
+// (argument: 0, calculate; 1, hash of daily weather only;
+// 2, obtain from cache, i.e., hash and read cached summary)
+void BM_ClimateAverages(benchmark::State &state) {
+    SW_RUN sw;
+    SW_DOMAIN SW_Domain;
+    LOG_INFO LogInfo;
+    SW_CLIMATE_YEARLY climateOutput;
+    SW_CLIMATE_CLIM climateAverages;
+    int const mode = (int) state.range(0);
+    unsigned int numYears;
+    Bool const inNorthHem = swTRUE;
+    char fname[FILENAME_MAX];
+    uint64_t hash;
+
+    if (setup_benchRun(&sw, &SW_Domain, swFALSE, &LogInfo) != 0) {
+        state.SkipWithError(LogInfo.errorMsg);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    numYears = sw.Model.endyr - sw.Model.startyr + 1;
+
+    allocateClimateStructs(numYears, &climateOutput, &climateAverages, &LogInfo);
+    if (!LogInfo.stopRun && mode == 2) {
+        MkDir(climCacheDir, &LogInfo);
+    }
+    if (LogInfo.stopRun) {
+        state.SkipWithError(LogInfo.errorMsg);
+        deallocateClimateStructs(&climateOutput, &climateAverages);
+        teardown_benchRun(&sw, &SW_Domain);
+        return;
+    }
+
+    for (auto _ : state) {
+        if (mode == 1) {
+            benchmark::DoNotOptimize(SW_WTH_hash_climate(
+                sw.Weather.allHist, numYears, sw.Model.startyr, inNorthHem
+            ));
+
+        } else {
+            SW_WTH_calc_climate_averages(
+                sw.Weather.allHist,
+                sw.Model.cum_monthdays,
+                sw.Model.days_in_month,
+                numYears,
+                sw.Model.startyr,
+                inNorthHem,
+                (mode == 2) ? climCacheDir : NULL,
+                &climateOutput,
+                &climateAverages,
+                &LogInfo
+            );
+            benchmark::DoNotOptimize(climateAverages.meanTemp_C);
+        }
+
+        if (LogInfo.stopRun) {
+            state.SkipWithError(LogInfo.errorMsg);
+            break;
+        }
+    }
+
+    if (mode == 2) {
+        // Remove cached climate summary and cache directory
+        hash = SW_WTH_hash_climate(
+            sw.Weather.allHist, numYears, sw.Model.startyr, inNorthHem
+        );
+        (void) snprintf(
+            fname,
+            sizeof fname,
+            "%s/climate_%016llx.%s",
+            climCacheDir,
+            (unsigned long long) hash,
+            SW_CLIM_CACHE_EXT
+        );
+        (void) remove(fname);
+        (void) remove(climCacheDir);
+    }
+
+    deallocateClimateStructs(&climateOutput, &climateAverages);
+    teardown_benchRun(&sw, &SW_Domain);
+}
+} // namespace
+
+BENCHMARK(BM_ClimateAverages)->ArgName("mode")->DenseRange(0, 2);
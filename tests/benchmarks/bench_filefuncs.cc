@@ -0,0 +1,139 @@
+#include "include/filefuncs.h"           // for sw_strtod
+#include "include/generic.h"             // for sw_split_tokens
+#include "include/rands.h"               // for RandNorm, RandSeed
+#include "include/SW_datastructs.h"      // for LOG_INFO
+#include "include/SW_Defines.h"          // for MAX_FILENAMESIZE, sw_random_t
+#include "include/SW_Main_lib.h"         // for sw_init_logs
+#include "tests/gtests/sw_testhelpers.h" // for template_SW_Run
+#include <benchmark/benchmark.h>        // for State, DoNotOptimize, BENCHMARK
+#include <math.h>                        // for cos, fmax
+#include <stdio.h>                       // for snprintf, fopen, fgets
+#include <stdlib.h>                      // for strtod
+#include <string.h>                      // for strcpy
+#include <string>                        // for string
+#include <vector>                        // for vector
+
+
+namespace {
+// Number of years of the synthetic daily weather
+const int nSyntheticYears = 1000;
+
+// Maximum number of values per line
+const int maxTokens = 16;
+
+/* Lines of daily weather input (comments removed)
+
+   Argument 0: example weather of tests/example/Input/data_weather/
+   Argument 1: synthetic daily weather of 1000 years (same format) */
+const std::vector<std::string> &weatherLines(int dataset) {
+    static std::vector<std::string> lines[2];
+    std::vector<std::string> &res = lines[dataset];
+    const SW_WEATHER *w = &template_SW_Run.Weather;
+    char fname[2 * MAX_FILENAMESIZE];
+    char buf[MAX_FILENAMESIZE];
+    unsigned int year;
+    unsigned int doy;
+    double tmax;
+    double tmin;
+    double ppt;
+    sw_random_t rng;
+    FILE *f;
+
+    if (!res.empty()) {
+        return res;
+    }
+
+    if (dataset == 0) {
+        for (year = w->startYear; year < w->startYear + w->n_years; year++) {
+            (void) snprintf(
+                fname, sizeof fname, "%s.%4u", w->name_prefix, year
+            );
+            f = fopen(fname, "r");
+            if (f == NULL) {
+                continue; // years without inputs are generated
+            }
+
+            while (fgets(buf, sizeof buf, f) != NULL) {
+                if (buf[0] != '#') {
+                    res.emplace_back(buf);
+                }
+            }
+            (void) fclose(f);
+        }
+
+    } else {
+        RandSeed(42u, 1u, &rng);
+
+        for (year = 0; year < (unsigned int) nSyntheticYears; year++) {
+            for (doy = 1; doy <= 365; doy++) {
+                tmax = 15. - 12. * cos(2. * 3.14159265 * doy / 365.) +
+                       RandNorm(0., 4., &rng);
+                tmin = tmax - fmax(2., RandNorm(12., 3., &rng));
+                ppt = fmax(0., RandNorm(-0.3, 0.6, &rng));
+
+                (void) snprintf(
+                    buf,
+                    sizeof buf,
+                    "%u\t%.2f\t%.2f\t%.2f\n",
+                    doy,
+                    tmax,
+                    tmin,
+                    ppt
+                );
+                res.emplace_back(buf);
+            }
+        }
+    }
+
+    return res;
+}
+
+/* Split lines into white-space separated tokens and convert each token to
+   a number, i.e., the steps of reading daily weather inputs;
+   the parser is `sw_strtod()` or, as baseline, `strtod()` */
+void parseWeather(benchmark::State &state, Bool useSWParser) {
+    const std::vector<std::string> &lines = weatherLines((int) state.range(0));
+    char line[MAX_FILENAMESIZE];
+    char *tokens[maxTokens];
+    int nTokens;
+    int k;
+    int64_t nValues = 0;
+    double value;
+    LOG_INFO LogInfo;
+
+    sw_init_logs(NULL, &LogInfo);
+
+    if (lines.empty()) {
+        state.SkipWithError("No daily weather inputs found.");
+        return;
+    }
+
+    for (auto _ : state) {
+        nValues = 0;
+
+        for (const std::string &s : lines) {
+            (void) strcpy(line, s.c_str());
+            nTokens = sw_split_tokens(line, tokens, maxTokens);
+
+            for (k = 0; k < nTokens && k < maxTokens; k++) {
+                value = useSWParser ?
+                            sw_strtod(tokens[k], "weather", &LogInfo) :
+                            strtod(tokens[k], NULL);
+                benchmark::DoNotOptimize(value);
+            }
+            nValues += k;
+        }
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * nValues);
+}
+
+void BM_ParseWeather(benchmark::State &state) { parseWeather(state, swTRUE); }
+
+void BM_ParseWeatherStrtod(benchmark::State &state) {
+    parseWeather(state, swFALSE);
+}
+} // namespace
+
+BENCHMARK(BM_ParseWeather)->ArgName("synthetic")->Arg(0)->Arg(1);
+BENCHMARK(BM_ParseWeatherStrtod)->ArgName("synthetic")->Arg(0)->Arg(1);
@@ -0,0 +1,50 @@
+#include "tests/benchmarks/sw_benchhelpers.h"
+#include "include/generic.h"             // for Bool, swTRUE
+#include "include/SW_Control.h"          // for SW_CTL_main, SW_RUN_deepCopy
+#include "include/SW_datastructs.h"      // for SW_RUN, SW_DOMAIN, LOG_INFO
+#include "include/SW_Domain.h"           // for SW_DOM_deepCopy
+#include "include/SW_Main_lib.h"         // for sw_init_logs
+#include "tests/gtests/sw_testhelpers.h" // for template_SW_Run
+
+
+/**
+@brief Deep copy the example simulation (set up by
+`setup_testGlobalSoilwatTemplate()`) for a benchmark
+
+@param[out] sw Copy of the example simulation run
+@param[out] SW_Domain Copy of the example simulation domain
+@param[in] simulate If TRUE, then simulate the example so that \p sw
+    represents a realistic state at the end of the simulation period
+@param[out] LogInfo Holds information on warnings and errors
+
+@return 0 on success, 1 on failure (see \p LogInfo)
+*/
+int setup_benchRun(
+    SW_RUN *sw, SW_DOMAIN *SW_Domain, Bool simulate, LOG_INFO *LogInfo
+) {
+    sw_init_logs(NULL, LogInfo);
+
+    SW_DOM_deepCopy(&template_SW_Domain, SW_Domain, LogInfo);
+    if (LogInfo->stopRun) {
+        return 1; // Exit function prematurely due to error
+    }
+
+    SW_RUN_deepCopy(
+        &template_SW_Run, sw, &template_SW_Domain.OutDom, swTRUE, LogInfo
+    );
+    if (LogInfo->stopRun) {
+        return 1; // Exit function prematurely due to error
+    }
+
+    if (simulate) {
+        SW_CTL_main(sw, &SW_Domain->OutDom, LogInfo);
+    }
+
+    return LogInfo->stopRun ? 1 : 0;
+}
+
+/** Free memory allocated by `setup_benchRun()` */
+void teardown_benchRun(SW_RUN *sw, SW_DOMAIN *SW_Domain) {
+    SW_DOM_deconstruct(SW_Domain);
+    SW_CTL_clear_model(swTRUE, sw);
+}
@@ -0,0 +1,11 @@
+#include "include/generic.h"        // for Bool
+#include "include/SW_datastructs.h" // for SW_RUN, SW_DOMAIN, LOG_INFO
+
+
+/* Functions for benchmarks */
+
+int setup_benchRun(
+    SW_RUN *sw, SW_DOMAIN *SW_Domain, Bool simulate, LOG_INFO *LogInfo
+);
+
+void teardown_benchRun(SW_RUN *sw, SW_DOMAIN *SW_Domain);
@@ -0,0 +1,62 @@
+#include "include/filefuncs.h"          // for ChDir
+#include "include/generic.h"            // for sw_printf
+#include "tests/gtests/sw_testhelpers.h" // for setup_testGlobalSoilwatTemplate
+#include <benchmark/benchmark.h>        // for Initialize, RunSpecifiedBench...
+
+
+/* The benchmarks are using the SOILWAT2-standalone input files from
+   tests/example/ as example inputs (as do the unit tests).
+   The paths are relative to the benchmark executable which is located at bin/
+   of the SOILWAT2 repository
+*/
+const char *const dir_test = "./tests/example";
+
+/* Naming scheme for benchmarks
+    - benchmarks are named "BM_" followed by the name of the benchmarked
+      function (or task) in CamelCase
+    - benchmarks that sweep over a parameter, e.g., the SWRC type, register
+      one argument per value and name it with `ArgName()`
+    - benchmarks report the number of function calls (or parsed values, days)
+      per iteration with `SetItemsProcessed()` so that results are comparable
+      across sweeps of different length
+*/
+
+
+/* Error handling
+   - Setup of a benchmark that fails stops the benchmark with
+     `state.SkipWithError()`; the timed loop must not fail.
+*/
+
+
+int main(int argc, char **argv) {
+    int res;
+
+    /*--- Imitate 'SW_Main.c/main()' */
+    // Parse benchmark flags; note: a relative path of `--benchmark_out`
+    // is relative to tests/example/ (see `make bench_run`)
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // Emulate 'sw_init_args()'
+    if (ChDir(dir_test) == 0u) {
+        sw_printf("Invalid project directory (%s)", dir_test);
+    }
+
+    res = setup_testGlobalSoilwatTemplate();
+
+    if (res != 0) {
+        // Setup failed
+        goto finishProgram; // Exit function prematurely due to error
+    }
+
+    //--- Run benchmarks
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+
+finishProgram:
+    teardown_testGlobalSoilwatTemplate();
+
+    return res;
+}
@@ -10,7 +10,12 @@
 #include "include/SW_Weather.h" // for SW_WTH_finalize_all_weather
 #include <stdio.h>              // for NULL, fprintf, stderr
 #include <stdlib.h>             // for exit
-#include <string.h>             // for strcpy
+#include <string.h>             // for strcpy, memcmp, memcpy
+
+#if defined(SWNETCDF)
+#include "include/SW_netCDF_Output.h"   // for SW_NCOUT_set_nrow_stream
+#include "include/SW_Output_outarray.h" // for SW_OUT_calc_iOUToffset
+#endif
 
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
@@ -47,53 +52,55 @@ void create_test_soillayers(
         exit(-1);
     }
 
-    double dmax[MAX_LAYERS] = {5,  6,  10, 11, 12, 20,  21, 22, 25,
-                               30, 40, 41, 42, 50, 51,  52, 53, 54,
-                               55, 60, 70, 80, 90, 110, 150};
-    double bulkd[MAX_LAYERS] = {1.430, 1.410, 1.390, 1.390, 1.380, 1.150, 1.130,
-                                1.130, 1.430, 1.410, 1.390, 1.390, 1.380, 1.150,
-                                1.130, 1.130, 1.430, 1.410, 1.390, 1.390, 1.380,
-                                1.150, 1.130, 1.130, 1.400};
-    double f_gravel[MAX_LAYERS] = {0.1, 0.1, 0.1, 0.1, 0.2, 0.2, 0.2, 0.2, 0.2,
-                                   0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2,
-                                   0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2};
-    double evco[MAX_LAYERS] = {0.813, 0.153, 0.034, 0, 0, 0, 0, 0, 0,
-                               0,     0,     0,     0, 0, 0, 0, 0, 0,
-                               0,     0,     0,     0, 0, 0, 0};
-    double trco_grass[MAX_LAYERS] = {0.0158, 0.0155, 0.0314, 0.0314, 0.0314,
-                                     0.0624, 0.0624, 0.0624, 0.0155, 0.0155,
-                                     0.0314, 0.0314, 0.0314, 0.0624, 0.0624,
-                                     0.0624, 0.0155, 0.0155, 0.0314, 0.0314,
-                                     0.0314, 0.0624, 0.0624, 0.0624, 0.0625};
-    double trco_shrub[MAX_LAYERS] = {0.0413, 0.0294, 0.055,  0.0547, 0.0344,
-                                     0.0341, 0.0316, 0.0316, 0.0419, 0.0294,
-                                     0.055,  0.0547, 0.0344, 0.0341, 0.0316,
-                                     0.0316, 0.0419, 0.0294, 0.0550, 0.0547,
-                                     0.0344, 0.0341, 0.0316, 0.0316, 0.0625};
-    double trco_tree[MAX_LAYERS] = {0.0158, 0.0155, 0.0314, 0.0314, 0.0314,
-                                    0.0624, 0.0624, 0.0624, 0.0155, 0.0155,
-                                    0.0314, 0.0314, 0.0314, 0.0624, 0.0624,
-                                    0.0624, 0.0155, 0.0155, 0.0314, 0.0314,
-                                    0.0314, 0.0624, 0.0624, 0.0624, 0.0625};
-    double trco_forb[MAX_LAYERS] = {0.0413, 0.0294, 0.055,  0.0547, 0.0344,
-                                    0.0341, 0.0316, 0.0316, 0.0419, 0.0294,
-                                    0.055,  0.0547, 0.0344, 0.0341, 0.0316,
-                                    0.0316, 0.0419, 0.0294, 0.0550, 0.0547,
-                                    0.0344, 0.0341, 0.0316, 0.0316, 0.0625};
-    double psand[MAX_LAYERS] = {0.51, 0.44, 0.35, 0.32, 0.31, 0.32, 0.57,
-                                0.57, 0.51, 0.44, 0.35, 0.32, 0.31, 0.32,
-                                0.57, 0.57, 0.51, 0.44, 0.35, 0.32, 0.31,
-                                0.32, 0.57, 0.57, 0.58};
-    double pclay[MAX_LAYERS] = {0.15, 0.26, 0.41, 0.45, 0.47, 0.47, 0.28,
-                                0.28, 0.15, 0.26, 0.41, 0.45, 0.47, 0.47,
-                                0.28, 0.28, 0.15, 0.26, 0.41, 0.45, 0.47,
-                                0.47, 0.28, 0.28, 0.29};
-    double imperm[MAX_LAYERS] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-    double soiltemp[MAX_LAYERS] = {-1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-                                   1,  1,  1,  2,  2, 2, 2, 2, 2, 2, 2, 2};
-    double om[MAX_LAYERS] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    // Values of 25 soil layers (largest possible MAX_LAYERS) of which
+    // the first `nlayers` are used
+    double dmax[] = {5,  6,  10, 11, 12, 20,  21, 22, 25,
+                     30, 40, 41, 42, 50, 51,  52, 53, 54,
+                     55, 60, 70, 80, 90, 110, 150};
+    double bulkd[] = {1.430, 1.410, 1.390, 1.390, 1.380, 1.150, 1.130,
+                      1.130, 1.430, 1.410, 1.390, 1.390, 1.380, 1.150,
+                      1.130, 1.130, 1.430, 1.410, 1.390, 1.390, 1.380,
+                      1.150, 1.130, 1.130, 1.400};
+    double f_gravel[] = {0.1, 0.1, 0.1, 0.1, 0.2, 0.2, 0.2, 0.2, 0.2,
+                         0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2,
+                         0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2};
+    double evco[] = {0.813, 0.153, 0.034, 0, 0, 0, 0, 0, 0,
+                     0,     0,     0,     0, 0, 0, 0, 0, 0,
+                     0,     0,     0,     0, 0, 0, 0};
+    double trco_grass[] = {0.0158, 0.0155, 0.0314, 0.0314, 0.0314,
+                           0.0624, 0.0624, 0.0624, 0.0155, 0.0155,
+                           0.0314, 0.0314, 0.0314, 0.0624, 0.0624,
+                           0.0624, 0.0155, 0.0155, 0.0314, 0.0314,
+                           0.0314, 0.0624, 0.0624, 0.0624, 0.0625};
+    double trco_shrub[] = {0.0413, 0.0294, 0.055,  0.0547, 0.0344,
+                           0.0341, 0.0316, 0.0316, 0.0419, 0.0294,
+                           0.055,  0.0547, 0.0344, 0.0341, 0.0316,
+                           0.0316, 0.0419, 0.0294, 0.0550, 0.0547,
+                           0.0344, 0.0341, 0.0316, 0.0316, 0.0625};
+    double trco_tree[] = {0.0158, 0.0155, 0.0314, 0.0314, 0.0314,
+                          0.0624, 0.0624, 0.0624, 0.0155, 0.0155,
+                          0.0314, 0.0314, 0.0314, 0.0624, 0.0624,
+                          0.0624, 0.0155, 0.0155, 0.0314, 0.0314,
+                          0.0314, 0.0624, 0.0624, 0.0624, 0.0625};
+    double trco_forb[] = {0.0413, 0.0294, 0.055,  0.0547, 0.0344,
+                          0.0341, 0.0316, 0.0316, 0.0419, 0.0294,
+                          0.055,  0.0547, 0.0344, 0.0341, 0.0316,
+                          0.0316, 0.0419, 0.0294, 0.0550, 0.0547,
+                          0.0344, 0.0341, 0.0316, 0.0316, 0.0625};
+    double psand[] = {0.51, 0.44, 0.35, 0.32, 0.31, 0.32, 0.57,
+                      0.57, 0.51, 0.44, 0.35, 0.32, 0.31, 0.32,
+                      0.57, 0.57, 0.51, 0.44, 0.35, 0.32, 0.31,
+                      0.32, 0.57, 0.57, 0.58};
+    double pclay[] = {0.15, 0.26, 0.41, 0.45, 0.47, 0.47, 0.28,
+                      0.28, 0.15, 0.26, 0.41, 0.45, 0.47, 0.47,
+                      0.28, 0.28, 0.15, 0.26, 0.41, 0.45, 0.47,
+                      0.47, 0.28, 0.28, 0.29};
+    double imperm[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                       0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    double soiltemp[] = {-1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+                         1,  1,  1,  2,  2, 2, 2, 2, 2, 2, 2, 2};
+    double om[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
     int const nRegions = 3;
     double regionLowerBounds[3] = {20., 50., 100.};
@@ -298,3 +305,152 @@ void teardown_testGlobalSoilwatTemplate() {
     SW_DOM_deconstruct(&template_SW_Domain);
     SW_CTL_clear_model(swTRUE, &template_SW_Run);
 }
+
+#if defined(SWNETCDF)
+/* Deep copy the global test domain and set it up to stream output,
+   i.e., output arrays hold at most `streamOutYears` years of output
+
+   Output arrays of a simulation run need to be allocated with the
+   output domain of the copy, e.g., via SW_RUN_deepCopy().
+*/
+void setup_streamed_domain(
+    SW_DOMAIN *SW_Domain, int streamOutYears, LOG_INFO *LogInfo
+) {
+    SW_DOM_deepCopy(&template_SW_Domain, SW_Domain, LogInfo);
+    if (LogInfo->stopRun) {
+        return; // Exit function prematurely due to error
+    }
+
+    SW_Domain->OutDom.netCDFOutput.streamOutYears = streamOutYears;
+    SW_NCOUT_set_nrow_stream(streamOutYears, SW_Domain->OutDom.nrow_OUT);
+
+    SW_OUT_calc_iOUToffset(
+        SW_Domain->OutDom.nrow_OUT,
+        SW_Domain->OutDom.nvar_OUT,
+        SW_Domain->OutDom.nsl_OUT,
+        SW_Domain->OutDom.npft_OUT,
+        SW_Domain->OutDom.netCDFOutput.iOUToffset
+    );
+}
+
+/* Copy (or compare) rows `[irowStart, irowEnd)` of streamed output arrays
+   to (or against) rows `irowOffset + row` of output arrays that hold all
+   time steps
+
+   @return Number of time steps x variables that differ (if compared)
+*/
+static unsigned long transfer_streamed_output(
+    SW_OUT_DOM *fullOutDom,
+    double *p_full[][SW_OUTNPERIODS],
+    SW_OUT_DOM *streamOutDom,
+    double *p_stream[][SW_OUTNPERIODS],
+    const size_t irowStart[],
+    const size_t irowEnd[],
+    const size_t irowOffset[],
+    Bool doCopy
+) {
+    int key;
+    int i;
+    int ivar;
+    OutPeriod pd;
+    size_t row;
+    size_t n;
+    size_t iFull;
+    size_t iStream;
+    unsigned long nDiffs = 0;
+
+    ForEachOutKey(key) {
+        for (i = 0; i < streamOutDom->used_OUTNPERIODS; i++) {
+            pd = streamOutDom->timeSteps[key][i];
+
+            if (!streamOutDom->use[key] || pd == eSW_NoTime ||
+                isnull(p_full[key][pd]) || isnull(p_stream[key][pd])) {
+                continue;
+            }
+
+            for (ivar = 0; ivar < streamOutDom->nvar_OUT[key]; ivar++) {
+                // Values per time step (soil layers x vegetation types)
+                n = (size_t) ((streamOutDom->nsl_OUT[key][ivar] > 0) ?
+                                  streamOutDom->nsl_OUT[key][ivar] :
+                                  1) *
+                    (size_t) ((streamOutDom->npft_OUT[key][ivar] > 0) ?
+                                  streamOutDom->npft_OUT[key][ivar] :
+                                  1);
+
+                for (row = irowStart[pd]; row < irowEnd[pd]; row++) {
+                    iStream =
+                        streamOutDom->netCDFOutput.iOUToffset[key][pd][ivar] +
+                        row * n;
+                    iFull = fullOutDom->netCDFOutput.iOUToffset[key][pd][ivar] +
+                            (irowOffset[pd] + row) * n;
+
+                    if (doCopy) {
+                        memcpy(
+                            &p_full[key][pd][iFull],
+                            &p_stream[key][pd][iStream],
+                            n * sizeof(double)
+                        );
+                    } else if (memcmp(
+                                   &p_full[key][pd][iFull],
+                                   &p_stream[key][pd][iStream],
+                                   n * sizeof(double)
+                               ) != 0) {
+                        nDiffs++;
+                    }
+                }
+            }
+        }
+    }
+
+    return nDiffs;
+}
+
+/* Copy rows `[irowStart, irowEnd)` of streamed output arrays
+   to rows `irowOffset + row` of output arrays that hold all time steps
+   (e.g., to collect the time steps that were streamed) */
+void copy_streamed_output(
+    SW_OUT_DOM *fullOutDom,
+    double *p_full[][SW_OUTNPERIODS],
+    SW_OUT_DOM *streamOutDom,
+    double *p_stream[][SW_OUTNPERIODS],
+    const size_t irowStart[],
+    const size_t irowEnd[],
+    const size_t irowOffset[]
+) {
+    (void) transfer_streamed_output(
+        fullOutDom,
+        p_full,
+        streamOutDom,
+        p_stream,
+        irowStart,
+        irowEnd,
+        irowOffset,
+        swTRUE
+    );
+}
+
+/* Count time steps x variables of rows `[0, irowEnd)` of streamed output
+   arrays that are not bit-identical to rows `irowOffset + row` of output
+   arrays that hold all time steps */
+unsigned long count_streamed_output_diffs(
+    SW_OUT_DOM *fullOutDom,
+    double *p_full[][SW_OUTNPERIODS],
+    SW_OUT_DOM *streamOutDom,
+    double *p_stream[][SW_OUTNPERIODS],
+    const size_t irowEnd[],
+    const size_t irowOffset[]
+) {
+    const size_t irowStart[SW_OUTNPERIODS] = {0};
+
+    return transfer_streamed_output(
+        fullOutDom,
+        p_full,
+        streamOutDom,
+        p_stream,
+        irowStart,
+        irowEnd,
+        irowOffset,
+        swFALSE
+    );
+}
+#endif
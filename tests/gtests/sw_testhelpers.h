@@ -43,6 +43,31 @@ void setup_SW_Site_for_tests(SW_SITE *SW_Site);
 int setup_testGlobalSoilwatTemplate();
 void teardown_testGlobalSoilwatTemplate();
 
+#if defined(SWNETCDF)
+void setup_streamed_domain(
+    SW_DOMAIN *SW_Domain, int streamOutYears, LOG_INFO *LogInfo
+);
+
+void copy_streamed_output(
+    SW_OUT_DOM *fullOutDom,
+    double *p_full[][SW_OUTNPERIODS],
+    SW_OUT_DOM *streamOutDom,
+    double *p_stream[][SW_OUTNPERIODS],
+    const size_t irowStart[],
+    const size_t irowEnd[],
+    const size_t irowOffset[]
+);
+
+unsigned long count_streamed_output_diffs(
+    SW_OUT_DOM *fullOutDom,
+    double *p_full[][SW_OUTNPERIODS],
+    SW_OUT_DOM *streamOutDom,
+    double *p_stream[][SW_OUTNPERIODS],
+    const size_t irowEnd[],
+    const size_t irowOffset[]
+);
+#endif
+
 /* AllTestFixture is our base test fixture class inheriting from
  * `::testing::Test` */
 /* Note: don't use text fixtures with death tests in thread-safe mode,
@@ -97,3 +122,7 @@ using WeatherFixtureTest = AllTestFixture;
 using WaterBalanceFixtureTest = AllTestFixture;
 
 using SpinUpFixtureTest = AllTestFixture;
+
+using OutputFixtureTest = AllTestFixture;
+
+using ControlFixtureTest = AllTestFixture;
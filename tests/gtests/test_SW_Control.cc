@@ -0,0 +1,22 @@
+#include "include/SW_Control.h"          // for SW_CTL_sizeof_heap
+#include "include/SW_datastructs.h"      // for SW_RUN, SW_OUT_DOM
+#include "include/SW_Defines.h"          // for MAX_LAYERS, MAX_NYEAR
+#include "tests/gtests/sw_testhelpers.h" // for ControlFixtureTest
+#include "gtest/gtest.h"                 // for Message, EXPECT_EQ, TEST_F
+#include <stddef.h>                      // for size_t
+
+namespace {
+// Heap memory of a simulation run adds up across components
+TEST_F(ControlFixtureTest, ControlMemoryFootprintOfHeap) {
+    size_t heap[5];
+    size_t total = SW_CTL_sizeof_heap(&SW_Run, &SW_Domain.OutDom, heap);
+
+    EXPECT_EQ(total, heap[0] + heap[1] + heap[2] + heap[3] + heap[4]);
+    EXPECT_EQ(heap[0], SW_Run.Weather.n_years * sizeof(SW_WEATHER_HIST));
+    EXPECT_GT(heap[1], 0u);
+
+    // Fixed-size arrays fit the example simulation
+    EXPECT_LE(SW_Run.Site.n_layers, (unsigned int) MAX_LAYERS);
+    EXPECT_LT(SW_Run.Model.endyr, (unsigned int) MAX_NYEAR);
+}
+} // namespace
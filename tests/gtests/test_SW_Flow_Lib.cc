@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"                 // for Message, TestPartResult, Test
 #include <iomanip>                       // for setprecision, __iom_t5
 #include <ios>                           // for fixed
+#include <math.h>                        // for fmin
 #include <stdio.h>                       // for NULL
 
 namespace {
@@ -1599,4 +1600,92 @@ TEST(SWFlowTest, SWFlowHydraulicRedistribution) {
         }
     }
 }
+
+// Test that hydraulic_redistribution conserves mass, respects frozen layers,
+// and does not extract moisture below the limit
+TEST(SWFlowTest, SWFlowHydraulicRedistributionConstraints) {
+    LOG_INFO LogInfo;
+    // Initialize logs and silence warn/error reporting
+    sw_init_logs(NULL, &LogInfo);
+
+    SW_SITE SW_Site;
+    setup_SW_Site_for_tests(&SW_Site);
+
+    SW_VEGPROD SW_VegProd;
+    unsigned int k;
+    ForEachVegType(k) { SW_VegProd.veg[k].SWPcrit = 20; }
+
+    // INPUTS
+    unsigned int const nlyrs = MAX_LAYERS;
+    unsigned int i;
+    double swc[MAX_LAYERS];
+    double swcInit[MAX_LAYERS];
+    double hydred[MAX_LAYERS] = {0.};
+    double lyrFrozen[MAX_LAYERS] = {0};
+    double swcLimit;
+    double sumHydred = 0.;
+
+    create_test_soillayers(nlyrs, &SW_VegProd, &SW_Site, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    ForEachSoilLayer(i, nlyrs) {
+        if (i >= 10 && i < 13) {
+            // dry layers: less moisture than at wilting point
+            swc[i] = 0.5 * SW_Site.swcBulk_wiltpt[i];
+        } else if (i % 2 == 0) {
+            swc[i] = SW_Site.swcBulk_fieldcap[i];
+        } else {
+            swc[i] =
+                (SW_Site.swcBulk_fieldcap[i] + SW_Site.swcBulk_wiltpt[i]) / 2.;
+        }
+        swcInit[i] = swc[i];
+
+        lyrFrozen[i] = (i == 3 || i == 7) ? swTRUE : swFALSE;
+    }
+
+    // Call function to be tested
+    hydraulic_redistribution(
+        swc,
+        hydred,
+        &SW_Site,
+        SW_SHRUB,
+        nlyrs,
+        lyrFrozen,
+        -0.2328,
+        1.2e12,
+        1,
+        0.3,
+        1980,
+        1,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Expection: no hydred in top layer
+    EXPECT_DOUBLE_EQ(hydred[0], 0.);
+
+    ForEachSoilLayer(i, nlyrs) {
+        // Expection: no hydred from or to frozen soil layers
+        if (i == 3 || i == 7) {
+            EXPECT_DOUBLE_EQ(hydred[i], 0.) << "frozen layer " << 1 + i;
+        }
+
+        // Expection: soil moisture is updated by hydred
+        EXPECT_DOUBLE_EQ(swc[i], swcInit[i] + hydred[i]) << "layer " << 1 + i;
+
+        // Expection: net hydred does not extract moisture below limit
+        swcLimit = fmin(
+            swcInit[i],
+            fmin(
+                SW_Site.swcBulk_wiltpt[i], SW_Site.swcBulk_atSWPcrit[SW_SHRUB][i]
+            )
+        );
+        EXPECT_GE(swc[i], swcLimit - tol9) << "layer " << 1 + i;
+
+        sumHydred += hydred[i];
+    }
+
+    // Expection: hydred moves water among layers (mass balance)
+    EXPECT_NEAR(sumHydred, 0., tol9);
+}
 } // namespace
@@ -785,6 +785,90 @@ TEST(AtmDemandTest, SolarRadiationExtraterrestrial) {
         << "Duffie & Beckman 2013: Example 2.12.1\n";
 }
 
+// Test domain-wide cache of solar geometry
+TEST(AtmDemandTest, SolarPosCache) {
+    SW_ATMD SW_AtmDemand;
+    SW_ATMD_CACHE AtmDemCache;
+    SW_ATMD *AtmDemFlat;
+    SW_ATMD *AtmDemTilted;
+
+    unsigned int doy;
+    unsigned int k;
+    double const lat = 40. * deg_to_rad;
+    double const slope = 30. * deg_to_rad;
+    double const aspect = -45. * deg_to_rad;
+    double sun_angles[7];
+    double int_cos_theta[2];
+    double int_sin_beta[2];
+    double H_o[2];
+
+    LOG_INFO LogInfo;
+    // Initialize logs and silence warn/error reporting
+    sw_init_logs(NULL, &LogInfo);
+
+    SW_PET_init_cache(&AtmDemCache);
+
+    AtmDemFlat = SW_PET_cache_get(&AtmDemCache, lat, 0., SW_MISSING, &LogInfo);
+    sw_fail_on_error(&LogInfo);
+    ASSERT_NE(AtmDemFlat, nullptr);
+    EXPECT_EQ(AtmDemCache.nEntries, 1u);
+
+    // Horizontal surfaces share one entry regardless of aspect
+    EXPECT_EQ(
+        SW_PET_cache_get(&AtmDemCache, lat, 0., aspect, &LogInfo), AtmDemFlat
+    );
+    EXPECT_EQ(AtmDemCache.nEntries, 1u);
+
+    AtmDemTilted = SW_PET_cache_get(&AtmDemCache, lat, slope, aspect, &LogInfo);
+    sw_fail_on_error(&LogInfo);
+    ASSERT_NE(AtmDemTilted, nullptr);
+    EXPECT_NE(AtmDemTilted, AtmDemFlat);
+    EXPECT_EQ(AtmDemCache.nEntries, 2u);
+
+    // Cached values are identical to locally memoized values
+    SW_PET_init_run(&SW_AtmDemand);
+
+    for (doy = 1; doy <= MAX_DAYS; doy++) {
+        sun_hourangles(
+            &SW_AtmDemand,
+            doy,
+            lat,
+            slope,
+            aspect,
+            sun_angles,
+            int_cos_theta,
+            int_sin_beta
+        );
+
+        solar_radiation_extraterrestrial(
+            SW_AtmDemand.memoized_G_o, doy, int_cos_theta, H_o
+        );
+
+        for (k = 0; k < 2; k++) {
+            EXPECT_DOUBLE_EQ(
+                AtmDemTilted->memoized_G_o[doy - 1][k], H_o[k]
+            );
+            EXPECT_DOUBLE_EQ(
+                AtmDemTilted->memoized_int_cos_theta[doy - 1][k],
+                int_cos_theta[k]
+            );
+            EXPECT_DOUBLE_EQ(
+                AtmDemTilted->memoized_int_sin_beta[doy - 1][k],
+                int_sin_beta[k]
+            );
+        }
+
+        for (k = 0; k < 7; k++) {
+            EXPECT_DOUBLE_EQ(
+                AtmDemTilted->msun_angles[doy - 1][k], sun_angles[k]
+            );
+        }
+    }
+
+    SW_PET_deconstruct_cache(&AtmDemCache);
+    EXPECT_EQ(AtmDemCache.nEntries, 0u);
+}
+
 // Test solar radiation: global horizontal and tilted
 //   Comparison against examples by Duffie & Beckman 2013 are expected to
 //   deviate in value, but show similar patterns, because
@@ -1,12 +1,13 @@
 #include "include/generic.h"        // for GT, fmin
 #include "include/myMemory.h"       // for Str_Dup
 #include "include/SW_datastructs.h" // for LOG_INFO, SW_MARKOV, SW_NFILES
-#include "include/SW_Defines.h"     // for sw_random_t
+#include "include/SW_Defines.h"     // for sw_random_t, MAX_WEEKS
 #include "include/SW_Files.h"       // for SW_F_deconstruct, eMarkovCov
 #include "include/SW_Main_lib.h"    // for sw_fail_on_error, sw_init_logs
 #include "include/SW_Markov.h"      // for SW_MKV_deconstruct, SW_MKV_init_...
 #include "gmock/gmock.h"            // for HasSubstr, MakePredicateFormatte...
 #include "gtest/gtest.h"            // for Test, Message, TestPartResult, Po...
+#include <math.h>                   // for sqrt
 #include <stdio.h>                  // for NULL
 
 using ::testing::HasSubstr;
@@ -294,6 +295,85 @@ TEST(WeatherGeneratorTest, WeatherGeneratormvnormDeathTest) {
     SW_MKV_deconstruct(&SW_Markov);
 }
 
+// Test precomputed weekly Cholesky factors 'SW_MKV_setup_chol'
+TEST(WeatherGeneratorTest, WeatherGeneratorCholeskyFactors) {
+    SW_MARKOV SW_Markov;
+    SW_MARKOV copy_Markov;
+
+    LOG_INFO LogInfo;
+    // Initialize logs and silence warn/error reporting
+    sw_init_logs(NULL, &LogInfo);
+
+    unsigned int week;
+
+    SW_MKV_init_ptrs(&SW_Markov);
+
+    for (week = 0; week < MAX_WEEKS; week++) {
+        SW_Markov.v_cov[week][0][0] = 4.;
+        SW_Markov.v_cov[week][1][1] = 2.;
+        SW_Markov.v_cov[week][0][1] = SW_Markov.v_cov[week][1][0] = 1.;
+    }
+
+    EXPECT_FALSE(SW_Markov.v_chol_ok);
+
+    SW_MKV_setup_chol(&SW_Markov, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_TRUE(SW_Markov.v_chol_ok);
+
+    for (week = 0; week < MAX_WEEKS; week++) {
+        EXPECT_DOUBLE_EQ(SW_Markov.v_chol[week][0], 2.);
+        EXPECT_DOUBLE_EQ(SW_Markov.v_chol[week][1], 0.5);
+        EXPECT_DOUBLE_EQ(SW_Markov.v_chol[week][2], sqrt(1.75));
+    }
+
+    // Copies (e.g., of simulation runs) hold the Cholesky factors
+    SW_MKV_init_ptrs(&copy_Markov);
+    allocateMKV(&SW_Markov, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    allocateMKV(&copy_Markov, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    copyMKV(&copy_Markov, &SW_Markov);
+    EXPECT_TRUE(copy_Markov.v_chol_ok);
+    for (week = 0; week < MAX_WEEKS; week++) {
+        EXPECT_DOUBLE_EQ(copy_Markov.v_chol[week][2], sqrt(1.75));
+    }
+    SW_MKV_deconstruct(&copy_Markov);
+
+    // Case: (wT_covar ^ 2 / wTmax_var) > wTmin_var in one week --> LOGERROR
+    SW_Markov.v_cov[10][0][1] = SW_Markov.v_cov[10][1][0] = 4.;
+
+    SW_MKV_setup_chol(&SW_Markov, &LogInfo);
+    // expect error: don't exit test program via `sw_fail_on_error(&LogInfo)`
+
+    // Detect failure by error message
+    EXPECT_THAT(LogInfo.errorMsg, HasSubstr("Bad covariance matrix"));
+    EXPECT_FALSE(SW_Markov.v_chol_ok);
+
+    SW_MKV_deconstruct(&SW_Markov);
+}
+
+// Test that the weather generator requires Cholesky factors
+TEST(WeatherGeneratorTest, WeatherGeneratorRequiresCholeskyFactors) {
+    SW_MARKOV SW_Markov;
+    double tmax = 0.;
+    double tmin = 0.;
+    double ppt = 0.;
+
+    LOG_INFO LogInfo;
+    // Initialize logs and silence warn/error reporting
+    sw_init_logs(NULL, &LogInfo);
+
+    // Covariance matrices are not (successfully) set up
+    SW_MKV_init_ptrs(&SW_Markov);
+
+    SW_MKV_today(&SW_Markov, 0, 1980, &tmax, &tmin, &ppt, &LogInfo);
+    // expect error: don't exit test program via `sw_fail_on_error(&LogInfo)`
+
+    // Detect failure by error message
+    EXPECT_THAT(LogInfo.errorMsg, HasSubstr("Cholesky factors"));
+}
+
 // Test correcting daily temperatures for wet/dry days
 TEST(WeatherGeneratorTest, WeatherGeneratorWetDryTemperatureCorrection) {
     SW_MARKOV SW_Markov;
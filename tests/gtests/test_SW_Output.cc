@@ -0,0 +1,331 @@
+#include "include/generic.h"             // for swTRUE, swFALSE
+#include "include/SW_Control.h"          // for SW_CTL_main
+#include "include/SW_datastructs.h"      // for SW_RUN, SW_OUT_DOM
+#include "include/SW_Defines.h"          // for eSW_Year, ForEachOutKey
+#include "include/SW_Main_lib.h"         // for sw_fail_on_error
+#include "include/SW_Output.h"           // for find_OutPeriods_inUse
+#include "tests/gtests/sw_testhelpers.h" // for OutputFixtureTest
+#include "gtest/gtest.h"                 // for Message, EXPECT_NEAR, TEST_F
+#include <cmath>                         // for fabs, fmax
+#include <stdio.h>                       // for snprintf
+#include <stdlib.h>                      // for free
+
+#if defined(SWNETCDF)
+#include "include/SW_Domain.h"          // for SW_DOM_deconstruct
+#include "include/SW_netCDF_Output.h"   // for SW_NCOUT_set_nrow_stream
+#include "include/SW_Output_outarray.h" // for SW_OUT_construct_outarray
+#include <string.h>                     // for memcpy, memset
+#endif
+
+
+namespace {
+// Compare two output accumulator structs (all fields are of type double)
+void expectEqualAccumulators(
+    const void *x, const void *y, size_t sizeAccu, const char *name
+) {
+    const double *dx = (const double *) x;
+    const double *dy = (const double *) y;
+    size_t i;
+
+    for (i = 0; i < sizeAccu / sizeof(double); i++) {
+        EXPECT_NEAR(dx[i], dy[i], 1e-12 * fmax(1., fabs(dx[i])))
+            << name << ": field " << i;
+    }
+}
+
+// Yearly sums that are rolled up from completed months equal
+// yearly sums that are summed up from daily values
+TEST_F(OutputFixtureTest, OutputYearFromMonths) {
+    SW_RUN SW_Run2;
+    int k;
+    int p;
+
+    SW_RUN_deepCopy(
+        &template_SW_Run, &SW_Run2, &template_SW_Domain.OutDom, swTRUE, &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Aggregate output values without writing output files
+    SW_Domain.OutDom.print_SW_Output = swFALSE;
+    SW_Run.Model.doOutput = swTRUE;
+    SW_Run2.Model.doOutput = swTRUE;
+
+    // Run with all output periods (yearly sums from monthly sums)
+    ASSERT_EQ(SW_Domain.OutDom.used_OUTNPERIODS, SW_OUTNPERIODS);
+    SW_CTL_main(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Run with yearly output only (yearly sums from daily values)
+    ForEachOutKey(k) {
+        SW_Domain.OutDom.timeSteps[k][0] = eSW_Year;
+        for (p = 1; p < SW_OUTNPERIODS; p++) {
+            SW_Domain.OutDom.timeSteps[k][p] = eSW_NoTime;
+        }
+    }
+    SW_Domain.OutDom.used_OUTNPERIODS = 1;
+    find_OutPeriods_inUse(&SW_Domain.OutDom);
+
+    SW_CTL_main(&SW_Run2, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Compare yearly output values of the last simulated year
+    expectEqualAccumulators(
+        SW_Run.SoilWat.p_oagg[eSW_Year],
+        SW_Run2.SoilWat.p_oagg[eSW_Year],
+        sizeof(SW_SOILWAT_OUTPUTS),
+        "SoilWat"
+    );
+    expectEqualAccumulators(
+        SW_Run.Weather.p_oagg[eSW_Year],
+        SW_Run2.Weather.p_oagg[eSW_Year],
+        sizeof(SW_WEATHER_OUTPUTS),
+        "Weather"
+    );
+    expectEqualAccumulators(
+        SW_Run.VegProd.p_oagg[eSW_Year],
+        SW_Run2.VegProd.p_oagg[eSW_Year],
+        sizeof(SW_VEGPROD_OUTPUTS),
+        "VegProd"
+    );
+
+    SW_CTL_clear_model(swTRUE, &SW_Run2);
+}
+
+// Column names of output keys with many columns, e.g., transpiration by
+// vegetation type of 12 soil layers, are complete and do not spill over
+// into the column names of the next output key
+TEST_F(OutputFixtureTest, OutputColumnNamesOfManySoilLayers) {
+    SW_OUT_DOM *OutDom = new SW_OUT_DOM;
+    const unsigned int nLayers = 12;
+    const char *vegNames[NVEGTYPES + 1] = {
+        "total", "tree", "shrub", "forbs", "grass"
+    };
+    char expected[50];
+    unsigned int i;
+    unsigned int j;
+    int k;
+    int col;
+
+    SW_OUTDOM_init_ptrs(OutDom);
+
+    SW_OUT_set_ncol(
+        nLayers,
+        nLayers,
+        SW_Run.VegEstab.count,
+        OutDom->ncol_OUT,
+        OutDom->nvar_OUT,
+        OutDom->nsl_OUT,
+        OutDom->npft_OUT
+    );
+
+    ASSERT_LE(OutDom->ncol_OUT[eSW_Transp], SW_OUTNMAXCOLS);
+
+    SW_OUT_set_colnames(
+        nLayers,
+        SW_Run.VegEstab.parms,
+        OutDom->ncol_OUT,
+        OutDom->colnames_OUT,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    for (i = 0; i < nLayers; i++) {
+        for (j = 0; j < NVEGTYPES + 1; j++) {
+            (void) snprintf(
+                expected,
+                sizeof expected,
+                "transp_%s_Lyr_%u",
+                vegNames[j],
+                i + 1
+            );
+            EXPECT_STREQ(
+                OutDom->colnames_OUT[eSW_Transp][i + j * nLayers], expected
+            );
+        }
+    }
+
+    for (i = 0; i < nLayers; i++) {
+        (void) snprintf(expected, sizeof expected, "Lyr_%u", i + 1);
+        EXPECT_STREQ(OutDom->colnames_OUT[eSW_EvapSoil][i], expected);
+    }
+
+    ForEachOutKey(k) {
+        for (col = 0; col < SW_OUTNMAXCOLS; col++) {
+            free(OutDom->colnames_OUT[k][col]);
+        }
+    }
+    delete OutDom;
+}
+
+#if defined(SWNETCDF)
+// Test that output arrays of streaming output hold `streamOutYears` years
+TEST(OutputTest, OutputStreamNumberOfRows) {
+    const size_t nrow0[SW_OUTNPERIODS] = {11323, 1643, 372, 31};
+    size_t nrow[SW_OUTNPERIODS];
+    const size_t nrow1[SW_OUTNPERIODS] = {366, 53, 12, 1};
+    const size_t nrow7[SW_OUTNPERIODS] = {2562, 371, 84, 7};
+    OutPeriod pd;
+
+    // Output is not streamed
+    memcpy(nrow, nrow0, sizeof nrow);
+    SW_NCOUT_set_nrow_stream(-1, nrow);
+    ForEachOutPeriod(pd) { EXPECT_EQ(nrow[pd], nrow0[pd]); }
+
+    // Stream every year
+    SW_NCOUT_set_nrow_stream(1, nrow);
+    ForEachOutPeriod(pd) { EXPECT_EQ(nrow[pd], nrow1[pd]); }
+
+    // Stream every 7 years
+    memcpy(nrow, nrow0, sizeof nrow);
+    SW_NCOUT_set_nrow_stream(7, nrow);
+    ForEachOutPeriod(pd) { EXPECT_EQ(nrow[pd], nrow7[pd]); }
+
+    // Streaming more years than simulated holds all years
+    memcpy(nrow, nrow0, sizeof nrow);
+    SW_NCOUT_set_nrow_stream(50, nrow);
+    ForEachOutPeriod(pd) { EXPECT_EQ(nrow[pd], nrow0[pd]); }
+}
+
+// Simulate all years with streaming output and collect each time step
+// (including those that were streamed) in output arrays that hold all years
+void runAndCollectStreamedOutput(
+    SW_RUN *sw,
+    SW_OUT_DOM *streamOutDom,
+    SW_OUT_DOM *fullOutDom,
+    double *p_full[][SW_OUTNPERIODS],
+    LOG_INFO *LogInfo
+) {
+    TimeInt *cur_yr = &sw->Model.year;
+    size_t irowStart[SW_OUTNPERIODS];
+    size_t irowEnd[SW_OUTNPERIODS];
+    size_t irowOffset[SW_OUTNPERIODS];
+    size_t nStreamed;
+    OutPeriod pd;
+
+    for (*cur_yr = sw->Model.startyr; *cur_yr <= sw->Model.endyr; (*cur_yr)++) {
+        ForEachOutPeriod(pd) {
+            irowStart[pd] = sw->OutRun.irow_OUT[pd];
+            irowOffset[pd] = sw->OutRun.irowOffset_OUT[pd];
+        }
+
+        SW_CTL_run_current_year(sw, streamOutDom, LogInfo);
+        if (LogInfo->stopRun) {
+            return; // Exit function prematurely due to error
+        }
+
+        // Output arrays were streamed at most once during a year; time steps
+        // after the streaming are held in rows before `irowStart`, i.e.,
+        // streamed rows from `irowStart` onwards were not overwritten
+        ForEachOutPeriod(pd) {
+            nStreamed = sw->OutRun.irowOffset_OUT[pd] - irowOffset[pd];
+            EXPECT_LE(nStreamed, streamOutDom->nrow_OUT[pd]);
+            if (nStreamed > 0) {
+                EXPECT_LE(sw->OutRun.irow_OUT[pd], irowStart[pd]);
+            }
+
+            irowEnd[pd] = (nStreamed > 0) ? nStreamed : sw->OutRun.irow_OUT[pd];
+        }
+
+        copy_streamed_output(
+            fullOutDom,
+            p_full,
+            streamOutDom,
+            sw->OutRun.p_OUT,
+            irowStart,
+            irowEnd,
+            irowOffset
+        );
+
+        // Time steps after the streaming
+        ForEachOutPeriod(pd) {
+            irowStart[pd] = 0;
+            irowEnd[pd] = (sw->OutRun.irowOffset_OUT[pd] > irowOffset[pd]) ?
+                              sw->OutRun.irow_OUT[pd] :
+                              0;
+        }
+
+        copy_streamed_output(
+            fullOutDom,
+            p_full,
+            streamOutDom,
+            sw->OutRun.p_OUT,
+            irowStart,
+            irowEnd,
+            sw->OutRun.irowOffset_OUT
+        );
+    }
+}
+
+// Test that streamed output is identical to output that holds all years
+TEST_F(OutputFixtureTest, OutputStreamedEqualsNonStreamed) {
+    // Stream every year and every 7 years (not a divisor of simulated years)
+    const int streamOutYears[] = {1, 7};
+    const size_t irowOffset0[SW_OUTNPERIODS] = {0};
+    SW_DOMAIN streamDom;
+    SW_RUN stream_sw;
+    SW_OUT_RUN collected;
+    OutPeriod pd;
+    unsigned int i;
+
+    ASSERT_NE((SW_Run.Model.endyr - SW_Run.Model.startyr + 1) % 7, 0u);
+
+    // Output that holds all years
+    SW_Run.Model.doOutput = swTRUE;
+    SW_CTL_main(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    for (i = 0; i < sw_length(streamOutYears); i++) {
+        setup_streamed_domain(&streamDom, streamOutYears[i], &LogInfo);
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+        SW_RUN_deepCopy(
+            &template_SW_Run, &stream_sw, &streamDom.OutDom, swTRUE, &LogInfo
+        );
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+        stream_sw.Model.doOutput = swTRUE;
+        stream_sw.OutRun.domType = streamDom.DomainType;
+
+        memset(&collected, 0, sizeof collected);
+        SW_OUT_construct_outarray(&SW_Domain.OutDom, &collected, &LogInfo);
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+        runAndCollectStreamedOutput(
+            &stream_sw,
+            &streamDom.OutDom,
+            &SW_Domain.OutDom,
+            collected.p_OUT,
+            &LogInfo
+        );
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+        ForEachOutPeriod(pd) {
+            EXPECT_EQ(
+                stream_sw.OutRun.irowOffset_OUT[pd] +
+                    stream_sw.OutRun.irow_OUT[pd],
+                SW_Run.OutRun.irow_OUT[pd]
+            ) << "streamOutYears = "
+              << streamOutYears[i];
+        }
+
+        EXPECT_GT(stream_sw.OutRun.irowOffset_OUT[eSW_Year], 0u);
+
+        EXPECT_EQ(
+            count_streamed_output_diffs(
+                &SW_Domain.OutDom,
+                SW_Run.OutRun.p_OUT,
+                &SW_Domain.OutDom,
+                collected.p_OUT,
+                SW_Run.OutRun.irow_OUT,
+                irowOffset0
+            ),
+            0u
+        ) << "streamOutYears = "
+          << streamOutYears[i];
+
+        SW_OUT_deconstruct_outarray(&collected);
+        SW_CTL_clear_model(swTRUE, &stream_sw);
+        SW_DOM_deconstruct(&streamDom);
+    }
+}
+#endif
+} // namespace
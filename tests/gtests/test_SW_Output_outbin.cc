@@ -0,0 +1,327 @@
+#include "include/filefuncs.h"        // for OpenFile, CloseFile
+#include "include/generic.h"          // for swTRUE, swFALSE, Bool
+#include "include/SW_datastructs.h"   // for SW_OUTBIN_FILE, SW_OUTBIN_DATA
+#include "include/SW_Defines.h"       // for eSW_Day, eSW_Year
+#include "include/SW_Main_lib.h"      // for sw_init_logs, sw_fail_on_error
+#include "include/SW_Output.h"        // for key2str, ForEachOutKey
+#include "include/SW_Output_outbin.h" // for SW_OUTBIN_open, SW_OUTBIN_read
+#include "gmock/gmock.h"              // for HasSubstr, MakePredicateFormat...
+#include "gtest/gtest.h"              // for Test, Message, TestPartResult
+#include <cmath>                      // for NAN, INFINITY
+#include <fstream>                    // for ifstream
+#include <sstream>                    // for istringstream
+#include <stdio.h>                    // for snprintf, remove, fread, NULL
+#include <string.h>                   // for memcmp, strcmp
+#include <string>                     // for string, getline
+
+
+// Binary output is available only for text-based SOILWAT2 (see SW_OUTBIN)
+#if defined(SW_OUTBIN)
+
+using ::testing::HasSubstr;
+
+namespace {
+const char *const fnameBin = "Output/test_SW_Output_outbin.sw2b";
+
+// Write a binary output file with daily time columns and `nval` value
+// columns; return the values (column-major, time columns first)
+void writeBinaryTestFile(
+    unsigned int nval,
+    unsigned int nrow,
+    Bool compress,
+    double *values,
+    LOG_INFO *LogInfo
+) {
+    SW_OUTBIN_FILE bf;
+    unsigned int ncol = nval + 2;
+    unsigned int icol;
+    unsigned int irow;
+    int timeValues[2];
+    double *row = new double[nval];
+    char **colnames = new char *[ncol];
+    char **units = new char *[ncol];
+    char (*names)[20] = new char[ncol][20];
+
+    for (icol = 0; icol < ncol; icol++) {
+        (void) snprintf(names[icol], sizeof names[icol], "Col_%u", icol);
+        colnames[icol] = names[icol];
+        units[icol] = (char *) ((icol < 2) ? "day" : "cm");
+    }
+
+    SW_OUTBIN_open(
+        &bf, fnameBin, eSW_Day, ncol, 2, colnames, units, compress, LogInfo
+    );
+    sw_fail_on_error(LogInfo); // exit test program if unexpected error
+
+    for (irow = 0; irow < nrow; irow++) {
+        timeValues[0] = 1980 + (int) (irow / 365);
+        timeValues[1] = 1 + (int) (irow % 365);
+        values[irow] = timeValues[0];
+        values[nrow + irow] = timeValues[1];
+
+        for (icol = 0; icol < nval; icol++) {
+            switch (icol % 5) {
+            case 0: // constant
+                row[icol] = 0.;
+                break;
+            case 1: // slowly changing
+                row[icol] = (irow / 10) * 0.5 - 3.;
+                break;
+            case 2: // many decimal places
+                row[icol] = 1. / (1. + irow + icol);
+                break;
+            case 3: // special values
+                row[icol] = (irow % 3 == 0) ? NAN :
+                            (irow % 3 == 1) ? -INFINITY :
+                                              -0.;
+                break;
+            default:
+                row[icol] = -1e300 * irow;
+                break;
+            }
+
+            values[(size_t) (2 + icol) * nrow + irow] = row[icol];
+        }
+
+        // add values in two chunks (as from two output keys)
+        SW_OUTBIN_add_values(&bf, row, nval / 2, LogInfo);
+        SW_OUTBIN_add_values(&bf, row + nval / 2, nval - nval / 2, LogInfo);
+        SW_OUTBIN_end_row(&bf, timeValues, LogInfo);
+        sw_fail_on_error(LogInfo); // exit test program if unexpected error
+    }
+
+    SW_OUTBIN_close(&bf, LogInfo);
+    sw_fail_on_error(LogInfo); // exit test program if unexpected error
+
+    delete[] row;
+    delete[] colnames;
+    delete[] units;
+    delete[] names;
+}
+
+// Check that a binary output file reproduces values bit by bit
+void checkBinaryTestFile(
+    unsigned int nval, unsigned int nrow, const double *values
+) {
+    LOG_INFO LogInfo;
+    SW_OUTBIN_DATA data;
+
+    sw_init_logs(NULL, &LogInfo);
+
+    SW_OUTBIN_read(fnameBin, &data, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    EXPECT_EQ(data.pd, eSW_Day);
+    ASSERT_EQ(data.ncol, nval + 2);
+    EXPECT_EQ(data.ntime, 2u);
+    ASSERT_EQ(data.nrow, (size_t) nrow);
+
+    EXPECT_STREQ(data.colnames[0], "Col_0");
+    EXPECT_STREQ(data.colnames[2], "Col_2");
+    EXPECT_STREQ(data.units[0], "day");
+    EXPECT_STREQ(data.units[2], "cm");
+    EXPECT_EQ(data.type[1], SW_OUTBIN_INT32);
+    EXPECT_EQ(data.type[2], SW_OUTBIN_FLOAT64);
+
+    EXPECT_EQ(
+        memcmp(
+            data.values,
+            values,
+            (size_t) data.ncol * data.nrow * sizeof(double)
+        ),
+        0
+    );
+
+    SW_OUTBIN_free_data(&data);
+}
+
+TEST(OutputBinaryTest, OutputBinaryRoundTrip) {
+    LOG_INFO LogInfo;
+    // rows span several blocks (SW_OUTBUFSIZE bytes of values per block)
+    const unsigned int nval = 2000;
+    const unsigned int nrow = 3 * (SW_OUTBUFSIZE / ((nval + 2) * 8)) + 7;
+    double *values = new double[(size_t) (nval + 2) * nrow];
+    int i;
+
+    sw_init_logs(NULL, &LogInfo);
+
+    for (i = 0; i < 2; i++) {
+        SCOPED_TRACE((i == 1) ? "compressed" : "raw");
+
+        writeBinaryTestFile(nval, nrow, (Bool) i, values, &LogInfo);
+        checkBinaryTestFile(nval, nrow, values);
+
+        // A file without any rows
+        writeBinaryTestFile(nval, 0, (Bool) i, values, &LogInfo);
+        checkBinaryTestFile(nval, 0, values);
+    }
+
+    (void) remove(fnameBin);
+    delete[] values;
+}
+
+TEST(OutputBinaryTest, OutputBinaryCompression) {
+    LOG_INFO LogInfo;
+    SW_OUTBIN_DATA data;
+    const unsigned int nval = 20;
+    const unsigned int nrow = 1000;
+    double *values = new double[(size_t) (nval + 2) * nrow];
+    long sizeFile[2];
+    unsigned char *content;
+    FILE *fp;
+    int i;
+
+    sw_init_logs(NULL, &LogInfo);
+
+    for (i = 0; i < 2; i++) {
+        writeBinaryTestFile(nval, nrow, (Bool) i, values, &LogInfo);
+
+        fp = OpenFile(fnameBin, "rb", &LogInfo);
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+        (void) fseek(fp, 0, SEEK_END);
+        sizeFile[i] = ftell(fp);
+        CloseFile(&fp, &LogInfo);
+    }
+
+    // Compressed file is smaller
+    EXPECT_LT(sizeFile[1], sizeFile[0]);
+
+    // and holds identical values
+    checkBinaryTestFile(nval, nrow, values);
+
+    // Truncated file is detected
+    content = new unsigned char[sizeFile[1]];
+    fp = OpenFile(fnameBin, "rb", &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(fread(content, 1, sizeFile[1], fp), (size_t) sizeFile[1]);
+    CloseFile(&fp, &LogInfo);
+
+    fp = OpenFile(fnameBin, "wb", &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    (void) fwrite(content, 1, sizeFile[1] - 5, fp);
+    CloseFile(&fp, &LogInfo);
+    delete[] content;
+
+    SW_OUTBIN_read(fnameBin, &data, &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+    EXPECT_THAT(LogInfo.errorMsg, HasSubstr("corrupt"));
+
+    (void) remove(fnameBin);
+    delete[] values;
+}
+
+TEST(OutputBinaryTest, OutputBinaryErrors) {
+    LOG_INFO LogInfo;
+    SW_OUTBIN_FILE bf;
+    SW_OUTBIN_DATA data;
+    char *colnames[3] = {(char *) "Year", (char *) "A", (char *) "B"};
+    char *units[3] = {(char *) "year", (char *) "cm", (char *) "cm"};
+    double row[3] = {1., 2., 3.};
+    int timeValues[1] = {1980};
+    FILE *fp;
+
+    // Too many values for a row
+    sw_init_logs(NULL, &LogInfo);
+    SW_OUTBIN_open(
+        &bf, fnameBin, eSW_Year, 3, 1, colnames, units, swTRUE, &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_OUTBIN_add_values(&bf, row, 3, &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+    EXPECT_THAT(LogInfo.errorMsg, HasSubstr("too many values"));
+
+    // Incomplete row
+    sw_init_logs(NULL, &LogInfo);
+    SW_OUTBIN_add_values(&bf, row, 1, &LogInfo);
+    SW_OUTBIN_end_row(&bf, timeValues, &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+    EXPECT_THAT(LogInfo.errorMsg, HasSubstr("row has 2 instead of 3"));
+
+    sw_init_logs(NULL, &LogInfo);
+    SW_OUTBIN_close(&bf, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Not a binary output file
+    fp = OpenFile(fnameBin, "w", &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    (void) fputs("Year,A,B\n1980,2.000000,3.000000\n", fp);
+    CloseFile(&fp, &LogInfo);
+
+    SW_OUTBIN_read(fnameBin, &data, &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+    EXPECT_THAT(LogInfo.errorMsg, HasSubstr("not a (supported) binary"));
+    EXPECT_EQ(data.ncol, 0u);
+
+    (void) remove(fnameBin);
+}
+
+// Units of binary output must match `SW2 units` of the table of
+// output variables (which is also used by netCDF output)
+TEST(OutputBinaryTest, OutputBinaryUnitsMatchVariableTable) {
+    std::ifstream fin("Input_nc/SW2_netCDF_output_variables.tsv");
+    std::string line;
+    std::string group;
+    std::string varName;
+    std::string field;
+    std::string units;
+    unsigned int nvarTable[SW_OUTNKEYS] = {0};
+    int k;
+    int kTable;
+    unsigned int ivar;
+    unsigned int nvarUnits;
+    const char *unitsBin;
+
+    ASSERT_TRUE(fin.is_open());
+    ASSERT_TRUE(static_cast<bool>(std::getline(fin, line))); // header
+
+    while (std::getline(fin, line)) {
+        std::istringstream fields(line);
+
+        std::getline(fields, group, '\t');
+        std::getline(fields, varName, '\t');
+        std::getline(fields, field, '\t'); // SW2 txt output
+        std::getline(fields, units, '\t');
+
+        kTable = -1;
+        ForEachOutKey(k) {
+            if (strcmp(group.c_str(), key2str[k]) == 0) {
+                kTable = k;
+            }
+        }
+        ASSERT_GE(kTable, 0) << "Unknown output group " << group;
+
+        unitsBin = SW_OUTBIN_units(
+            (OutKey) kTable, (IntUS) nvarTable[kTable]
+        );
+        ASSERT_NE(unitsBin, nullptr) << group << ": " << varName;
+        EXPECT_STREQ(unitsBin, units.c_str()) << group << ": " << varName;
+
+        nvarTable[kTable]++;
+    }
+
+    // Binary output has units for exactly the variables of the table;
+    // the table describes one establishment variable per species
+    ForEachOutKey(k) {
+        nvarUnits = 0;
+        for (ivar = 0; ivar < SW_OUTNMAXVARS; ivar++) {
+            unitsBin = SW_OUTBIN_units((OutKey) k, (IntUS) ivar);
+            if (unitsBin != nullptr) {
+                nvarUnits++;
+
+                if (k == eSW_Estab) {
+                    EXPECT_STREQ(unitsBin, SW_OUTBIN_units(eSW_Estab, 0));
+                }
+            }
+        }
+
+        if (k == eSW_Estab) {
+            EXPECT_EQ(nvarTable[k], 1u);
+        } else {
+            EXPECT_EQ(nvarUnits, nvarTable[k]) << key2str[k];
+        }
+    }
+}
+} // namespace
+
+#endif // SW_OUTBIN
@@ -1,9 +1,14 @@
+#include "include/filefuncs.h"           // for MkDir, DirExists
 #include "include/generic.h"             // for swTRUE
 #include "include/SW_Control.h"          // for SW_CTL_main, SW_CTL_run_spinup
+#include "include/SW_Defines.h"          // for TimeInt, eSW_Year
 #include "include/SW_Main_lib.h"         // for sw_fail_on_error
 #include "include/SW_Times.h"            // for Today
 #include "tests/gtests/sw_testhelpers.h" // for SpinUpFixtureTest
 #include "gtest/gtest.h"                 // for Test, Message, TestPartResul...
+#include <stdint.h>                      // for uint64_t
+#include <stdio.h>                       // for fopen, fread, fwrite, remove
+#include <unistd.h>                      // for getcwd
 
 #if defined(SW2_SpinupEvaluation)
 #include "include/filefuncs.h"      // for OpenFile, CloseFile
@@ -303,6 +308,467 @@ TEST_F(SpinUpFixtureTest, Mode2WithScopeLessThanDuration) {
     delete[] prevMoist;
 }
 
+// Test adaptive spinup: without tolerances, all years are simulated
+TEST_F(SpinUpFixtureTest, AdaptiveWithoutTolerances) {
+    SW_Run.Model.SW_SpinUp.mode = 2;
+    SW_Run.Model.SW_SpinUp.scope = 1;
+    SW_Run.Model.SW_SpinUp.duration = 5;
+    SW_Run.Model.SW_SpinUp.tolSWC = 0.;
+    SW_Run.Model.SW_SpinUp.tolTsoil = 0.;
+    SW_Run.Site.use_soil_temp = swTRUE;
+    SW_Run.Model.SW_SpinUp.spinup = swTRUE;
+
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    EXPECT_EQ(SW_Run.Model.SW_SpinUp.nYearsUsed, 5u);
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+}
+
+// Test adaptive spinup: repeating the same year equilibrates soil moisture
+// and soil temperature well before the maximum duration
+TEST_F(SpinUpFixtureTest, AdaptiveConverges) {
+    int i;
+    int const n = 8; // n = number of soil layers to test
+    double prevTemp[n];
+    double prevMoist[n];
+
+    SW_Run.Model.SW_SpinUp.mode = 2;
+    SW_Run.Model.SW_SpinUp.scope = 1;
+    SW_Run.Model.SW_SpinUp.duration = 200;
+    SW_Run.Model.SW_SpinUp.tolSWC = 0.01;
+    SW_Run.Model.SW_SpinUp.tolTsoil = 0.01;
+    SW_Run.Site.use_soil_temp = swTRUE;
+    SW_Run.Model.SW_SpinUp.spinup = swTRUE;
+
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    EXPECT_GE(SW_Run.Model.SW_SpinUp.nYearsUsed, 2u);
+    EXPECT_LT(SW_Run.Model.SW_SpinUp.nYearsUsed, 200u);
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+
+    // Another year of spinup changes state by no more than the tolerances
+    for (i = 0; i < n; i++) {
+        prevTemp[i] = SW_Run.SoilWat.avgLyrTemp[i];
+        prevMoist[i] = SW_Run.SoilWat.swcBulk[Today][i];
+    }
+
+    SW_Run.Model.SW_SpinUp.duration = 1;
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    for (i = 0; i < n; i++) {
+        EXPECT_NEAR(prevTemp[i], SW_Run.SoilWat.avgLyrTemp[i], 0.01);
+        EXPECT_NEAR(prevMoist[i], SW_Run.SoilWat.swcBulk[Today][i], 0.01);
+    }
+}
+
+// Test adaptive spinup: warn if not converged within maximum duration
+TEST_F(SpinUpFixtureTest, AdaptiveDoesNotConverge) {
+    SW_Run.Model.SW_SpinUp.mode = 1;
+    SW_Run.Model.SW_SpinUp.scope = 27;
+    SW_Run.Model.SW_SpinUp.duration = 3;
+    SW_Run.Model.SW_SpinUp.tolSWC = 1e-6;
+    SW_Run.Model.SW_SpinUp.tolTsoil = 1e-6;
+    SW_Run.Site.use_soil_temp = swTRUE;
+    SW_Run.Model.SW_SpinUp.spinup = swTRUE;
+
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    EXPECT_EQ(SW_Run.Model.SW_SpinUp.nYearsUsed, 3u);
+    EXPECT_EQ(LogInfo.numWarnings, 1);
+}
+
+// Test warm start: simulation runs that continue from a spinup state
+// snapshot are bit-identical to runs that continue from the spinup
+TEST_F(SpinUpFixtureTest, WarmStartIsBitIdentical) {
+    SW_RUN warm_sw;
+    const char *fname = "Output/test_SW_SpinUp." SW_SPINUP_STATE_EXT;
+    uint64_t hash;
+    unsigned int i;
+
+    SW_Run.Model.SW_SpinUp.mode = 1;
+    SW_Run.Model.SW_SpinUp.scope = 10;
+    SW_Run.Model.SW_SpinUp.duration = 5;
+    SW_Run.Site.use_soil_temp = swTRUE;
+
+    SW_RUN_deepCopy(&SW_Run, &warm_sw, &SW_Domain.OutDom, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    hash = SW_CTL_hash_spinup(&SW_Run);
+    EXPECT_EQ(hash, SW_CTL_hash_spinup(&warm_sw));
+
+    // Cold start: run spinup and store snapshot of its final state
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_CTL_write_spinup_state(&SW_Run, hash, fname, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+
+    // Warm start: restore state after spinup from snapshot
+    EXPECT_TRUE(SW_CTL_read_spinup_state(&warm_sw, hash, fname, &LogInfo));
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(
+        warm_sw.Model.SW_SpinUp.nYearsUsed, SW_Run.Model.SW_SpinUp.nYearsUsed
+    );
+
+    // Simulation runs are bit-identical
+    SW_CTL_main(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_CTL_main(&warm_sw, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    for (i = 0; i < SW_Run.Site.n_layers; i++) {
+        EXPECT_EQ(
+            warm_sw.SoilWat.swcBulk[Today][i], SW_Run.SoilWat.swcBulk[Today][i]
+        );
+        EXPECT_EQ(warm_sw.SoilWat.avgLyrTemp[i], SW_Run.SoilWat.avgLyrTemp[i]);
+    }
+    EXPECT_EQ(warm_sw.SoilWat.snowpack[Today], SW_Run.SoilWat.snowpack[Today]);
+    EXPECT_EQ(warm_sw.Markov.n_genDays, SW_Run.Markov.n_genDays);
+
+    (void) remove(fname);
+    SW_CTL_clear_model(swTRUE, &warm_sw);
+}
+
+// Test warm start: outdated or incomplete snapshots are not used
+TEST_F(SpinUpFixtureTest, WarmStartIgnoresOutdatedSnapshots) {
+    SW_RUN warm_sw;
+    const char *fname = "Output/test_SW_SpinUp." SW_SPINUP_STATE_EXT;
+    double swcInit = SW_Run.SoilWat.swcBulk[Today][0];
+    uint64_t hash;
+    uint64_t hashChanged;
+    char buf[100000];
+    size_t size;
+    FILE *fp;
+
+    SW_Run.Model.SW_SpinUp.mode = 2;
+    SW_Run.Model.SW_SpinUp.scope = 1;
+    SW_Run.Model.SW_SpinUp.duration = 3;
+
+    SW_RUN_deepCopy(&SW_Run, &warm_sw, &SW_Domain.OutDom, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    hash = SW_CTL_hash_spinup(&SW_Run);
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_CTL_write_spinup_state(&SW_Run, hash, fname, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // No snapshot
+    EXPECT_FALSE(SW_CTL_read_spinup_state(
+        &warm_sw, hash, "Output/test_SW_SpinUp_missing.sw2s", &LogInfo
+    ));
+
+    // Changed spinup settings
+    warm_sw.Model.SW_SpinUp.duration = 4;
+    hashChanged = SW_CTL_hash_spinup(&warm_sw);
+    EXPECT_NE(hash, hashChanged);
+    EXPECT_FALSE(
+        SW_CTL_read_spinup_state(&warm_sw, hashChanged, fname, &LogInfo)
+    );
+    warm_sw.Model.SW_SpinUp.duration = 3;
+
+    // Changed inputs within the spinup scope
+    warm_sw.Weather.allHist[0].temp_max[0] += 1.;
+    EXPECT_NE(hash, SW_CTL_hash_spinup(&warm_sw));
+    warm_sw.Weather.allHist[0].temp_max[0] -= 1.;
+    EXPECT_EQ(hash, SW_CTL_hash_spinup(&warm_sw));
+
+    // Changed establishment parameters
+    ASSERT_GT(warm_sw.VegEstab.count, 0u);
+    warm_sw.VegEstab.parms[0]->min_temp_germ += 1.;
+    EXPECT_NE(hash, SW_CTL_hash_spinup(&warm_sw));
+    warm_sw.VegEstab.parms[0]->min_temp_germ -= 1.;
+
+    // Changed observed soil moisture settings
+    warm_sw.SoilWat.hist_use = swTRUE;
+    EXPECT_NE(hash, SW_CTL_hash_spinup(&warm_sw));
+    warm_sw.SoilWat.hist_use = swFALSE;
+
+    // Run-time state variables do not affect the hash
+    warm_sw.Weather.temp_snow += 1.;
+    warm_sw.Weather.snowRunoff += 1.;
+    warm_sw.SoilWat.swcBulk[Today][0] += 1.;
+    EXPECT_EQ(hash, SW_CTL_hash_spinup(&warm_sw));
+    warm_sw.Weather.temp_snow -= 1.;
+    warm_sw.Weather.snowRunoff -= 1.;
+    warm_sw.SoilWat.swcBulk[Today][0] -= 1.;
+
+    // Incomplete snapshot (last byte is missing)
+    fp = fopen(fname, "rb");
+    ASSERT_NE(fp, nullptr);
+    size = fread(buf, 1, sizeof buf, fp);
+    (void) fclose(fp);
+    ASSERT_GT(size, 0u);
+    ASSERT_LT(size, sizeof buf);
+    fp = fopen(fname, "wb");
+    ASSERT_NE(fp, nullptr);
+    EXPECT_EQ(fwrite(buf, 1, size - 1, fp), size - 1);
+    (void) fclose(fp);
+    EXPECT_FALSE(SW_CTL_read_spinup_state(&warm_sw, hash, fname, &LogInfo));
+
+    // State is unchanged
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+    EXPECT_EQ(warm_sw.SoilWat.swcBulk[Today][0], swcInit);
+
+    (void) remove(fname);
+    SW_CTL_clear_model(swTRUE, &warm_sw);
+}
+
+// Test warm start: snapshots are stored in a directory with an absolute path
+// and a snapshot that cannot be written is an error
+TEST_F(SpinUpFixtureTest, WarmStartSnapshotsInAbsoluteDirectory) {
+    char cwd[FILENAME_MAX];
+    char stateDir[FILENAME_MAX];
+    char fname[FILENAME_MAX];
+    uint64_t hash;
+
+    ASSERT_NE(getcwd(cwd, sizeof cwd), nullptr);
+    ASSERT_LT(
+        snprintf(stateDir, sizeof stateDir, "%s/Output/test_abs/spinup", cwd),
+        (int) sizeof stateDir
+    );
+    ASSERT_LT(
+        snprintf(
+            fname, sizeof fname, "%s/spinup_1.%s", stateDir, SW_SPINUP_STATE_EXT
+        ),
+        (int) sizeof fname
+    );
+
+    SW_Run.Model.SW_SpinUp.mode = 1;
+    SW_Run.Model.SW_SpinUp.scope = 1;
+    SW_Run.Model.SW_SpinUp.duration = 1;
+
+    hash = SW_CTL_hash_spinup(&SW_Run);
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Missing directory: snapshot cannot be written
+    SW_CTL_write_spinup_state(&SW_Run, hash, fname, &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+    sw_init_logs(NULL, &LogInfo);
+
+    // Create nested directory from its absolute path
+    MkDir(stateDir, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_TRUE(DirExists(stateDir));
+    EXPECT_TRUE(DirExists("Output/test_abs/spinup"));
+
+    SW_CTL_write_spinup_state(&SW_Run, hash, fname, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_TRUE(SW_CTL_read_spinup_state(&SW_Run, hash, fname, &LogInfo));
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    (void) remove(fname);
+    (void) remove(stateDir);
+    (void) remove("Output/test_abs");
+}
+
+// Test that a run resumed from a checkpoint is bit-identical to a full run
+TEST_F(SpinUpFixtureTest, CheckpointRestartIsBitIdentical) {
+    SW_RUN full_sw;
+    SW_RUN resumed_sw;
+    const char *fname = "Output/test_SW_SpinUp." SW_CHECKPOINT_EXT;
+    TimeInt lastCheckpointYr;
+    unsigned int i;
+
+    SW_Run.Model.SW_SpinUp.mode = 1;
+    SW_Run.Model.SW_SpinUp.scope = 10;
+    SW_Run.Model.SW_SpinUp.duration = 5;
+    SW_Run.Site.use_soil_temp = swTRUE;
+
+    // Aggregate outputs without writing output files
+    SW_Domain.OutDom.print_SW_Output = swFALSE;
+    SW_Run.Model.doOutput = swTRUE;
+
+    SW_RUN_deepCopy(&SW_Run, &full_sw, &SW_Domain.OutDom, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_RUN_deepCopy(&SW_Run, &resumed_sw, &SW_Domain.OutDom, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Run with checkpoints every 10 years (last one is kept)
+    SW_Run.Checkpoint.fname = fname;
+    SW_Run.Checkpoint.nYears = 10;
+    SW_Run.Checkpoint.hash = SW_CTL_hash_checkpoint(&SW_Run, &SW_Domain.OutDom);
+    lastCheckpointYr = SW_Run.Model.startyr +
+                       10 * ((SW_Run.Model.endyr - SW_Run.Model.startyr) / 10) -
+                       1;
+
+    resumed_sw.Checkpoint.fname = fname;
+    resumed_sw.Checkpoint.hash =
+        SW_CTL_hash_checkpoint(&resumed_sw, &SW_Domain.OutDom);
+    EXPECT_EQ(resumed_sw.Checkpoint.hash, SW_Run.Checkpoint.hash);
+
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_CTL_main(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+
+    // Full run without checkpoints
+    SW_CTL_run_spinup(&full_sw, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_CTL_main(&full_sw, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Resume (without spinup) after the last checkpoint
+    EXPECT_TRUE(
+        SW_CTL_read_checkpoint(&resumed_sw, &SW_Domain.OutDom, &LogInfo)
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(resumed_sw.Checkpoint.nextYear, lastCheckpointYr + 1);
+
+    SW_CTL_main(&resumed_sw, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(resumed_sw.Checkpoint.nextYear, 0u);
+
+    // State and aggregated outputs are bit-identical
+    ASSERT_NE(full_sw.SoilWat.p_oagg[eSW_Year], nullptr);
+
+    for (i = 0; i < full_sw.Site.n_layers; i++) {
+        EXPECT_EQ(
+            resumed_sw.SoilWat.swcBulk[Today][i],
+            full_sw.SoilWat.swcBulk[Today][i]
+        );
+        EXPECT_EQ(
+            resumed_sw.SoilWat.avgLyrTemp[i], full_sw.SoilWat.avgLyrTemp[i]
+        );
+        EXPECT_EQ(
+            resumed_sw.SoilWat.p_oagg[eSW_Year]->swcBulk[i],
+            full_sw.SoilWat.p_oagg[eSW_Year]->swcBulk[i]
+        );
+        EXPECT_EQ(
+            SW_Run.SoilWat.p_oagg[eSW_Year]->swcBulk[i],
+            full_sw.SoilWat.p_oagg[eSW_Year]->swcBulk[i]
+        );
+    }
+    EXPECT_EQ(
+        resumed_sw.SoilWat.snowpack[Today], full_sw.SoilWat.snowpack[Today]
+    );
+    EXPECT_EQ(
+        resumed_sw.Weather.p_oagg[eSW_Year]->temp_max,
+        full_sw.Weather.p_oagg[eSW_Year]->temp_max
+    );
+    EXPECT_EQ(resumed_sw.Markov.n_genDays, full_sw.Markov.n_genDays);
+
+    // Checkpoint of a run with different inputs is not used
+    resumed_sw.Checkpoint.hash = SW_Run.Checkpoint.hash + 1;
+    EXPECT_FALSE(
+        SW_CTL_read_checkpoint(&resumed_sw, &SW_Domain.OutDom, &LogInfo)
+    );
+    EXPECT_EQ(resumed_sw.Checkpoint.nextYear, 0u);
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+
+    (void) remove(fname);
+    SW_CTL_clear_model(swTRUE, &full_sw);
+    SW_CTL_clear_model(swTRUE, &resumed_sw);
+}
+
+#if defined(SWNETCDF)
+// Test that a run with streaming output that is resumed from a checkpoint
+// holds the same output as an uninterrupted run without streaming output
+TEST_F(SpinUpFixtureTest, CheckpointRestartWithStreamingOutput) {
+    SW_DOMAIN streamDom;
+    SW_RUN stream_sw;
+    SW_RUN resumed_sw;
+    const char *fname = "Output/test_SW_SpinUp_stream." SW_CHECKPOINT_EXT;
+    OutPeriod pd;
+
+    // Full run without streaming output
+    SW_Run.Model.doOutput = swTRUE;
+    SW_CTL_main(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Stream output every 7 years (not a divisor of the simulated years)
+    setup_streamed_domain(&streamDom, 7, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_RUN_deepCopy(
+        &template_SW_Run, &stream_sw, &streamDom.OutDom, swTRUE, &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_RUN_deepCopy(
+        &template_SW_Run, &resumed_sw, &streamDom.OutDom, swTRUE, &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    stream_sw.Model.doOutput = swTRUE;
+    stream_sw.OutRun.domType = streamDom.DomainType;
+    stream_sw.Checkpoint.fname = fname;
+    stream_sw.Checkpoint.nYears = 10;
+    stream_sw.Checkpoint.hash =
+        SW_CTL_hash_checkpoint(&stream_sw, &streamDom.OutDom);
+
+    resumed_sw.Model.doOutput = swTRUE;
+    resumed_sw.OutRun.domType = streamDom.DomainType;
+    resumed_sw.Checkpoint.fname = fname;
+    resumed_sw.Checkpoint.hash = stream_sw.Checkpoint.hash;
+
+    // Run with streaming output and checkpoints every 10 years
+    // (last one is kept)
+    SW_CTL_main(&stream_sw, &streamDom.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Resume after the last checkpoint (output was already streamed)
+    EXPECT_TRUE(
+        SW_CTL_read_checkpoint(&resumed_sw, &streamDom.OutDom, &LogInfo)
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_GT(resumed_sw.OutRun.irowOffset_OUT[eSW_Day], 0u);
+
+    SW_CTL_main(&resumed_sw, &streamDom.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Streamed and remaining time steps match the run without streaming
+    ForEachOutPeriod(pd) {
+        EXPECT_EQ(
+            resumed_sw.OutRun.irowOffset_OUT[pd],
+            stream_sw.OutRun.irowOffset_OUT[pd]
+        );
+        EXPECT_EQ(resumed_sw.OutRun.irow_OUT[pd], stream_sw.OutRun.irow_OUT[pd]);
+        EXPECT_EQ(
+            resumed_sw.OutRun.irowOffset_OUT[pd] +
+                resumed_sw.OutRun.irow_OUT[pd],
+            SW_Run.OutRun.irow_OUT[pd]
+        );
+    }
+
+    // Output held in memory (i.e., not yet streamed) is bit-identical
+    EXPECT_EQ(
+        count_streamed_output_diffs(
+            &SW_Domain.OutDom,
+            SW_Run.OutRun.p_OUT,
+            &streamDom.OutDom,
+            resumed_sw.OutRun.p_OUT,
+            resumed_sw.OutRun.irow_OUT,
+            resumed_sw.OutRun.irowOffset_OUT
+        ),
+        0u
+    );
+    EXPECT_EQ(
+        count_streamed_output_diffs(
+            &SW_Domain.OutDom,
+            SW_Run.OutRun.p_OUT,
+            &streamDom.OutDom,
+            stream_sw.OutRun.p_OUT,
+            stream_sw.OutRun.irow_OUT,
+            stream_sw.OutRun.irowOffset_OUT
+        ),
+        0u
+    );
+
+    (void) remove(fname);
+    SW_CTL_clear_model(swTRUE, &stream_sw);
+    SW_CTL_clear_model(swTRUE, &resumed_sw);
+    SW_DOM_deconstruct(&streamDom);
+}
+#endif
+
 // Evaluate spinup
 
 #ifdef SW2_SpinupEvaluation
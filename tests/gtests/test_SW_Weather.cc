@@ -1,17 +1,23 @@
 #include "include/generic.h"             // for swTRUE, swFALSE, Bool, squared
+#include "include/SW_Control.h"          // for SW_CTL_main, SW_RUN_deepCopy
 #include "include/SW_datastructs.h"      // for SW_CLIMATE_CLIM, SW_CLIMATE...
+#include "include/filefuncs.h"           // for FileExists, MkDir
 #include "include/SW_Defines.h"          // for MAX_MONTHS, SHORT_WR, REL_H...
 #include "include/SW_Flow_lib_PET.h"     // for svp, actualVaporPressure2
 #include "include/SW_Main_lib.h"         // for sw_fail_on_error
 #include "include/SW_Markov.h"           // for SW_MKV_setup
 #include "include/SW_Sky.h"              // for SW_SKY_read
+#include "include/SW_Times.h"            // for Today
 #include "include/SW_Weather.h"          // for SW_WTH_read, checkAllWeather
 #include "include/Times.h"               // for Jan, Feb, Dec
 #include "tests/gtests/sw_testhelpers.h" // for WeatherFixtureTest, tol6
 #include "gmock/gmock.h"                 // for HasSubstr, MakePredicateFor...
 #include "gtest/gtest.h"                 // for Test, Message, TestPartResul...
 #include <cmath>                         // for isnan, sqrt
-#include <stdio.h>                       // for snprintf, NULL
+#include <stdint.h>                      // for uint64_t
+#include <stdio.h>                       // for snprintf, NULL, remove
+#include <string.h>                      // for memcmp, memcpy
+#include <unistd.h>                      // for getcwd
 
 
 using ::testing::HasSubstr;
@@ -221,6 +227,214 @@ TEST_F(WeatherFixtureTest, WeatherWeatherGeneratorOnly) {
     }
 }
 
+// Daily weather that is finalized just before each year is simulated is
+// identical to daily weather that is finalized for all years upfront
+TEST_F(WeatherFixtureTest, WeatherLazyFinalizeIsIdenticalToEager) {
+    SW_WEATHER_HIST *eagerHist;
+    sw_random_t markov_rng;
+    unsigned int nYears;
+    unsigned int year;
+
+    SW_Run.Weather.generateWeatherMethod = 2;
+    SW_Run.Weather.scale_temp_max[Feb] = 1.5;
+    SW_Run.Weather.scale_precip[Dec] = 0.8;
+
+    SW_MKV_setup(
+        &SW_Run.Markov,
+        SW_Run.Weather.rng_seed,
+        SW_Run.Weather.generateWeatherMethod,
+        SW_Domain.SW_PathInputs.txtInFiles,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Change directory to get input files with some missing data
+    // (missing days in 1980 and missing years 1981 and 1982)
+    (void) snprintf(
+        SW_Run.Weather.name_prefix,
+        sizeof SW_Run.Weather.name_prefix,
+        "%s",
+        "Input/data_weather_missing/weath"
+    );
+
+    SW_Run.Model.startyr = 1980;
+    SW_Run.Model.endyr = 1983;
+
+    // Finalize all years upfront
+    SW_WTH_read(&SW_Run.Weather, &SW_Run.Sky, &SW_Run.Model, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    markov_rng = SW_Run.Markov.markov_rng;
+
+    SW_WTH_finalize_all_weather(
+        &SW_Run.Markov,
+        &SW_Run.Weather,
+        SW_Run.Model.cum_monthdays,
+        SW_Run.Model.days_in_month,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    nYears = SW_Run.Weather.n_years;
+    eagerHist = new SW_WEATHER_HIST[nYears];
+    memcpy(eagerHist, SW_Run.Weather.allHist, sizeof(SW_WEATHER_HIST) * nYears);
+
+    // Defer finalization
+    SW_WTH_read(&SW_Run.Weather, &SW_Run.Sky, &SW_Run.Model, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_Run.Markov.markov_rng = markov_rng;
+    SW_Run.Weather.finalizeLazily = swTRUE;
+
+    SW_WTH_finalize_all_weather(
+        &SW_Run.Markov,
+        &SW_Run.Weather,
+        SW_Run.Model.cum_monthdays,
+        SW_Run.Model.days_in_month,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    EXPECT_EQ(SW_Run.Weather.n_yearsFinalized, 0u);
+    EXPECT_TRUE(missing(SW_Run.Weather.allHist[1].temp_max[0]));
+
+    // Finalize each year at the beginning of the simulated year
+    for (year = 0; year < nYears; year++) {
+        SW_WTH_new_year(
+            &SW_Run.Markov,
+            &SW_Run.Weather,
+            SW_Run.Weather.startYear + year,
+            &LogInfo
+        );
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+        EXPECT_EQ(SW_Run.Weather.n_yearsFinalized, year + 1);
+        EXPECT_EQ(
+            memcmp(
+                &eagerHist[year],
+                &SW_Run.Weather.allHist[year],
+                sizeof(SW_WEATHER_HIST)
+            ),
+            0
+        ) << "year index " << year;
+    }
+
+    // Random number generator of the simulation run remains unchanged
+    EXPECT_EQ(
+        memcmp(&markov_rng, &SW_Run.Markov.markov_rng, sizeof markov_rng), 0
+    );
+
+    delete[] eagerHist;
+}
+
+// A simulation run (including a spinup) with daily weather that is finalized
+// just before each year is simulated (as with option `-l` for daily weather
+// that is read per simulation unit) is identical to a run with daily weather
+// that is finalized upfront
+TEST_F(WeatherFixtureTest, WeatherLazyFinalizeRunIsIdenticalToEager) {
+    SW_RUN lazy_sw;
+    unsigned int i;
+    unsigned int year;
+
+    SW_Run.Model.SW_SpinUp.mode = 1;
+    SW_Run.Model.SW_SpinUp.scope = 10;
+    SW_Run.Model.SW_SpinUp.duration = 5;
+    SW_Run.Site.use_soil_temp = swTRUE;
+
+    // Aggregate outputs without writing output files
+    SW_Domain.OutDom.print_SW_Output = swFALSE;
+    SW_Run.Model.doOutput = swTRUE;
+
+    // Impute missing weather (missing years 1981-2009) with the generator
+    SW_Run.Weather.generateWeatherMethod = 2;
+    (void) snprintf(
+        SW_Run.Weather.name_prefix,
+        sizeof SW_Run.Weather.name_prefix,
+        "%s",
+        "Input/data_weather_missing/weath"
+    );
+
+    SW_MKV_setup(
+        &SW_Run.Markov,
+        SW_Run.Weather.rng_seed,
+        SW_Run.Weather.generateWeatherMethod,
+        SW_Domain.SW_PathInputs.txtInFiles,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_WTH_read(&SW_Run.Weather, &SW_Run.Sky, &SW_Run.Model, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_RUN_deepCopy(&SW_Run, &lazy_sw, &SW_Domain.OutDom, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    lazy_sw.Weather.finalizeLazily = swTRUE;
+
+    // Finalize all years upfront
+    SW_WTH_finalize_all_weather(
+        &SW_Run.Markov,
+        &SW_Run.Weather,
+        SW_Run.Model.cum_monthdays,
+        SW_Run.Model.days_in_month,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    SW_CTL_run_spinup(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_CTL_main(&SW_Run, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Defer finalization to the simulated years
+    SW_WTH_finalize_all_weather(
+        &lazy_sw.Markov,
+        &lazy_sw.Weather,
+        lazy_sw.Model.cum_monthdays,
+        lazy_sw.Model.days_in_month,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(lazy_sw.Weather.n_yearsFinalized, 0u);
+
+    SW_CTL_run_spinup(&lazy_sw, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    SW_CTL_main(&lazy_sw, &SW_Domain.OutDom, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Daily weather, state, and aggregated outputs are bit-identical
+    ASSERT_EQ(lazy_sw.Weather.n_yearsFinalized, SW_Run.Weather.n_years);
+    for (year = 0; year < SW_Run.Weather.n_years; year++) {
+        EXPECT_EQ(
+            memcmp(
+                &lazy_sw.Weather.allHist[year],
+                &SW_Run.Weather.allHist[year],
+                sizeof(SW_WEATHER_HIST)
+            ),
+            0
+        ) << "year index " << year;
+    }
+
+    ASSERT_NE(SW_Run.SoilWat.p_oagg[eSW_Year], nullptr);
+    for (i = 0; i < SW_Run.Site.n_layers; i++) {
+        EXPECT_EQ(
+            lazy_sw.SoilWat.swcBulk[Today][i], SW_Run.SoilWat.swcBulk[Today][i]
+        );
+        EXPECT_EQ(lazy_sw.SoilWat.avgLyrTemp[i], SW_Run.SoilWat.avgLyrTemp[i]);
+        EXPECT_EQ(
+            lazy_sw.SoilWat.p_oagg[eSW_Year]->swcBulk[i],
+            SW_Run.SoilWat.p_oagg[eSW_Year]->swcBulk[i]
+        );
+    }
+    EXPECT_EQ(
+        lazy_sw.Weather.p_oagg[eSW_Year]->temp_max,
+        SW_Run.Weather.p_oagg[eSW_Year]->temp_max
+    );
+    EXPECT_EQ(lazy_sw.Markov.n_genDays, SW_Run.Markov.n_genDays);
+    EXPECT_GT(SW_Run.Markov.n_genDays, 0u);
+
+    SW_CTL_clear_model(swTRUE, &lazy_sw);
+}
+
 TEST_F(WeatherFixtureTest, ReadAllWeatherTooManyMissingForLOCFDeathTest) {
 
     // Error: too many missing values and weather generator turned off
@@ -792,6 +1006,175 @@ TEST_F(
     delete[] meanTempMon_C;
 }
 
+// Climate summaries obtained from the cache are identical to calculated ones
+TEST_F(WeatherFixtureTest, ClimateCacheRoundTrip) {
+
+    // This test relies on allHist from `SW_WEATHER` being already filled
+    SW_CLIMATE_YEARLY climateOutput;
+    SW_CLIMATE_CLIM climateAverages;
+    SW_CLIMATE_YEARLY cachedOutput;
+    SW_CLIMATE_CLIM cachedAverages;
+
+    char cwd[FILENAME_MAX];
+    char cacheDir[FILENAME_MAX - 64];
+    char fname[FILENAME_MAX];
+    uint64_t hash;
+    FILE *fp;
+    int month;
+    int k;
+
+    Bool const inNorthHem = swTRUE;
+
+    // Allocate memory
+    // 31 = number of years used in test
+    allocateClimateStructs(31, &climateOutput, &climateAverages, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    allocateClimateStructs(31, &cachedOutput, &cachedAverages, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Cache directory with an absolute path (as with `-k climatedir`)
+    ASSERT_NE(getcwd(cwd, sizeof cwd), nullptr);
+    ASSERT_LT(
+        snprintf(cacheDir, sizeof cacheDir, "%s/Output/test_abs/clim", cwd),
+        (int) sizeof cacheDir
+    );
+    MkDir(cacheDir, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    ASSERT_TRUE(DirExists("Output/test_abs/clim"));
+
+    hash = SW_WTH_hash_climate(SW_Run.Weather.allHist, 31, 1980, inNorthHem);
+
+    (void) snprintf(
+        fname,
+        sizeof fname,
+        "%s/climate_%016llx.%s",
+        cacheDir,
+        (unsigned long long) hash,
+        SW_CLIM_CACHE_EXT
+    );
+    (void) remove(fname);
+
+
+    // ------ Cache is absent: calculate and store climate summary ------
+    EXPECT_FALSE(
+        SW_WTH_read_climate_cache(cacheDir, hash, &cachedAverages, &LogInfo)
+    );
+
+    SW_WTH_calc_climate_averages(
+        SW_Run.Weather.allHist,
+        SW_Run.Model.cum_monthdays,
+        SW_Run.Model.days_in_month,
+        31,
+        1980,
+        inNorthHem,
+        cacheDir,
+        &climateOutput,
+        &climateAverages,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    EXPECT_TRUE(FileExists(fname));
+
+
+    // ------ Cache is present: identical climate summary ------
+    SW_WTH_calc_climate_averages(
+        SW_Run.Weather.allHist,
+        SW_Run.Model.cum_monthdays,
+        SW_Run.Model.days_in_month,
+        31,
+        1980,
+        inNorthHem,
+        cacheDir,
+        &cachedOutput,
+        &cachedAverages,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    for (month = 0; month < MAX_MONTHS; month++) {
+        EXPECT_DOUBLE_EQ(
+            cachedAverages.meanTempMon_C[month],
+            climateAverages.meanTempMon_C[month]
+        );
+        EXPECT_DOUBLE_EQ(
+            cachedAverages.maxTempMon_C[month],
+            climateAverages.maxTempMon_C[month]
+        );
+        EXPECT_DOUBLE_EQ(
+            cachedAverages.minTempMon_C[month],
+            climateAverages.minTempMon_C[month]
+        );
+        EXPECT_DOUBLE_EQ(
+            cachedAverages.PPTMon_cm[month], climateAverages.PPTMon_cm[month]
+        );
+    }
+
+    for (k = 0; k < 3; k++) {
+        EXPECT_DOUBLE_EQ(cachedAverages.sdC4[k], climateAverages.sdC4[k]);
+        EXPECT_DOUBLE_EQ(
+            cachedAverages.sdCheatgrass[k], climateAverages.sdCheatgrass[k]
+        );
+    }
+
+    EXPECT_DOUBLE_EQ(cachedAverages.meanTemp_C, climateAverages.meanTemp_C);
+    EXPECT_DOUBLE_EQ(cachedAverages.PPT_cm, climateAverages.PPT_cm);
+    EXPECT_DOUBLE_EQ(cachedAverages.PPT7thMon_mm, climateAverages.PPT7thMon_mm);
+    EXPECT_DOUBLE_EQ(
+        cachedAverages.meanTempDriestQtr_C, climateAverages.meanTempDriestQtr_C
+    );
+    EXPECT_DOUBLE_EQ(
+        cachedAverages.minTemp2ndMon_C, climateAverages.minTemp2ndMon_C
+    );
+    EXPECT_DOUBLE_EQ(
+        cachedAverages.ddAbove65F_degday, climateAverages.ddAbove65F_degday
+    );
+    EXPECT_DOUBLE_EQ(
+        cachedAverages.frostFree_days, climateAverages.frostFree_days
+    );
+    EXPECT_DOUBLE_EQ(
+        cachedAverages.minTemp7thMon_C, climateAverages.minTemp7thMon_C
+    );
+
+
+    // ------ Different hemisphere or daily weather: different hash ------
+    EXPECT_NE(
+        SW_WTH_hash_climate(SW_Run.Weather.allHist, 31, 1980, swFALSE), hash
+    );
+
+    SW_Run.Weather.allHist[3].ppt[100] += 0.1;
+    EXPECT_NE(
+        SW_WTH_hash_climate(SW_Run.Weather.allHist, 31, 1980, inNorthHem), hash
+    );
+    SW_Run.Weather.allHist[3].ppt[100] -= 0.1;
+
+    // Sign of one value (highest bit of its bit pattern)
+    SW_Run.Weather.allHist[5].temp_min[10] *= -1.;
+    EXPECT_NE(
+        SW_WTH_hash_climate(SW_Run.Weather.allHist, 31, 1980, inNorthHem), hash
+    );
+    SW_Run.Weather.allHist[5].temp_min[10] *= -1.;
+
+
+    // ------ Incomplete cache is ignored ------
+    fp = fopen(fname, "wb");
+    ASSERT_NE(fp, nullptr);
+    (void) fputs("SW2CLIM", fp);
+    (void) fclose(fp);
+
+    EXPECT_FALSE(
+        SW_WTH_read_climate_cache(cacheDir, hash, &cachedAverages, &LogInfo)
+    );
+
+
+    // ------ Reset and deallocate
+    (void) remove(fname);
+    (void) remove(cacheDir);
+    (void) remove("Output/test_abs");
+    deallocateClimateStructs(&climateOutput, &climateAverages);
+    deallocateClimateStructs(&cachedOutput, &cachedAverages);
+}
+
 TEST_F(WeatherFixtureTest, WeatherReadInitialization) {
 
     SW_WTH_read(&SW_Run.Weather, &SW_Run.Sky, &SW_Run.Model, swTRUE, &LogInfo);
@@ -800,6 +1183,141 @@ TEST_F(WeatherFixtureTest, WeatherReadInitialization) {
     EXPECT_FLOAT_EQ(SW_Run.Weather.allHist[0].temp_max[0], -.52);
 }
 
+TEST_F(WeatherFixtureTest, WeatherBinaryCacheRoundTrip) {
+    char fname[MAX_FILENAMESIZE];
+    unsigned int const startYear = SW_Run.Weather.startYear;
+    unsigned int const nYears = SW_Run.Weather.n_years;
+    unsigned int yearIndex;
+    int varNum;
+    int resSNP;
+    Bool isCached[MAX_NYEAR];
+    double ***tempText = NULL;
+    double ***tempCache = NULL;
+
+    ASSERT_LE(nYears, MAX_NYEAR);
+
+    resSNP = snprintf(
+        fname,
+        sizeof fname,
+        "%s.%s",
+        SW_Run.Weather.name_prefix,
+        SW_WTH_CACHE_EXT
+    );
+    ASSERT_GT(resSNP, 0);
+    ASSERT_LT((unsigned) resSNP, sizeof fname);
+    ASSERT_FALSE(FileExists(fname));
+
+    allocate_temp_weather(nYears, &tempText, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    allocate_temp_weather(nYears, &tempCache, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    // Reference: read text inputs
+    for (yearIndex = 0; yearIndex < nYears; yearIndex++) {
+        clear_hist_weather(NULL, tempText[yearIndex]);
+        clear_hist_weather(NULL, tempCache[yearIndex]);
+
+        read_weather_hist(
+            startYear + yearIndex,
+            tempText[yearIndex],
+            SW_Run.Weather.name_prefix,
+            SW_Run.Weather.n_input_forcings,
+            SW_Run.Weather.dailyInputIndices,
+            SW_Run.Weather.dailyInputFlags,
+            &LogInfo
+        );
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    }
+
+    // Build and read cache
+    SW_WTH_write_cache(
+        SW_Run.Weather.name_prefix,
+        startYear,
+        nYears,
+        SW_Run.Weather.n_input_forcings,
+        SW_Run.Weather.dailyInputIndices,
+        SW_Run.Weather.dailyInputFlags,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_TRUE(FileExists(fname));
+
+    SW_WTH_read_cache(
+        SW_Run.Weather.name_prefix,
+        startYear,
+        nYears,
+        SW_Run.Weather.n_input_forcings,
+        SW_Run.Weather.dailyInputIndices,
+        SW_Run.Weather.dailyInputFlags,
+        tempCache,
+        isCached,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+
+    // Cached values are bit-identical to values read from text
+    for (yearIndex = 0; yearIndex < nYears; yearIndex++) {
+        EXPECT_TRUE(isCached[yearIndex]);
+
+        for (varNum = 0; varNum < MAX_INPUT_COLUMNS; varNum++) {
+            if (SW_Run.Weather.dailyInputFlags[varNum]) {
+                EXPECT_EQ(
+                    memcmp(
+                        tempText[yearIndex][varNum],
+                        tempCache[yearIndex][varNum],
+                        sizeof(double) * MAX_DAYS
+                    ),
+                    0
+                ) << "year = " << startYear + yearIndex
+                  << ", variable = " << varNum;
+            }
+        }
+    }
+
+    // Years outside of cache are not filled
+    SW_WTH_read_cache(
+        SW_Run.Weather.name_prefix,
+        startYear + nYears - 1,
+        2,
+        SW_Run.Weather.n_input_forcings,
+        SW_Run.Weather.dailyInputIndices,
+        SW_Run.Weather.dailyInputFlags,
+        tempCache,
+        isCached,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_TRUE(isCached[0]);
+    EXPECT_FALSE(isCached[1]);
+
+    // Simulation reads from cache
+    SW_WTH_read(&SW_Run.Weather, &SW_Run.Sky, &SW_Run.Model, swTRUE, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_FLOAT_EQ(SW_Run.Weather.allHist[0].temp_max[0], -.52);
+    EXPECT_EQ(LogInfo.numWarnings, 0);
+
+    // Cache is ignored if input columns differ
+    SW_WTH_read_cache(
+        SW_Run.Weather.name_prefix,
+        startYear,
+        nYears,
+        SW_Run.Weather.n_input_forcings + 1,
+        SW_Run.Weather.dailyInputIndices,
+        SW_Run.Weather.dailyInputFlags,
+        tempCache,
+        isCached,
+        &LogInfo
+    );
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    EXPECT_FALSE(isCached[0]);
+    EXPECT_EQ(LogInfo.numWarnings, 1);
+
+    (void) remove(fname);
+    deallocate_temp_weather(nYears, &tempText);
+    deallocate_temp_weather(nYears, &tempCache);
+}
+
 TEST_F(WeatherFixtureTest, WeatherMonthlyInputPrioritization) {
     /*
        This section covers the correct prioritization of monthly input values
@@ -1,11 +1,17 @@
+#include "include/filefuncs.h"           // for OpenFile, CloseFile
 #include "include/generic.h"             // for Bool, swFALSE, swTRUE
+#include "include/myMemory.h"            // for Mem_PeakUsage
 #include "include/SW_datastructs.h"      // for LOG_INFO, SW_WALLTIME
 #include "include/SW_Defines.h"          // for MAX_MONTHS, TimeInt, MAX_DAYS
-#include "include/SW_Main_lib.h"         // for sw_init_logs
+#include "include/SW_Main_lib.h"         // for sw_init_logs, sw_fail_on_...
 #include "include/Times.h"               // for doy2mday, doy2month, doy2week
 #include "tests/gtests/sw_testhelpers.h" // for tol9, length
+#include "gmock/gmock.h"                 // for HasSubstr
 #include "gtest/gtest.h"                 // for Message, TestPartResult, Test
-#include <stdio.h>                       // for NULL
+#include <stdio.h>                       // for NULL, fread, remove
+#include <string.h>                      // for strlen
+
+using ::testing::HasSubstr;
 
 namespace {
 TEST(TimesTest, TimesLeapYear) {
@@ -267,4 +273,159 @@ TEST(TimesTest, TimeTracking) {
         EXPECT_EQ(wt.nTimedRuns, 0);
     }
 }
+
+// Test timing of phases and the phase profile
+TEST(TimesTest, TimesPhaseProfile) {
+    SW_WALLTIME wt;
+    SW_PHASETIMES pt;
+    LOG_INFO LogInfo;
+    char fnames[2][40] = {
+        "Output/test_Times_profile.csv", "Output/test_Times_profile.json"
+    };
+    char content[2048];
+    size_t nread;
+    FILE *fp;
+    int k;
+    int const n_calls = 5;
+    double const t0 = monotonic_walltime();
+
+    // Monotonic clock does not go backwards
+    if (t0 >= 0.) {
+        EXPECT_GE(monotonic_walltime(), t0);
+    }
+
+    // Accumulate phase times locally
+    SW_WT_InitPhaseTimes(&pt);
+
+    for (k = 0; k < n_calls; k++) {
+        SW_WT_PhaseStart(&pt, eSW_PhSoilTemp);
+        // ... do some work
+        SW_WT_PhaseStop(&pt, eSW_PhSoilTemp);
+    }
+
+    // Stop without start does not count
+    SW_WT_PhaseStop(&pt, eSW_PhSpinup);
+
+    // NULL accumulator is not timed
+    SW_WT_PhaseStart(NULL, eSW_PhSpinup);
+    SW_WT_PhaseStop(NULL, eSW_PhSpinup);
+
+    if (t0 >= 0.) {
+        EXPECT_EQ(pt.nPhase[eSW_PhSoilTemp], (unsigned long) n_calls);
+        EXPECT_GE(pt.timePhase[eSW_PhSoilTemp], 0.);
+    }
+    EXPECT_EQ(pt.nPhase[eSW_PhSpinup], 0u);
+
+
+    // Add local phase times (twice) to overall phase times
+    SW_WT_StartTime(&wt);
+    SW_WT_AddPhaseTimes(&wt.PhaseTimes, &pt);
+    SW_WT_AddPhaseTimes(&wt.PhaseTimes, &pt);
+
+    EXPECT_EQ(
+        wt.PhaseTimes.nPhase[eSW_PhSoilTemp], 2 * pt.nPhase[eSW_PhSoilTemp]
+    );
+    EXPECT_DOUBLE_EQ(
+        wt.PhaseTimes.timePhase[eSW_PhSoilTemp],
+        2 * pt.timePhase[eSW_PhSoilTemp]
+    );
+
+
+    // Time reporting includes phases
+    sw_init_logs(NULL, &LogInfo);
+    LogInfo.QuietMode = swTRUE;
+    SW_WT_ReportTime(wt, &LogInfo);
+
+
+    // Write profile as csv and as json
+    for (k = 0; k < 2; k++) {
+        wt.profileFile = fnames[k];
+        SW_WT_WriteProfile(&wt, &LogInfo);
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+        fp = OpenFile(fnames[k], "r", &LogInfo);
+        sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+        nread = fread(content, 1, sizeof content - 1, fp);
+        content[nread] = '\0';
+        CloseFile(&fp, &LogInfo);
+
+        if (k == 0) {
+            EXPECT_THAT(content, HasSubstr("phase,calls,seconds,percent\n"));
+            EXPECT_THAT(content, HasSubstr("\nspinup,0,0.000000,NA\n"));
+        } else {
+            EXPECT_THAT(content, HasSubstr("\"phases\": ["));
+            EXPECT_THAT(
+                content,
+                HasSubstr(
+                    "{\"phase\": \"spinup\", \"calls\": 0, "
+                    "\"seconds\": 0.000000}"
+                )
+            );
+            EXPECT_EQ(content[strlen(content) - 2], '}');
+        }
+
+        (void) remove(fnames[k]);
+    }
+}
+
+// Test diagnostics of simulation runs
+TEST(TimesTest, TimesSuidDiagnostics) {
+    SW_WALLTIME wt;
+    SW_SUIDDIAG diag;
+    LOG_INFO LogInfo;
+    char fname[] = "Output/test_Times_suids.csv";
+    unsigned long ncSuid[2] = {3, 0};
+    char content[1024];
+    size_t nread;
+    FILE *fp;
+
+    sw_init_logs(NULL, &LogInfo);
+    SW_WT_StartTime(&wt);
+
+    // No file requested
+    EXPECT_TRUE(SW_WT_OpenSuidDiag(&wt, &LogInfo) == NULL);
+    EXPECT_FALSE(LogInfo.stopRun);
+
+    // Write diagnostics of two runs
+    wt.suidDiagFile = fname;
+    fp = SW_WT_OpenSuidDiag(&wt, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    diag.wallTime = 0.25;
+    diag.runMemory = 640;
+    diag.processPeakMemory = Mem_PeakUsage();
+    diag.nGeneratedDays = 365;
+    diag.nWarnings = 2;
+    diag.nLayers = 8;
+    diag.nSpinupYears = 12;
+    diag.hasError = swFALSE;
+    diag.soilTempError = swTRUE;
+    SW_WT_WriteSuidDiag(fp, 4, ncSuid, &diag, &LogInfo);
+
+    diag.wallTime = -1.; // time failed
+    diag.processPeakMemory = -1; // not available
+    diag.hasError = swTRUE;
+    ncSuid[0] = 4;
+    SW_WT_WriteSuidDiag(fp, 5, ncSuid, &diag, &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+
+    CloseFile(&fp, &LogInfo);
+
+    fp = OpenFile(fname, "r", &LogInfo);
+    sw_fail_on_error(&LogInfo); // exit test program if unexpected error
+    nread = fread(content, 1, sizeof content - 1, fp);
+    content[nread] = '\0';
+    CloseFile(&fp, &LogInfo);
+
+    EXPECT_THAT(content, HasSubstr("suid,ncSuid0,ncSuid1,wallTime,"));
+    EXPECT_THAT(
+        content, HasSubstr(",soilTempError,processPeakMemory,nSpinupYears,")
+    );
+    EXPECT_THAT(content, HasSubstr(",nSpinupYears,runMemory\n"));
+    EXPECT_THAT(content, HasSubstr("\n4,3,0,0.250000,8,365,2,0,1,"));
+    EXPECT_THAT(content, HasSubstr(",12,640\n"));
+    EXPECT_THAT(content, HasSubstr("\n5,4,0,NA,8,365,2,1,1,NA,12,640\n"));
+
+    (void) remove(fname);
+}
 } // namespace
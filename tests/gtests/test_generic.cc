@@ -1,8 +1,14 @@
-#include "include/generic.h"    // for sw_strtok, standardDeviation, mean
-#include "include/SW_Defines.h" // for SW_MISSING
-#include "gtest/gtest.h"        // for Message, AssertionResult, Test, Test...
-#include <cmath>                // for isnan
-#include <stdio.h>              // for NULL
+#include "include/filefuncs.h"      // for sw_strtod, sw_strtol
+#include "include/generic.h"        // for sw_strtok, standardDeviation, mean
+#include "include/SW_datastructs.h" // for LOG_INFO
+#include "include/SW_Defines.h"     // for SW_MISSING
+#include "include/SW_Main_lib.h"    // for sw_init_logs
+#include "gtest/gtest.h"            // for Message, AssertionResult, Test, ...
+#include <cmath>                    // for isnan, pow, NAN, INFINITY
+#include <locale.h>                 // for setlocale, localeconv, LC_NUMERIC
+#include <stdio.h>                  // for NULL, snprintf
+#include <stdlib.h>                 // for strtod, strtol
+#include <string.h>                 // for memcmp, strcmp, strncpy
 
 namespace {
 const unsigned int N = 9;
@@ -202,4 +208,214 @@ TEST(GenericTest, GenericStrtok) {
         sw_strtok(multipleDelimStr, &startIndex, &strLen, multipleDelim);
     ASSERT_STREQ(currString, "testFile.in");
 }
+
+TEST(GenericTest, GenericSplitTokens) {
+    char *tokens[3];
+    char line[] = "  1980\t1  -5.2 \r\n";
+    char emptyLine[] = " \t ";
+    char longLine[] = "a b c d e";
+
+    EXPECT_EQ(sw_split_tokens(line, tokens, 3), 3);
+    EXPECT_STREQ(tokens[0], "1980");
+    EXPECT_STREQ(tokens[1], "1");
+    EXPECT_STREQ(tokens[2], "-5.2");
+
+    EXPECT_EQ(sw_split_tokens(emptyLine, tokens, 3), 0);
+
+    // Additional tokens are counted but not stored
+    EXPECT_EQ(sw_split_tokens(longLine, tokens, 3), 5);
+    EXPECT_STREQ(tokens[2], "c");
+}
+
+TEST(GenericTest, GenericStringToNumberIdenticalToStdlib) {
+    LOG_INFO LogInfo;
+    char str[64];
+    const char *cases[] = {
+        "0",
+        "-0",
+        "+1.5",
+        ".5",
+        "5.",
+        "0.1",
+        "-15.67",
+        "1e5",
+        "1.25E-3",
+        "0.000123456789",
+        "123456789012345678", // significand > 2^53: uses strtod()
+        "9007199254740993",   // 2^53 + 1: uses strtod()
+        "1e-30",              // exponent out of fast range: uses strtod()
+        " 2.5",               // leading white space: uses strtod()
+        "nan",
+        "-inf"
+    };
+    const int nCases = sizeof(cases) / sizeof(cases[0]);
+    double res;
+    double expected;
+    unsigned long long state = 42;
+    int k;
+    int digits;
+
+    sw_init_logs(NULL, &LogInfo);
+
+    for (k = 0; k < nCases; k++) {
+        res = sw_strtod(cases[k], "test", &LogInfo);
+        expected = strtod(cases[k], NULL);
+        ASSERT_FALSE(LogInfo.stopRun) << cases[k];
+        EXPECT_EQ(memcmp(&res, &expected, sizeof(double)), 0) << cases[k];
+    }
+
+    // Pseudo-random decimal values with up to 17 significant digits
+    for (k = 0; k < 100000; k++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        digits = (int) (state >> 60);
+        (void) snprintf(
+            str,
+            sizeof str,
+            "%.*f",
+            digits,
+            ((double) (state >> 11) - 4503599627370496.) / 1e10
+        );
+
+        res = sw_strtod(str, "test", &LogInfo);
+        expected = strtod(str, NULL);
+        ASSERT_FALSE(LogInfo.stopRun) << str;
+        ASSERT_EQ(memcmp(&res, &expected, sizeof(double)), 0) << str;
+    }
+
+    // Integers
+    EXPECT_EQ(sw_strtol("-123", "test", &LogInfo), -123);
+    EXPECT_EQ(sw_strtol("+0042", "test", &LogInfo), 42);
+    EXPECT_EQ(sw_strtol(" 7", "test", &LogInfo), 7); // uses strtol()
+    ASSERT_FALSE(LogInfo.stopRun);
+
+    // Conversion errors
+    (void) sw_strtod("1.2.3", "test", &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+
+    sw_init_logs(NULL, &LogInfo);
+    (void) sw_strtod("1e", "test", &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+
+    sw_init_logs(NULL, &LogInfo);
+    (void) sw_strtol("12a", "test", &LogInfo);
+    EXPECT_TRUE(LogInfo.stopRun);
+}
+
+TEST(GenericTest, GenericStrtodIndependentOfLocale) {
+    LOG_INFO LogInfo;
+    const char *cases[] = {
+        "-15.67",               // fast path
+        "1.25e-30",             // exponent out of fast range: uses strtod()
+        "123456789012345678.5", // significand > 2^53: uses strtod()
+        " 2.5"                  // leading white space: uses strtod()
+    };
+    const int nCases = sizeof(cases) / sizeof(cases[0]);
+    // Locales with a decimal comma (if installed)
+    const char *locales[] = {
+        "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "de_DE"
+    };
+    const int nLocales = sizeof(locales) / sizeof(locales[0]);
+    double expected[nCases];
+    double res;
+    char prevLocale[256];
+    Bool hasCommaLocale = swFALSE;
+    int k;
+
+    // Values in the "C" locale
+    for (k = 0; k < nCases; k++) {
+        expected[k] = strtod(cases[k], NULL);
+    }
+
+    (void) strncpy(
+        prevLocale, setlocale(LC_NUMERIC, NULL), sizeof prevLocale - 1
+    );
+    prevLocale[sizeof prevLocale - 1] = '\0';
+
+    for (k = 0; k < nLocales && !hasCommaLocale; k++) {
+        if (!isnull(setlocale(LC_NUMERIC, locales[k]))) {
+            hasCommaLocale =
+                (Bool) (strcmp(localeconv()->decimal_point, ".") != 0);
+        }
+    }
+
+    sw_init_logs(NULL, &LogInfo);
+
+    for (k = 0; k < nCases; k++) {
+        res = sw_strtod(cases[k], "test", &LogInfo);
+        EXPECT_FALSE(LogInfo.stopRun) << cases[k];
+        EXPECT_EQ(memcmp(&res, &expected[k], sizeof(double)), 0) << cases[k];
+    }
+
+    if (hasCommaLocale) {
+        // Decimal point of the locale is not accepted
+        (void) sw_strtod("1,5", "test", &LogInfo);
+        EXPECT_TRUE(LogInfo.stopRun);
+    }
+
+    (void) setlocale(LC_NUMERIC, prevLocale);
+}
+
+TEST(GenericTest, GenericFormatFixedIdenticalToSnprintf) {
+    char res[64];
+    char expected[64];
+    const double cases[] = {
+        0.,
+        -0.,
+        1.,
+        -1.,
+        0.5,
+        -2.5,
+        0.0078125,  // exact tie at 6 digits
+        -0.0078125, // exact tie at 6 digits
+        1.0000005,
+        0.1234565,
+        -1e-9,
+        1e-300,
+        123456789.123456,
+        4503599627.370496, // limit of fast path at 6 digits
+        1e15,
+        -1e300,
+        SW_MISSING,
+        NAN,
+        INFINITY,
+        -INFINITY
+    };
+    const int nCases = sizeof(cases) / sizeof(cases[0]);
+    unsigned long long state = 7;
+    double value;
+    int resLen;
+    int expectedLen;
+    int k;
+    int digits;
+
+    for (digits = 0; digits <= 10; digits++) {
+        for (k = 0; k < nCases; k++) {
+            resLen = sw_format_fixed(res, sizeof res, ',', cases[k], digits);
+            expectedLen = snprintf(
+                expected, sizeof expected, "%c%.*f", ',', digits, cases[k]
+            );
+            EXPECT_EQ(resLen, expectedLen);
+            EXPECT_STREQ(res, expected) << "digits = " << digits;
+        }
+    }
+
+    // Pseudo-random values across magnitudes
+    for (k = 0; k < 200000; k++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        value = ((double) (state >> 11) - 4503599627370496.) /
+                pow(10., (double) ((state >> 3) % 16));
+        digits = (int) ((state >> 7) % 10);
+
+        (void) sw_format_fixed(res, sizeof res, ',', value, digits);
+        (void) snprintf(
+            expected, sizeof expected, "%c%.*f", ',', digits, value
+        );
+        ASSERT_STREQ(res, expected);
+    }
+
+    // Truncation as snprintf()
+    resLen = sw_format_fixed(res, 5, ',', -12.345678, 6);
+    EXPECT_EQ(resLen, 11);
+    EXPECT_STREQ(res, ",-12");
+}
 } // namespace
@@ -60,6 +60,53 @@ TEST(RNGTest, RNGUnifZeroToOneOutput) {
     }
 }
 
+// This tests keyed random number streams and bulk uniform draws
+TEST(RNGTest, RNGStreamsKeyedAndBulk) {
+    sw_random_t rngA;
+    sw_random_t rngA2;
+    sw_random_t rngB;
+    sw_random_t rngS;
+    int i;
+    int const n = 10;
+    double xA[10];
+    double xA2[10];
+    double xB;
+    double xS;
+
+    // Same key: identical stream independent of other generators
+    RandSeedStream(7u, 3u, SW_RNG_STREAM_MARKOV, 0u, &rngA);
+    RandSeedStream(7u, 4u, SW_RNG_STREAM_MARKOV, 0u, &rngB);
+    RandSeedStream(7u, 3u, SW_RNG_STREAM_SPINUP, 0u, &rngS);
+    (void) RandUni(&rngB);
+    RandSeedStream(7u, 3u, SW_RNG_STREAM_MARKOV, 0u, &rngA2);
+
+    // Bulk fill produces same values as repeated single draws
+    RandUniFill(n, xA, &rngA);
+
+    for (i = 0; i < n; i++) {
+        xA2[i] = RandUni(&rngA2);
+        EXPECT_DOUBLE_EQ(xA[i], xA2[i]);
+        EXPECT_GE(xA[i], 0.);
+        EXPECT_LT(xA[i], 1.);
+
+        // Different simulation unit or stream produce different output
+        xB = RandUni(&rngB);
+        xS = RandUni(&rngS);
+        EXPECT_TRUE(xA[i] != xB);
+        EXPECT_TRUE(xA[i] != xS);
+    }
+
+    // Jump ahead: random access to draw i of a stream
+    for (i = 0; i < n; i++) {
+        RandSeedStream(7u, 3u, SW_RNG_STREAM_MARKOV, (unsigned long) i, &rngA);
+        EXPECT_DOUBLE_EQ(RandUni(&rngA), xA2[i]);
+    }
+
+    RandSeedStream(7u, 3u, SW_RNG_STREAM_MARKOV, 0u, &rngA);
+    RandAdvance(n - 1, &rngA);
+    EXPECT_DOUBLE_EQ(RandUni(&rngA), xA2[n - 1]);
+}
+
 TEST(RNGTest, RNGUnifFloatRangeOutput) {
     sw_random_t rng71;
     sw_random_t rng71b;
@@ -0,0 +1,421 @@
+#!/bin/bash
+
+#------ . ------
+usage="
+Measure end-to-end throughput of SOILWAT2 on synthetic simulation domains
+
+    * Generate synthetic domains from the inputs of 'tests/example/' with a
+      configurable number of sites (or grid cells), soil layers, years,
+      active output keys, and spinup years
+    * Build SOILWAT2 (text-based and, if requested, nc-based) in separate
+      build directories under the output directory (builds and outputs of
+      the working tree are not touched) and run it for each output mode
+    * Report sites per second, simulated years (including spinup) per second,
+      peak resident set size, and bytes of inputs and outputs;
+      results are appended to a csv file to track throughput across commits
+
+Output modes:
+    txt                 text-based SOILWAT2 writing 'csv' output files
+    bin                 text-based SOILWAT2 writing binary columnar output
+                        files ('OUTFORMAT binary')
+    nc                  nc-based SOILWAT2 (requires netCDF, see 'makefile')
+                        which collects output in arrays and writes them
+                        to netCDF output files
+
+Usage: tools/run_throughput.sh [OPTIONS]
+
+Options:
+    -m, --modes <modes> Comma-separated list of output modes;
+                        default is 'txt,bin'.
+    -d, --domain <type> Type of simulation domain: 's' (sites) or 'xy' (grid);
+                        default is 's'.
+    -n, --nSites <n>    Number of sites (if domain is 's'); default is 10.
+    -x, --nx <n>        Number of grid cells along x (if domain is 'xy');
+                        default is 4.
+    -y, --ny <n>        Number of grid cells along y (if domain is 'xy');
+                        default is 4.
+    -l, --nLayers <n>   Number of soil layers (3-25), the example soil profile
+                        is divided evenly; default is 8 (example layers).
+    -t, --nYears <n>    Number of simulated years starting in 1980; daily
+                        weather of years after 2010 is recycled;
+                        default is 31 (1980-2010).
+    -k, --nKeys <n>     Number of active output keys (or 'all');
+                        default is 'all' (all output keys of the example).
+    -s, --spinup <n>    Number of spinup years; default is 0.
+    -o, --outDir <path> Directory for synthetic domains and results;
+                        default is 'tests/benchmarks/throughput'.
+    -c, --clean         Remove synthetic domains after the runs.
+    -h, --help          Display this help page.
+
+Examples:
+    * 10 sites with text and binary output:
+        tools/run_throughput.sh
+    * 100 sites with 20 soil layers, 100 years, and 5 output keys:
+        tools/run_throughput.sh -n 100 -l 20 -t 100 -k 5
+    * 10 x 10 grid with nc-based SOILWAT2 and 50 years of spinup:
+        tools/run_throughput.sh -m nc -d xy -x 10 -y 10 -s 50
+"
+#------ . ------
+
+
+#------ SETTINGS ----------------------------------------------------------
+dir_example="tests/example"
+
+# Example years with daily weather (recycled in steps of 28 years which
+# preserves leap years)
+exampleStartYear=1980
+nYearsRecycle=28
+
+#--- Command line arguments
+modes="txt,bin"
+domainType="s"
+nSites=10
+nx=4
+ny=4
+nLayers=8
+nYears=31
+nKeys="all"
+nSpinup=0
+dir_out="tests/benchmarks/throughput"
+doClean=false
+
+while [ $# -gt 0 ]; do
+    case $1 in
+        -m|--modes) modes="$2"; shift ;;
+        -d|--domain) domainType="$2"; shift ;;
+        -n|--nSites) nSites="$2"; shift ;;
+        -x|--nx) nx="$2"; shift ;;
+        -y|--ny) ny="$2"; shift ;;
+        -l|--nLayers) nLayers="$2"; shift ;;
+        -t|--nYears) nYears="$2"; shift ;;
+        -k|--nKeys) nKeys="$2"; shift ;;
+        -s|--spinup) nSpinup="$2"; shift ;;
+        -o|--outDir) dir_out="$2"; shift ;;
+        -c|--clean) doClean=true ;;
+        -h|--help) echo "${usage}"; exit 0 ;;
+        *) echo "Unknown option: $1"; echo "${usage}"; exit 1 ;;
+    esac
+    shift
+done
+
+
+#------ FUNCTIONS --------------------------------------------------------------
+#--- Wall-clock time in seconds (with sub-second resolution if available)
+now_seconds() {
+    if command -v perl > /dev/null 2>&1; then
+        perl -MTime::HiRes=time -e 'printf "%.6f\n", time'
+    else
+        date +%s
+    fi
+}
+
+#--- Sum of file sizes (bytes) in a directory
+# $1 Path to directory
+dir_bytes() {
+    if [ -d "$1" ]; then
+        find "$1" -type f -exec wc -c {} + |
+            awk '$2 != "total" { s += $1 } END { printf "%.0f\n", s }'
+    else
+        echo 0
+    fi
+}
+
+#--- Set value of a key in a key-value input file (e.g., 'domain.in')
+# $1 Path to file
+# $2 Key
+# $3 Value
+set_key_value() {
+    awk -v key="$2" -v value="$3" '
+        $1 == key { sub(/^[^ \t]+[ \t]+[^ \t#]+/, key " " value) }
+        { print }
+    ' "$1" > "$1.tmp" && mv "$1.tmp" "$1"
+}
+
+#--- Divide the example soil profile into `nLayers` layers of equal width
+# Soil properties are taken from the example layer that contains the
+# midpoint of a new layer; evaporation and transpiration coefficients are
+# distributed proportionally to the overlap with example layers so that
+# their sums are maintained
+# $1 Path to 'soils.in'
+# $2 Number of soil layers
+generate_soils() {
+    awk -v n="$2" '
+        /^[ \t]*#/ || NF == 0 { if (nex == 0) print; next }
+        {
+            nex++
+            for (j = 1; j <= NF; j++) ex[nex, j] = $j
+            nf = NF
+        }
+        END {
+            maxDepth = ex[nex, 1]
+
+            for (i = 1; i <= n; i++) {
+                top = maxDepth * (i - 1) / n
+                bottom = maxDepth * i / n
+                mid = (top + bottom) / 2
+
+                for (m = 1; m < nex && ex[m, 1] < mid; m++) {}
+
+                printf "%7.2f", bottom
+                for (j = 2; j <= nf; j++) {
+                    v = ex[m, j]
+
+                    # evco (column 4) and trco (columns 5-8)
+                    if (j >= 4 && j <= 8) {
+                        v = 0
+                        for (k = 1; k <= nex; k++) {
+                            prev = (k > 1) ? ex[k - 1, 1] : 0
+                            lo = (top > prev) ? top : prev
+                            hi = (bottom < ex[k, 1]) ? bottom : ex[k, 1]
+                            if (hi > lo) {
+                                v += ex[k, j] * (hi - lo) / (ex[k, 1] - prev)
+                            }
+                        }
+                    }
+
+                    printf "\t%.6g", v
+                }
+                printf "\n"
+            }
+        }
+    ' "$1" > "$1.tmp" && mv "$1.tmp" "$1"
+}
+
+#--- Turn off all but the first `nKeys` active output keys
+# $1 Path to 'outsetup.in'
+# $2 Number of output keys to keep active
+limit_outkeys() {
+    awk -v n="$2" '
+        /^[ \t]*[A-Z0-9]+[ \t]+(AVG|SUM|FIN|FNL)[ \t]/ && !/^[ \t]*TIMESTEP/ {
+            nk++
+            if (nk > n) sub(/[ \t]+(AVG|SUM|FIN|FNL)[ \t]/, "     OFF ")
+        }
+        { print }
+    ' "$1" > "$1.tmp" && mv "$1.tmp" "$1"
+}
+
+#--- Create a synthetic simulation domain from the example inputs
+# $1 Path to synthetic domain
+# $2 Output mode
+generate_domain() {
+    local dir="$1"
+    local mode="$2"
+    local endYear=$((exampleStartYear + nYears - 1))
+    local y ysrc
+
+    rm -rf "${dir}" > /dev/null 2>&1
+    mkdir -p "${dir}"
+    cp -R "${dir_example}/." "${dir}"
+
+    # Remove artifacts and inputs not used by the synthetic domain
+    rm -rf "${dir}/Output" "${dir}/logs" "${dir}"/Input/data_weather_*
+    rm -f "${dir}"/Input_nc/domain*.nc "${dir}"/Input_nc/progress.nc
+    find "${dir}/Input_nc" -type f -name 'index*.nc' -delete
+    mkdir -p "${dir}/Output"
+
+    # Domain: type, size, years, and spinup
+    set_key_value "${dir}/Input/domain.in" "Domain" "${domainType}"
+    set_key_value "${dir}/Input/domain.in" "nDimS" "${nSites}"
+    set_key_value "${dir}/Input/domain.in" "nDimX" "${nx}"
+    set_key_value "${dir}/Input/domain.in" "nDimY" "${ny}"
+    set_key_value "${dir}/Input/domain.in" "EndYear" "${endYear}"
+    set_key_value "${dir}/Input/domain.in" "SpinupDuration" "${nSpinup}"
+
+    if [ "${domainType}" = "xy" ]; then
+        # Grid cells are spaced 0.01 degrees apart
+        set_key_value "${dir}/Input/domain.in" "xmax_bbox" \
+            "$(awk -v n="${nx}" 'BEGIN { printf "%.2f", -105.58 + 0.01 * n }')"
+        set_key_value "${dir}/Input/domain.in" "ymax_bbox" \
+            "$(awk -v n="${ny}" 'BEGIN { printf "%.2f", 39.59 + 0.01 * n }')"
+    fi
+
+    # Daily weather: recycle example years
+    for ((y = exampleStartYear + 31; y <= endYear; y++)); do
+        ysrc=$((exampleStartYear + (y - exampleStartYear) % nYearsRecycle))
+        cp "${dir}/Input/data_weather/weath.${ysrc}" \
+            "${dir}/Input/data_weather/weath.${y}"
+    done
+
+    # Soil layers
+    if [ "${nLayers}" -ne 8 ]; then
+        generate_soils "${dir}/Input/soils.in" "${nLayers}"
+    fi
+
+    # Output keys and format
+    if [ "${nKeys}" != "all" ]; then
+        limit_outkeys "${dir}/Input/outsetup.in" "${nKeys}"
+    fi
+
+    if [ "${mode}" = "bin" ]; then
+        awk '{ print } /^TIMESTEP/ { print "OUTFORMAT binary" }' \
+            "${dir}/Input/outsetup.in" > "${dir}/Input/outsetup.in.tmp" &&
+            mv "${dir}/Input/outsetup.in.tmp" "${dir}/Input/outsetup.in"
+    fi
+}
+
+#--- Build SOILWAT2 in a separate build directory and keep a copy of the
+# executable (build artifacts of the working tree are not touched)
+# $1 Build variant: txt or nc
+build_sw2() {
+    local dir_build="${dir_out}/build_${1}"
+    local -a mflags=("dir_build=${dir_build}/obj" "dir_bin=${dir_build}/bin")
+
+    if [ "$1" = "nc" ]; then
+        mflags+=("CPPFLAGS=-DSWNC")
+    fi
+
+    echo "Build ${1}-based SOILWAT2 ..."
+    rm -rf "${dir_build}" > /dev/null 2>&1
+    if ! make "${mflags[@]}" all > "${dir_out}/build_${1}.log" 2>&1; then
+        echo "make failed: see '${dir_out}/build_${1}.log'"
+        return 1
+    fi
+
+    cp "${dir_build}/bin/SOILWAT2" "${dir_out}/bin/SOILWAT2_${1}"
+    rm -rf "${dir_build}" > /dev/null 2>&1
+}
+
+#--- Run SOILWAT2 on a synthetic domain and report throughput
+# $1 Output mode
+run_mode() {
+    local mode="$1"
+    local variant="txt"
+    local dir="${dir_out}/domain_${mode}"
+    local exe diag nSuids nSimYears t0 t1 res
+    local wallTime peakRSS bytesIn bytesOut sitesPerSec yearsPerSec
+
+    if [ "${mode}" = "nc" ]; then
+        variant="nc"
+    fi
+    exe="${dir_out}/bin/SOILWAT2_${variant}"
+
+    echo "Generate synthetic domain and run ${mode} mode ..."
+    generate_domain "${dir}" "${mode}"
+    diag="$(cd "${dir}" && pwd)/suid_diagnostics.csv"
+
+    if [ "${mode}" = "nc" ]; then
+        # First run creates the domain template (not timed)
+        res=$("${exe}" -d "${dir}" -f files.in 2>&1)
+        if [[ "$res" == *"Domain netCDF template has been created"* ]]; then
+            mv "${dir}/Input_nc/domain_template.nc" \
+                "${dir}/Input_nc/domain.nc" > /dev/null 2>&1
+        fi
+    fi
+
+    bytesIn=$(( $(dir_bytes "${dir}/Input") + $(dir_bytes "${dir}/Input_nc") ))
+
+    t0=$(now_seconds)
+    "${exe}" -d "${dir}" -f files.in -u "${diag}" > "${dir}/run.log" 2>&1
+    res=$?
+    t1=$(now_seconds)
+
+    if [ ${res} -ne 0 ] || [ ! -f "${diag}" ]; then
+        echo "SOILWAT2 failed in ${mode} mode: see '${dir}/run.log'"
+        return 1
+    fi
+
+    bytesOut=$(dir_bytes "${dir}/Output")
+
+    if [ "${domainType}" = "xy" ]; then
+        nSuids=$((nx * ny))
+    else
+        nSuids=${nSites}
+    fi
+    nSimYears=$((nSuids * (nYears + nSpinup)))
+
+    # Peak resident set size [kB] of the process is the largest value
+    # across suids of the column 'processPeakMemory'
+    peakRSS=$(awk -F, -v name="processPeakMemory" '
+        NR == 1 { for (j = 1; j <= NF; j++) if ($j == name) c = j }
+        NR > 1 && c > 0 && $c != "NA" && $c + 0 > m + 0 { m = $c }
+        END { print (m == "") ? "NA" : m }' "${diag}")
+
+    wallTime=$(awk -v a="${t0}" -v b="${t1}" 'BEGIN { printf "%.3f", b - a }')
+    sitesPerSec=$(awk -v n="${nSuids}" -v t="${wallTime}" \
+        'BEGIN { if (t > 0) printf "%.3f", n / t; else print "NA" }')
+    yearsPerSec=$(awk -v n="${nSimYears}" -v t="${wallTime}" \
+        'BEGIN { if (t > 0) printf "%.1f", n / t; else print "NA" }')
+
+    printf "%-5s %7s %10s %10s %12s %10s %12s %12s\n" \
+        "${mode}" "${nSuids}" "${wallTime}" "${sitesPerSec}" \
+        "${yearsPerSec}" "${peakRSS}" "${bytesIn}" "${bytesOut}" \
+        >> "${dir_out}/report.txt"
+
+    if [ ! -f "${fresults}" ]; then
+        echo "date,commit,mode,domain,nSuids,nLayers,nYears,nKeys,nSpinup,"\
+"wallTime,sitesPerSec,simYearsPerSec,peakRSS_kB,inputBytes,outputBytes" \
+            > "${fresults}"
+    fi
+
+    echo "$(date -u +%Y-%m-%dT%H:%M:%SZ),${commit},${mode},${domainType},"\
+"${nSuids},${nLayers},${nYears},${nKeys},${nSpinup},${wallTime},"\
+"${sitesPerSec},${yearsPerSec},${peakRSS},${bytesIn},${bytesOut}" \
+        >> "${fresults}"
+
+    if [ "${doClean}" = true ]; then
+        rm -rf "${dir}"
+    fi
+}
+
+
+#------ MAIN -------------------------------------------------------------------
+#--- Check arguments
+if [ "${domainType}" != "s" ] && [ "${domainType}" != "xy" ]; then
+    echo "Domain type must be 's' or 'xy'."
+    exit 1
+fi
+
+# Plant establishment of the example requires at least three soil layers
+if [ "${nLayers}" -lt 3 ] || [ "${nLayers}" -gt 25 ]; then
+    echo "Number of soil layers must be between 3 and 25 (MAX_LAYERS)."
+    exit 1
+fi
+
+# Yearly atmospheric CO2 concentration ('carbon.in') is available until 2250
+if [ "${nYears}" -lt 1 ] || [ "${nYears}" -gt 271 ]; then
+    echo "Number of years must be between 1 and 271."
+    exit 1
+fi
+
+mkdir -p "${dir_out}/bin"
+dir_out="$(cd "${dir_out}" && pwd)"
+fresults="${dir_out}/results.csv"
+commit=$(git describe --abbrev=7 --dirty --always --tags 2>/dev/null)
+rm -f "${dir_out}/report.txt"
+
+IFS=',' read -r -a listModes <<< "${modes}"
+
+
+#--- Build SOILWAT2
+for variant in txt nc; do
+    for mode in "${listModes[@]}"; do
+        if [ "${mode}" = "${variant}" ] ||
+            { [ "${variant}" = "txt" ] && [ "${mode}" = "bin" ]; }; then
+            build_sw2 "${variant}" || exit 1
+            break
+        fi
+    done
+done
+
+
+#--- Run SOILWAT2 for each output mode
+for mode in "${listModes[@]}"; do
+    case "${mode}" in
+        txt|bin|nc) run_mode "${mode}" ;;
+        *) echo "Unknown output mode: ${mode}" ;;
+    esac
+done
+
+
+#--- Report
+echo
+echo "Throughput of SOILWAT2 (${commit}): domain '${domainType}', "\
+"${nLayers} soil layers, ${nYears} years, ${nSpinup} spinup years, "\
+"output keys: ${nKeys}"
+printf "%-5s %7s %10s %10s %12s %10s %12s %12s\n" \
+    "mode" "nSuids" "wall[s]" "sites/s" "simYears/s" "RSS[kB]" \
+    "input[B]" "output[B]"
+if [ -f "${dir_out}/report.txt" ]; then
+    cat "${dir_out}/report.txt"
+fi
+echo "Results were appended to '${fresults}'."